@@ -23,7 +23,12 @@
  ****************************************************************************/
 
 #include "AppDelegate.h"
-#include "scenes/GameScene.h"
+#include "scenes/LoadingScene.h"
+#include "configs/models/CardResConfig.h"
+#include "views/ProfilerOverlayView.h"
+#include "views/ViewBenchmarks.h"
+#include "controllers/SoakBot.h"
+#include "controllers/FramePacer.h"
 
 // #define USE_AUDIO_ENGINE 1
 // #define USE_SIMPLE_AUDIO_ENGINE 1
@@ -43,8 +48,8 @@ using namespace CocosDenshion;
 USING_NS_CC;
 
 static cocos2d::Size designResolutionSize = cocos2d::Size(1080, 2080);
-static cocos2d::Size smallResolutionSize = cocos2d::Size(1080, 2080);
-static cocos2d::Size mediumResolutionSize = cocos2d::Size(1080, 2080);
+static cocos2d::Size smallResolutionSize = cocos2d::Size(540, 1040);
+static cocos2d::Size mediumResolutionSize = cocos2d::Size(810, 1560);
 static cocos2d::Size largeResolutionSize = cocos2d::Size(1080, 2080);
 
 AppDelegate::AppDelegate()
@@ -78,6 +83,9 @@ static int register_all_packages()
 }
 
 bool AppDelegate::applicationDidFinishLaunching() {
+    // 可交互耗时从这里开始计算
+    LoadingScene::markLaunch();
+
     // initialize director
     auto director = Director::getInstance();
     auto glview = director->getOpenGLView();
@@ -90,8 +98,10 @@ bool AppDelegate::applicationDidFinishLaunching() {
         director->setOpenGLView(glview);
     }
 
-    // turn on display FPS
-    director->setDisplayStats(true);
+#if CARD_PROFILING
+    // 分子系统帧耗时浮层，替代setDisplayStats；发布构建中整体不编译
+    ProfilerOverlayView::install(director);
+#endif
 
     // set FPS. the default value is 1.0/60 if you don't call this
     director->setAnimationInterval(1.0f / 60);
@@ -99,14 +109,52 @@ bool AppDelegate::applicationDidFinishLaunching() {
     // Set the design resolution
     glview->setDesignResolutionSize(1080, 2080, ResolutionPolicy::FIXED_WIDTH);
 
+    // 设计分辨率固定宽度，按帧缓冲宽度选择不低于屏幕像素密度的最小资源档位
+    auto frameSize = glview->getFrameSize();
+    AssetTierType assetTier = ATT_LARGE;
+    if (frameSize.width <= smallResolutionSize.width) {
+        assetTier = ATT_SMALL;
+    } else if (frameSize.width <= mediumResolutionSize.width) {
+        assetTier = ATT_MEDIUM;
+    }
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32) || (CC_TARGET_PLATFORM == CC_PLATFORM_MAC) || (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    // 设置了CARD_ASSET_TIER时使用指定档位，用于在桌面上对比各档位的纹理内存
+    const char* assetTierName = getenv("CARD_ASSET_TIER");
+    if (assetTierName && assetTierName[0] && !CardResConfig::parseAssetTierName(assetTierName, assetTier)) {
+        CCLOG("AppDelegate: unknown CARD_ASSET_TIER %s", assetTierName);
+    }
+#endif
+    CardResConfig::setAssetTier(assetTier);
+
+    // 档位图片按比例缩小，内容缩放因子让精灵的尺寸（点）与设计分辨率下一致
+    director->setContentScaleFactor(CardResConfig::getAssetTierScale(assetTier));
+
     register_all_packages();
 
-    // 创建游戏场景
-    auto scene = GameScene::createScene();
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32) || (CC_TARGET_PLATFORM == CC_PLATFORM_MAC) || (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    // 设置了CARD_BENCHMARK_OUTPUT时只运行视图基准，写出结果后退出
+    const char* benchmarkOutput = getenv("CARD_BENCHMARK_OUTPUT");
+    if (benchmarkOutput && benchmarkOutput[0]) {
+        ViewBenchmarks::run(benchmarkOutput);
+        director->end();
+        return true;
+    }
+#endif
+
+    // 先进入加载场景，纹理预加载完成后再切换到游戏场景
+    auto scene = LoadingScene::createScene();
 
     // run
     director->runWithScene(scene);
 
+    // 按需渲染：画面静止时降低帧率，触摸、动作开始或模型变化时恢复满帧率
+    FramePacer::startFromEnvironment();
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32) || (CC_TARGET_PLATFORM == CC_PLATFORM_MAC) || (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    // 设置了CARD_SOAK_CSV时由自动对局驱动注入点击，用于长时间的帧耗时与内存测试
+    SoakBot::startFromEnvironment();
+#endif
+
     return true;
 }
 
@@ -0,0 +1,68 @@
+/**
+ * CocosAdapter.h
+ * 核心库类型与引擎类型之间的转换适配层
+ */
+
+#ifndef __COCOS_ADAPTER_H__
+#define __COCOS_ADAPTER_H__
+
+#include "cocos2d.h"
+#include "core/CoreMath.h"
+#include "core/profile/TraceRecorder.h"
+
+/**
+ * 引擎适配类，负责核心数据类型与cocos2d类型的互相转换
+ */
+class CocosAdapter
+{
+public:
+    /**
+     * 核心向量转换为引擎向量
+     * @param v 核心向量
+     * @return 引擎向量
+     */
+    static cocos2d::Vec2 toVec2(const CoreVec2& v) { return cocos2d::Vec2(v.x, v.y); }
+    
+    /**
+     * 引擎向量转换为核心向量
+     * @param v 引擎向量
+     * @return 核心向量
+     */
+    static CoreVec2 fromVec2(const cocos2d::Vec2& v) { return CoreVec2(v.x, v.y); }
+    
+    /**
+     * 按文件创建精灵，剖析构建中纹理尚未缓存且正在追踪时把这次纹理加载记为追踪事件
+     * @param filePath 图片路径
+     * @return 精灵对象，加载失败返回nullptr
+     */
+    static cocos2d::Sprite* createSprite(const std::string& filePath)
+    {
+#if CARD_PROFILING
+        if (TraceRecorder::isEnabled() &&
+            !cocos2d::Director::getInstance()->getTextureCache()->getTextureForKey(filePath)) {
+            TraceScope scope("texture", TraceRecorder::internName(filePath));
+            return cocos2d::Sprite::create(filePath);
+        }
+#endif
+        return cocos2d::Sprite::create(filePath);
+    }
+    
+    /**
+     * 统计纹理缓存中的纹理数与按像素格式估算的显存占用
+     * @param textureCount 输出纹理数
+     * @param kilobytes 输出占用（KB）
+     * @return 是否统计成功
+     */
+    static bool getTextureCacheUsage(int& textureCount, long& kilobytes)
+    {
+        // 引擎只以调试文本的形式提供汇总，末行为 "TextureCache dumpDebugInfo: N textures, for K KB (M MB)"
+        std::string info = cocos2d::Director::getInstance()->getTextureCache()->getCachedTextureInfo();
+        size_t pos = info.rfind("dumpDebugInfo:");
+        textureCount = 0;
+        kilobytes = 0;
+        return pos != std::string::npos &&
+               sscanf(info.c_str() + pos, "dumpDebugInfo: %d textures, for %ld KB", &textureCount, &kilobytes) == 2;
+    }
+};
+
+#endif // __COCOS_ADAPTER_H__
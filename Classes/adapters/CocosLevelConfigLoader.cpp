@@ -0,0 +1,36 @@
+/**
+ * CocosLevelConfigLoader.cpp
+ * 基于引擎文件系统的关卡配置加载适配器实现
+ */
+
+#include "CocosLevelConfigLoader.h"
+
+USING_NS_CC;
+
+LevelConfig* CocosLevelConfigLoader::loadLevelConfig(int levelId)
+{
+    // 构建关卡配置文件路径，从 Resources 目录加载
+    std::string levelFile = StringUtils::format("res/levels/level_%d.json", levelId);
+    //CCLOG("CocosLevelConfigLoader::loadLevelConfig - Trying to load file: %s", levelFile.c_str());
+    
+    // 加载JSON文件内容
+    std::string jsonContent = FileUtils::getInstance()->getStringFromFile(levelFile);
+    if (jsonContent.empty()) {
+        // 如果找不到指定关卡，加载默认关卡
+        levelFile = "res/levels/default_level.json";
+        jsonContent = FileUtils::getInstance()->getStringFromFile(levelFile);
+        
+        // 如果默认关卡也找不到，尝试不同的路径
+        if (jsonContent.empty()) {
+            levelFile = "Resources/res/levels/default_level.json";
+            jsonContent = FileUtils::getInstance()->getStringFromFile(levelFile);
+        }
+        
+        if (jsonContent.empty()) {
+            //CCLOG("CocosLevelConfigLoader::loadLevelConfig - Failed to load level config: %s and default level", levelFile.c_str());
+            return nullptr;
+        }
+    }
+    
+    return LevelConfigLoader::parseFromJson(jsonContent);
+}
@@ -0,0 +1,27 @@
+/**
+ * CocosLevelConfigLoader.h
+ * 基于引擎文件系统的关卡配置加载适配器
+ */
+
+#ifndef __COCOS_LEVEL_CONFIG_LOADER_H__
+#define __COCOS_LEVEL_CONFIG_LOADER_H__
+
+#include "cocos2d.h"
+#include "configs/loaders/LevelConfigLoader.h"
+
+/**
+ * 关卡加载适配类，通过FileUtils搜索路径查找关卡文件，
+ * 解析交给核心库的LevelConfigLoader完成
+ */
+class CocosLevelConfigLoader
+{
+public:
+    /**
+     * 加载关卡配置
+     * @param levelId 关卡ID
+     * @return 关卡配置对象
+     */
+    static LevelConfig* loadLevelConfig(int levelId);
+};
+
+#endif // __COCOS_LEVEL_CONFIG_LOADER_H__
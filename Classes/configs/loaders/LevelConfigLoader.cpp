@@ -1,115 +1,151 @@
-/**
- * LevelConfigLoader.cpp
- * 关卡配置加载器实现
- */
-
-#include "LevelConfigLoader.h"
-#include "json/document.h"
-#include "json/stringbuffer.h"
-
-USING_NS_CC;
-
-LevelConfig* LevelConfigLoader::loadLevelConfig(int levelId)
-{
-    // 构建关卡配置文件路径，从 Resources 目录加载
-    std::string levelFile = StringUtils::format("res/levels/level_%d.json", levelId);
-    //CCLOG("LevelConfigLoader::loadLevelConfig - Trying to load file: %s", levelFile.c_str());
-    
-    // 加载JSON文件内容
-    std::string jsonContent = FileUtils::getInstance()->getStringFromFile(levelFile);
-    if (jsonContent.empty()) {
-        // 如果找不到指定关卡，加载默认关卡
-        //CCLOG("LevelConfigLoader::loadLevelConfig - File not found, trying default level");
-        levelFile = "res/levels/default_level.json";
-        jsonContent = FileUtils::getInstance()->getStringFromFile(levelFile);
-        
-        // 如果默认关卡也找不到，尝试不同的路径
-        if (jsonContent.empty()) {
-            levelFile = "Resources/res/levels/default_level.json";
-            jsonContent = FileUtils::getInstance()->getStringFromFile(levelFile);
-        }
-        
-        if (jsonContent.empty()) {
-            //CCLOG("LevelConfigLoader::loadLevelConfig - Failed to load level config: %s and default level", levelFile.c_str());
-            
-            // 尝试打印资源路径
-            auto searchPaths = FileUtils::getInstance()->getSearchPaths();
-            //CCLOG("Search paths:");
-            for (const auto& path : searchPaths) {
-                //CCLOG("  %s", path.c_str());
-            }
-            
-            return nullptr;
-        }
-        //CCLOG("LevelConfigLoader::loadLevelConfig - Loaded default level successfully");
-    } else {
-        //CCLOG("LevelConfigLoader::loadLevelConfig - Loaded level file successfully");
-    }
-    
-    return parseFromJson(jsonContent);
-}
-
-LevelConfig* LevelConfigLoader::parseFromJson(const std::string& jsonString)
-{
-    rapidjson::Document doc;
-    doc.Parse(jsonString.c_str());
-    
-    if (doc.HasParseError() || !doc.IsObject()) {
-        //CCLOG("Failed to parse level config JSON");
-        return nullptr;
-    }
-    
-    LevelConfig* config = new LevelConfig();
-    
-    // 解析主牌区卡牌配置
-    if (doc.HasMember("Playfield") && doc["Playfield"].IsArray()) {
-        const rapidjson::Value& playfield = doc["Playfield"];
-        std::vector<CardConfig> playfieldCards;
-        
-        for (rapidjson::SizeType i = 0; i < playfield.Size(); i++) {
-            const rapidjson::Value& card = playfield[i];
-            if (card.IsObject() && card.HasMember("CardFace") && card.HasMember("CardSuit") && card.HasMember("Position")) {
-                CardConfig cardConfig;
-                cardConfig.cardFace = card["CardFace"].GetInt();
-                cardConfig.cardSuit = card["CardSuit"].GetInt();
-                
-                if (card["Position"].IsObject() && card["Position"].HasMember("x") && card["Position"].HasMember("y")) {
-                    cardConfig.position.x = card["Position"]["x"].GetFloat();
-                    cardConfig.position.y = card["Position"]["y"].GetFloat();
-                }
-                
-                playfieldCards.push_back(cardConfig);
-            }
-        }
-        
-        config->setPlayfieldCards(playfieldCards);
-    }
-    
-    // 解析备用牌堆卡牌配置
-    if (doc.HasMember("Stack") && doc["Stack"].IsArray()) {
-        const rapidjson::Value& stack = doc["Stack"];
-        std::vector<CardConfig> stackCards;
-        
-        for (rapidjson::SizeType i = 0; i < stack.Size(); i++) {
-            const rapidjson::Value& card = stack[i];
-            if (card.IsObject() && card.HasMember("CardFace") && card.HasMember("CardSuit")) {
-                CardConfig cardConfig;
-                cardConfig.cardFace = card["CardFace"].GetInt();
-                cardConfig.cardSuit = card["CardSuit"].GetInt();
-                
-                // 堆牌位置可能不重要，但仍然处理
-                if (card.HasMember("Position") && card["Position"].IsObject() && 
-                    card["Position"].HasMember("x") && card["Position"].HasMember("y")) {
-                    cardConfig.position.x = card["Position"]["x"].GetFloat();
-                    cardConfig.position.y = card["Position"]["y"].GetFloat();
-                }
-                
-                stackCards.push_back(cardConfig);
-            }
-        }
-        
-        config->setStackCards(stackCards);
-    }
-    
-    return config;
+/**
+ * LevelConfigLoader.cpp
+ * 关卡配置加载器实现
+ */
+
+#include "LevelConfigLoader.h"
+#include "core/generator/DealShuffler.h"
+#include "core/profile/FrameProfiler.h"
+#include "json/document.h"
+#include "json/stringbuffer.h"
+#include <fstream>
+#include <sstream>
+#include <stdlib.h>
+
+/**
+ * 按种子展开关卡，覆盖已解析的主牌区与备用牌堆
+ * @param doc JSON文档，含"Seed"字段
+ * @param config 已解析的关卡配置，提供省略"Template"时的布局
+ * @return 字段无效或展开失败时返回false
+ */
+static bool expandSeededLevel(const rapidjson::Document& doc, LevelConfig* config)
+{
+    // 种子可以写成数字，超过双精度可精确表示的范围时写成字符串
+    const rapidjson::Value& seedValue = doc["Seed"];
+    uint64_t seed = 0;
+    if (seedValue.IsUint64()) {
+        seed = seedValue.GetUint64();
+    } else if (seedValue.IsString()) {
+        seed = strtoull(seedValue.GetString(), nullptr, 0);
+    } else {
+        return false;
+    }
+    
+    LevelTemplate levelTemplate;
+    if (doc.HasMember("Template") && doc["Template"].IsString()) {
+        if (!LevelTemplate::parseSpec(doc["Template"].GetString(), levelTemplate)) {
+            return false;
+        }
+    } else {
+        int stackCount = doc.HasMember("StackCount") && doc["StackCount"].IsInt() ? doc["StackCount"].GetInt() : 0;
+        levelTemplate = LevelTemplate::createFromLevelConfig("", config, stackCount);
+    }
+    
+    DealShuffleParams params;
+    if (doc.HasMember("Shuffle") && (!doc["Shuffle"].IsString() || !DealShuffler::parseMode(doc["Shuffle"].GetString(), params.mode))) {
+        return false;
+    }
+    if (doc.HasMember("Decks") && doc["Decks"].IsInt()) {
+        params.deckCount = doc["Decks"].GetInt();
+    }
+    
+    return DealShuffler::shuffleLevel(levelTemplate, seed, params, *config);
+}
+
+LevelConfig* LevelConfigLoader::loadLevelConfigFromFile(const std::string& filePath)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        return nullptr;
+    }
+    
+    // 读取整个文件内容
+    std::ostringstream content;
+    content << file.rdbuf();
+    
+    std::string jsonContent = content.str();
+    if (jsonContent.empty()) {
+        return nullptr;
+    }
+    
+    return parseFromJson(jsonContent);
+}
+
+LevelConfig* LevelConfigLoader::parseFromJson(const std::string& jsonString)
+{
+    CORE_PROFILE_SCOPE(PS_LEVEL_LOAD);
+    
+    rapidjson::Document doc;
+    doc.Parse(jsonString.c_str());
+    
+    if (doc.HasParseError() || !doc.IsObject()) {
+        //CCLOG("Failed to parse level config JSON");
+        return nullptr;
+    }
+    
+    LevelConfig* config = new LevelConfig();
+    
+    // 种子关卡的主牌区只需要写位置
+    bool seeded = doc.HasMember("Seed");
+    
+    // 解析主牌区卡牌配置
+    if (doc.HasMember("Playfield") && doc["Playfield"].IsArray()) {
+        const rapidjson::Value& playfield = doc["Playfield"];
+        std::vector<CardConfig> playfieldCards;
+        
+        for (rapidjson::SizeType i = 0; i < playfield.Size(); i++) {
+            const rapidjson::Value& card = playfield[i];
+            bool hasFace = card.IsObject() && card.HasMember("CardFace") && card.HasMember("CardSuit");
+            if (card.IsObject() && (hasFace || seeded) && card.HasMember("Position")) {
+                CardConfig cardConfig;
+                if (hasFace) {
+                    cardConfig.cardFace = card["CardFace"].GetInt();
+                    cardConfig.cardSuit = card["CardSuit"].GetInt();
+                }
+                
+                if (card["Position"].IsObject() && card["Position"].HasMember("x") && card["Position"].HasMember("y")) {
+                    cardConfig.position.x = card["Position"]["x"].GetFloat();
+                    cardConfig.position.y = card["Position"]["y"].GetFloat();
+                }
+                
+                playfieldCards.push_back(cardConfig);
+            }
+        }
+        
+        config->setPlayfieldCards(playfieldCards);
+    }
+    
+    // 解析备用牌堆卡牌配置
+    if (doc.HasMember("Stack") && doc["Stack"].IsArray()) {
+        const rapidjson::Value& stack = doc["Stack"];
+        std::vector<CardConfig> stackCards;
+        
+        for (rapidjson::SizeType i = 0; i < stack.Size(); i++) {
+            const rapidjson::Value& card = stack[i];
+            if (card.IsObject() && card.HasMember("CardFace") && card.HasMember("CardSuit")) {
+                CardConfig cardConfig;
+                cardConfig.cardFace = card["CardFace"].GetInt();
+                cardConfig.cardSuit = card["CardSuit"].GetInt();
+                
+                // 堆牌位置可能不重要，但仍然处理
+                if (card.HasMember("Position") && card["Position"].IsObject() && 
+                    card["Position"].HasMember("x") && card["Position"].HasMember("y")) {
+                    cardConfig.position.x = card["Position"]["x"].GetFloat();
+                    cardConfig.position.y = card["Position"]["y"].GetFloat();
+                }
+                
+                stackCards.push_back(cardConfig);
+            }
+        }
+        
+        config->setStackCards(stackCards);
+    }
+    
+    // 种子关卡：此时只用到了上面解析出的位置，牌面在这里生成
+    if (doc.HasMember("Seed") && !expandSeededLevel(doc, config)) {
+        delete config;
+        return nullptr;
+    }
+    
+    return config;
 }
\ No newline at end of file
@@ -1,34 +1,37 @@
-/**
- * LevelConfigLoader.h
- * 关卡配置加载器，负责加载和解析关卡配置文件
- */
-
-#ifndef __LEVEL_CONFIG_LOADER_H__
-#define __LEVEL_CONFIG_LOADER_H__
-
-#include "cocos2d.h"
-#include "../models/LevelConfig.h"
-
-/**
- * 关卡配置加载器类，负责加载关卡配置
- */
-class LevelConfigLoader
-{
-public:
-    /**
-     * 加载关卡配置
-     * @param levelId 关卡ID
-     * @return 关卡配置对象
-     */
-    static LevelConfig* loadLevelConfig(int levelId);
-    
-private:
-    /**
-     * 从JSON文件中解析关卡配置
-     * @param jsonString JSON字符串
-     * @return 关卡配置对象
-     */
-    static LevelConfig* parseFromJson(const std::string& jsonString);
-};
-
-#endif // __LEVEL_CONFIG_LOADER_H__ 
\ No newline at end of file
+/**
+ * LevelConfigLoader.h
+ * 关卡配置加载器，负责加载和解析关卡配置文件
+ */
+
+#ifndef __LEVEL_CONFIG_LOADER_H__
+#define __LEVEL_CONFIG_LOADER_H__
+
+#include <string>
+#include "../models/LevelConfig.h"
+
+/**
+ * 关卡配置加载器类，负责加载关卡配置
+ * 不依赖引擎，按关卡ID查找资源的逻辑见CocosLevelConfigLoader
+ */
+class LevelConfigLoader
+{
+public:
+    /**
+     * 从文件系统路径加载关卡配置
+     * @param filePath 关卡文件路径
+     * @return 关卡配置对象，失败返回nullptr
+     */
+    static LevelConfig* loadLevelConfigFromFile(const std::string& filePath);
+    
+    /**
+     * 从JSON文件中解析关卡配置
+     * 带"Seed"字段的关卡按种子展开（见DealShuffler）："Template"为模板描述串（如grid:3x4:20），
+     * 省略时使用本文件"Playfield"中的位置与"StackCount"（缺省为"Stack"的张数）；
+     * "Shuffle"为发牌方式（deck / uniform / solvable，默认deck），"Decks"为牌副数
+     * @param jsonString JSON字符串
+     * @return 关卡配置对象
+     */
+    static LevelConfig* parseFromJson(const std::string& jsonString);
+};
+
+#endif // __LEVEL_CONFIG_LOADER_H__ 
@@ -0,0 +1,115 @@
+/**
+ * LevelPackLoader.cpp
+ * 二进制关卡包加载器实现
+ */
+
+#include "LevelPackLoader.h"
+#include <fstream>
+#include <sstream>
+#include <string.h>
+
+const char LevelPackLoader::PACK_MAGIC[4] = { 'C', 'L', 'V', 'P' };
+const uint16_t LevelPackLoader::PACK_VERSION;
+
+/**
+ * 顺序读取小端数据，越界后所有读取返回0并标记失败
+ */
+class PackReader
+{
+public:
+    PackReader(const char* data, size_t size) : _data(reinterpret_cast<const uint8_t*>(data)), _size(size), _offset(0), _failed(false) {}
+    
+    uint8_t readUint8()
+    {
+        if (_offset + 1 > _size) {
+            _failed = true;
+            return 0;
+        }
+        return _data[_offset++];
+    }
+    
+    uint16_t readUint16()
+    {
+        uint16_t low = readUint8();
+        uint16_t high = readUint8();
+        return static_cast<uint16_t>(low | (high << 8));
+    }
+    
+    uint32_t readUint32()
+    {
+        uint32_t low = readUint16();
+        uint32_t high = readUint16();
+        return low | (high << 16);
+    }
+    
+    bool failed() const { return _failed; }
+    
+private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _offset;
+    bool _failed;
+};
+
+bool LevelPackLoader::loadFromFile(const std::string& filePath, std::vector<LevelConfig*>& levelConfigs)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    
+    std::ostringstream content;
+    content << file.rdbuf();
+    std::string data = content.str();
+    
+    return parseFromBuffer(data.data(), data.size(), levelConfigs);
+}
+
+bool LevelPackLoader::parseFromBuffer(const char* data, size_t size, std::vector<LevelConfig*>& levelConfigs)
+{
+    if (!data || size < 10 || memcmp(data, PACK_MAGIC, 4) != 0) {
+        return false;
+    }
+    
+    PackReader reader(data + 4, size - 4);
+    if (reader.readUint16() != PACK_VERSION) {
+        return false;
+    }
+    
+    uint32_t levelCount = reader.readUint32();
+    std::vector<LevelConfig*> parsed;
+    
+    for (uint32_t l = 0; l < levelCount && !reader.failed(); l++) {
+        uint16_t playfieldCount = reader.readUint16();
+        uint16_t stackCount = reader.readUint16();
+        
+        std::vector<CardConfig> playfieldCards(playfieldCount);
+        for (auto& card : playfieldCards) {
+            card.cardFace = reader.readUint8();
+            card.cardSuit = reader.readUint8();
+            card.position.x = static_cast<int16_t>(reader.readUint16());
+            card.position.y = static_cast<int16_t>(reader.readUint16());
+        }
+        
+        std::vector<CardConfig> stackCards(stackCount);
+        for (auto& card : stackCards) {
+            card.cardFace = reader.readUint8();
+            card.cardSuit = reader.readUint8();
+        }
+        
+        LevelConfig* config = new LevelConfig();
+        config->setPlayfieldCards(playfieldCards);
+        config->setStackCards(stackCards);
+        parsed.push_back(config);
+    }
+    
+    if (reader.failed()) {
+        for (auto config : parsed) {
+            delete config;
+        }
+        return false;
+    }
+    
+    levelConfigs.insert(levelConfigs.end(), parsed.begin(), parsed.end());
+    return true;
+}
@@ -0,0 +1,47 @@
+/**
+ * LevelPackLoader.h
+ * 二进制关卡包加载器，一个文件保存大量生成的关卡
+ */
+
+#ifndef __LEVEL_PACK_LOADER_H__
+#define __LEVEL_PACK_LOADER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include "../models/LevelConfig.h"
+
+/**
+ * 二进制关卡包加载器类
+ * 格式（小端）：
+ *   "CLVP" 版本(u16) 关卡数(u32)
+ *   每个关卡：主牌区数(u16) 备用牌堆数(u16)
+ *             主牌区卡牌：面值(u8) 花色(u8) x(i16) y(i16)
+ *             备用牌堆卡牌：面值(u8) 花色(u8)
+ */
+class LevelPackLoader
+{
+public:
+    static const char PACK_MAGIC[4];        // 文件标识
+    static const uint16_t PACK_VERSION = 1; // 格式版本
+    
+    /**
+     * 从文件加载关卡包
+     * @param filePath 文件路径
+     * @param levelConfigs 输出的关卡配置，由调用方释放
+     * @return 是否加载成功
+     */
+    static bool loadFromFile(const std::string& filePath, std::vector<LevelConfig*>& levelConfigs);
+    
+    /**
+     * 从内存解析关卡包
+     * @param data 数据
+     * @param size 数据长度
+     * @param levelConfigs 输出的关卡配置，由调用方释放
+     * @return 是否解析成功
+     */
+    static bool parseFromBuffer(const char* data, size_t size, std::vector<LevelConfig*>& levelConfigs);
+};
+
+#endif // __LEVEL_PACK_LOADER_H__
@@ -1,75 +1,155 @@
-/**
- * CardResConfig.cpp
- * 卡牌资源配置实现
- */
-
-#include "CardResConfig.h"
-#include "../../models/CardModel.h"
-
-USING_NS_CC;
-
-std::string CardResConfig::getCardFaceImagePath(CardFaceType face, CardSuitType suit)
-{
-    // 由于资源结构不同，我们实际上在这里不返回组合的图片路径
-    // 而是在CardView中组合基本卡牌、花色和数字
-    return "res/card_general.png";
-}
-
-std::string CardResConfig::getCardBackImagePath()
-{
-    // 卡牌背面图片，如果没有特定的背面图片，可以使用基本卡牌
-    return "res/card_general.png";
-}
-
-std::string CardResConfig::getCardFaceString(CardFaceType face)
-{
-    switch (face) {
-        case CFT_ACE:    return "A";
-        case CFT_TWO:    return "2";
-        case CFT_THREE:  return "3";
-        case CFT_FOUR:   return "4";
-        case CFT_FIVE:   return "5";
-        case CFT_SIX:    return "6";
-        case CFT_SEVEN:  return "7";
-        case CFT_EIGHT:  return "8";
-        case CFT_NINE:   return "9";
-        case CFT_TEN:    return "10";
-        case CFT_JACK:   return "J";
-        case CFT_QUEEN:  return "Q";
-        case CFT_KING:   return "K";
-        default:         return "";
-    }
-}
-
-std::string CardResConfig::getCardSuitString(CardSuitType suit)
-{
-    switch (suit) {
-        case CST_CLUBS:      return "clubs";
-        case CST_DIAMONDS:   return "diamonds";
-        case CST_HEARTS:     return "hearts";
-        case CST_SPADES:     return "spades";
-        default:             return "";
-    }
-}
-
-// 获取花色图片路径
-std::string CardResConfig::getCardSuitImagePath(CardSuitType suit)
-{
-    switch (suit) {
-        case CST_CLUBS:      return "res/suits/clubs.png";
-        case CST_DIAMONDS:   return "res/suits/diamonds.png";
-        case CST_HEARTS:     return "res/suits/hearts.png";
-        case CST_SPADES:     return "res/suits/spades.png";
-        default:             return "";
-    }
-}
-
-// 获取数字图片路径，根据当前文件命名规则修改
-std::string CardResConfig::getCardNumberImagePath(CardFaceType face, bool isRed, bool isSmall)
-{
-    std::string color = isRed ? "red" : "black";
-    std::string size = isSmall ? "small" : "big";
-    std::string faceStr = getCardFaceString(face);
-    
-    return StringUtils::format("res/number/%s_%s_%s.png", size.c_str(), color.c_str(), faceStr.c_str());
-} 
\ No newline at end of file
+/**
+ * CardResConfig.cpp
+ * 卡牌资源配置实现
+ */
+
+#include "CardResConfig.h"
+#include "../../models/CardModel.h"
+
+// 清单由GenerateResourceManifest生成，档位与卡牌枚举的顺序必须与之一致
+static_assert(RESOURCE_TIER_COUNT == ATT_NUM_ASSET_TIER_TYPES, "asset tiers do not match the resource manifest");
+static_assert(sizeof(CARD_SUIT_RESOURCES) / sizeof(CARD_SUIT_RESOURCES[0]) == CST_NUM_CARD_SUIT_TYPES,
+              "suits do not match the resource manifest");
+static_assert(sizeof(CARD_NUMBER_RESOURCES[0][0]) / sizeof(CARD_NUMBER_RESOURCES[0][0][0]) == CFT_NUM_CARD_FACE_TYPES,
+              "faces do not match the resource manifest");
+
+// 当前资源档位
+static AssetTierType s_assetTier = ATT_LARGE;
+
+// 各档位相对设计分辨率的缩放
+static const float ASSET_TIER_SCALES[ATT_NUM_ASSET_TIER_TYPES] = { 0.5f, 0.75f, 1.0f };
+
+// 各档位名称，目录为"res-名称/"
+static const char* const ASSET_TIER_NAMES[ATT_NUM_ASSET_TIER_TYPES] = { "small", "medium", "large" };
+
+void CardResConfig::setAssetTier(AssetTierType tier)
+{
+    if (tier >= ATT_SMALL && tier < ATT_NUM_ASSET_TIER_TYPES) {
+        s_assetTier = tier;
+    }
+}
+
+AssetTierType CardResConfig::getAssetTier()
+{
+    return s_assetTier;
+}
+
+float CardResConfig::getAssetTierScale(AssetTierType tier)
+{
+    return tier >= ATT_SMALL && tier < ATT_NUM_ASSET_TIER_TYPES ? ASSET_TIER_SCALES[tier] : 1.0f;
+}
+
+std::string CardResConfig::getAssetTierName(AssetTierType tier)
+{
+    return tier >= ATT_SMALL && tier < ATT_NUM_ASSET_TIER_TYPES ? ASSET_TIER_NAMES[tier] : "";
+}
+
+bool CardResConfig::parseAssetTierName(const std::string& name, AssetTierType& tier)
+{
+    for (int i = ATT_SMALL; i < ATT_NUM_ASSET_TIER_TYPES; i++) {
+        if (name == ASSET_TIER_NAMES[i]) {
+            tier = static_cast<AssetTierType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string CardResConfig::getAssetTierDirectory(AssetTierType tier)
+{
+    std::string directory = "res-";
+    directory += getAssetTierName(tier);
+    directory += "/";
+    return directory;
+}
+
+const char* CardResConfig::getResourcePath(ResourceId id)
+{
+    return id >= 0 && id < RID_NUM_RESOURCES ? RESOURCE_PATHS[s_assetTier][id] : "";
+}
+
+ResourceId CardResConfig::getCardSuitImageId(CardSuitType suit)
+{
+    return suit >= CST_CLUBS && suit < CST_NUM_CARD_SUIT_TYPES ? CARD_SUIT_RESOURCES[suit] : RID_NUM_RESOURCES;
+}
+
+ResourceId CardResConfig::getCardNumberImageId(CardFaceType face, bool isRed, bool isSmall)
+{
+    return face >= CFT_ACE && face < CFT_NUM_CARD_FACE_TYPES ? CARD_NUMBER_RESOURCES[isSmall][isRed][face]
+                                                             : RID_NUM_RESOURCES;
+}
+
+std::string CardResConfig::getCardFaceImagePath(CardFaceType face, CardSuitType suit)
+{
+    // 由于资源结构不同，我们实际上在这里不返回组合的图片路径
+    // 而是在CardView中组合基本卡牌、花色和数字
+    return getResourcePath(RID_CARD_GENERAL);
+}
+
+std::string CardResConfig::getCardBackImagePath()
+{
+    // 卡牌背面图片，如果没有特定的背面图片，可以使用基本卡牌
+    return getResourcePath(RID_CARD_GENERAL);
+}
+
+std::string CardResConfig::getCardFaceString(CardFaceType face)
+{
+    switch (face) {
+        case CFT_ACE:    return "A";
+        case CFT_TWO:    return "2";
+        case CFT_THREE:  return "3";
+        case CFT_FOUR:   return "4";
+        case CFT_FIVE:   return "5";
+        case CFT_SIX:    return "6";
+        case CFT_SEVEN:  return "7";
+        case CFT_EIGHT:  return "8";
+        case CFT_NINE:   return "9";
+        case CFT_TEN:    return "10";
+        case CFT_JACK:   return "J";
+        case CFT_QUEEN:  return "Q";
+        case CFT_KING:   return "K";
+        default:         return "";
+    }
+}
+
+std::string CardResConfig::getCardSuitString(CardSuitType suit)
+{
+    switch (suit) {
+        case CST_CLUBS:      return "clubs";
+        case CST_DIAMONDS:   return "diamonds";
+        case CST_HEARTS:     return "hearts";
+        case CST_SPADES:     return "spades";
+        default:             return "";
+    }
+}
+
+// 获取花色图片路径
+std::string CardResConfig::getCardSuitImagePath(CardSuitType suit)
+{
+    return getResourcePath(getCardSuitImageId(suit));
+}
+
+// 获取数字图片路径
+std::string CardResConfig::getCardNumberImagePath(CardFaceType face, bool isRed, bool isSmall)
+{
+    return getResourcePath(getCardNumberImageId(face, isRed, isSmall));
+}
+
+std::string CardResConfig::getDeskBackgroundImagePath()
+{
+    return getResourcePath(RID_DESK_SCENE);
+}
+
+std::string CardResConfig::getHandBackgroundImagePath()
+{
+    return getResourcePath(RID_HAND_SCENE);
+}
+
+void CardResConfig::getAllImagePaths(std::vector<std::string>& paths)
+{
+    // 清单中字体之后都是图片，且没有重复项
+    paths.clear();
+    for (int id = RID_FIRST_IMAGE; id < RID_NUM_RESOURCES; id++) {
+        paths.push_back(getResourcePath(static_cast<ResourceId>(id)));
+    }
+}
@@ -1,63 +1,160 @@
-/**
- * CardResConfig.h
- * 卡牌资源配置
- */
-
-#ifndef __CARD_RES_CONFIG_H__
-#define __CARD_RES_CONFIG_H__
-
-#include <string>
-#include "models/CardModel.h"
-
-/**
- * 卡牌资源配置类，管理卡牌的UI资源
- */
-class CardResConfig
-{
-public:
-    /**
-     * 获取卡牌正面图片路径
-     * @param face 卡牌面值
-     * @param suit 卡牌花色
-     * @return 图片路径
-     */
-    static std::string getCardFaceImagePath(CardFaceType face, CardSuitType suit);
-    
-    /**
-     * 获取卡牌背面图片路径
-     * @return 图片路径
-     */
-    static std::string getCardBackImagePath();
-    
-    /**
-     * 获取卡牌面值字符串
-     * @param face 卡牌面值
-     * @return 面值字符串
-     */
-    static std::string getCardFaceString(CardFaceType face);
-    
-    /**
-     * 获取卡牌花色字符串
-     * @param suit 卡牌花色
-     * @return 花色字符串
-     */
-    static std::string getCardSuitString(CardSuitType suit);
-    
-    /**
-     * 获取花色图片路径
-     * @param suit 卡牌花色
-     * @return 图片路径
-     */
-    static std::string getCardSuitImagePath(CardSuitType suit);
-    
-    /**
-     * 获取数字图片路径
-     * @param face 卡牌面值
-     * @param isRed 是否为红色
-     * @param isSmall 是否为小数字
-     * @return 图片路径
-     */
-    static std::string getCardNumberImagePath(CardFaceType face, bool isRed, bool isSmall);
-};
-
+/**
+ * CardResConfig.h
+ * 卡牌资源配置
+ */
+
+#ifndef __CARD_RES_CONFIG_H__
+#define __CARD_RES_CONFIG_H__
+
+#include <string>
+#include <vector>
+#include "models/CardModel.h"
+#include "ResourceManifest.h"
+
+/**
+ * 资源档位，按屏幕分辨率选择，档位越低图片越小
+ */
+enum AssetTierType
+{
+    ATT_SMALL,              // 0.5倍，res-small/
+    ATT_MEDIUM,             // 0.75倍，res-medium/
+    ATT_LARGE,              // 1倍（设计分辨率），res-large/
+    ATT_NUM_ASSET_TIER_TYPES
+};
+
+/**
+ * 卡牌资源配置类，管理卡牌的UI资源
+ * 路径来自构建时生成的ResourceManifest，按资源ID与当前档位查表，不做字符串拼接；
+ * 各档位目录由GenerateAssetTiers从res/离线生成
+ */
+class CardResConfig
+{
+public:
+    /**
+     * 设置资源档位，应在创建任何精灵之前调用
+     * @param tier 资源档位
+     */
+    static void setAssetTier(AssetTierType tier);
+    
+    /**
+     * 获取当前资源档位，默认为ATT_LARGE
+     * @return 资源档位
+     */
+    static AssetTierType getAssetTier();
+    
+    /**
+     * 获取档位相对设计分辨率的缩放，即引擎的内容缩放因子
+     * @param tier 资源档位
+     * @return 缩放
+     */
+    static float getAssetTierScale(AssetTierType tier);
+    
+    /**
+     * 获取档位名称
+     * @param tier 资源档位
+     * @return small、medium或large
+     */
+    static std::string getAssetTierName(AssetTierType tier);
+    
+    /**
+     * 按名称解析档位
+     * @param name 档位名称
+     * @param tier 输出的档位
+     * @return 名称是否有效
+     */
+    static bool parseAssetTierName(const std::string& name, AssetTierType& tier);
+    
+    /**
+     * 获取档位的图片目录
+     * @param tier 资源档位
+     * @return 以"/"结尾的目录，如"res-small/"
+     */
+    static std::string getAssetTierDirectory(AssetTierType tier);
+    
+    /**
+     * 获取资源在当前档位下的路径
+     * @param id 资源ID
+     * @return 路径，ID无效时返回空串
+     */
+    static const char* getResourcePath(ResourceId id);
+    
+    /**
+     * 获取花色图片的资源ID
+     * @param suit 卡牌花色
+     * @return 资源ID，花色无效时返回RID_NUM_RESOURCES
+     */
+    static ResourceId getCardSuitImageId(CardSuitType suit);
+    
+    /**
+     * 获取数字图片的资源ID
+     * @param face 卡牌面值
+     * @param isRed 是否为红色
+     * @param isSmall 是否为小数字
+     * @return 资源ID，面值无效时返回RID_NUM_RESOURCES
+     */
+    static ResourceId getCardNumberImageId(CardFaceType face, bool isRed, bool isSmall);
+    
+    /**
+     * 获取卡牌正面图片路径
+     * @param face 卡牌面值
+     * @param suit 卡牌花色
+     * @return 图片路径
+     */
+    static std::string getCardFaceImagePath(CardFaceType face, CardSuitType suit);
+    
+    /**
+     * 获取卡牌背面图片路径
+     * @return 图片路径
+     */
+    static std::string getCardBackImagePath();
+    
+    /**
+     * 获取卡牌面值字符串
+     * @param face 卡牌面值
+     * @return 面值字符串
+     */
+    static std::string getCardFaceString(CardFaceType face);
+    
+    /**
+     * 获取卡牌花色字符串
+     * @param suit 卡牌花色
+     * @return 花色字符串
+     */
+    static std::string getCardSuitString(CardSuitType suit);
+    
+    /**
+     * 获取花色图片路径
+     * @param suit 卡牌花色
+     * @return 图片路径
+     */
+    static std::string getCardSuitImagePath(CardSuitType suit);
+    
+    /**
+     * 获取数字图片路径
+     * @param face 卡牌面值
+     * @param isRed 是否为红色
+     * @param isSmall 是否为小数字
+     * @return 图片路径
+     */
+    static std::string getCardNumberImagePath(CardFaceType face, bool isRed, bool isSmall);
+    
+    /**
+     * 获取主牌区背景图片路径
+     * @return 图片路径
+     */
+    static std::string getDeskBackgroundImagePath();
+    
+    /**
+     * 获取手牌区背景图片路径
+     * @return 图片路径
+     */
+    static std::string getHandBackgroundImagePath();
+    
+    /**
+     * 列出游戏场景用到的全部图片（卡牌底图、花色、数字与场景背景），不含重复项，供预加载使用
+     * @param paths 输出图片路径（按当前档位解析）
+     */
+    static void getAllImagePaths(std::vector<std::string>& paths);
+};
+
 #endif // __CARD_RES_CONFIG_H__ 
\ No newline at end of file
@@ -1,12 +1,10 @@
-/**
- * LevelConfig.cpp
- * 关卡配置实现
- */
-
-#include "LevelConfig.h"
-
-USING_NS_CC;
-
-LevelConfig::LevelConfig()
-{
+/**
+ * LevelConfig.cpp
+ * 关卡配置实现
+ */
+
+#include "LevelConfig.h"
+
+LevelConfig::LevelConfig()
+{
 } 
\ No newline at end of file
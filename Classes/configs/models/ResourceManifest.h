@@ -0,0 +1,409 @@
+/**
+ * ResourceManifest.h
+ * 资源清单：由GenerateResourceManifest扫描Resources/生成，不要手工修改
+ */
+
+#ifndef __RESOURCE_MANIFEST_H__
+#define __RESOURCE_MANIFEST_H__
+
+#include <stdint.h>
+
+/**
+ * 资源ID，即清单数组的下标
+ */
+enum ResourceId
+{
+    RID_FONT_MARKER_FELT,            // fonts/Marker Felt.ttf
+    RID_CARD_GENERAL,                // card_general.png
+    RID_DESK_SCENE,                  // desk_scene.png
+    RID_HAND_SCENE,                  // hand_scene.png
+    RID_SUIT_CLUBS,                  // suits/clubs.png
+    RID_SUIT_DIAMONDS,               // suits/diamonds.png
+    RID_SUIT_HEARTS,                 // suits/hearts.png
+    RID_SUIT_SPADES,                 // suits/spades.png
+    RID_NUMBER_BIG_BLACK_A,          // number/big_black_A.png
+    RID_NUMBER_BIG_BLACK_2,          // number/big_black_2.png
+    RID_NUMBER_BIG_BLACK_3,          // number/big_black_3.png
+    RID_NUMBER_BIG_BLACK_4,          // number/big_black_4.png
+    RID_NUMBER_BIG_BLACK_5,          // number/big_black_5.png
+    RID_NUMBER_BIG_BLACK_6,          // number/big_black_6.png
+    RID_NUMBER_BIG_BLACK_7,          // number/big_black_7.png
+    RID_NUMBER_BIG_BLACK_8,          // number/big_black_8.png
+    RID_NUMBER_BIG_BLACK_9,          // number/big_black_9.png
+    RID_NUMBER_BIG_BLACK_10,         // number/big_black_10.png
+    RID_NUMBER_BIG_BLACK_J,          // number/big_black_J.png
+    RID_NUMBER_BIG_BLACK_Q,          // number/big_black_Q.png
+    RID_NUMBER_BIG_BLACK_K,          // number/big_black_K.png
+    RID_NUMBER_BIG_RED_A,            // number/big_red_A.png
+    RID_NUMBER_BIG_RED_2,            // number/big_red_2.png
+    RID_NUMBER_BIG_RED_3,            // number/big_red_3.png
+    RID_NUMBER_BIG_RED_4,            // number/big_red_4.png
+    RID_NUMBER_BIG_RED_5,            // number/big_red_5.png
+    RID_NUMBER_BIG_RED_6,            // number/big_red_6.png
+    RID_NUMBER_BIG_RED_7,            // number/big_red_7.png
+    RID_NUMBER_BIG_RED_8,            // number/big_red_8.png
+    RID_NUMBER_BIG_RED_9,            // number/big_red_9.png
+    RID_NUMBER_BIG_RED_10,           // number/big_red_10.png
+    RID_NUMBER_BIG_RED_J,            // number/big_red_J.png
+    RID_NUMBER_BIG_RED_Q,            // number/big_red_Q.png
+    RID_NUMBER_BIG_RED_K,            // number/big_red_K.png
+    RID_NUMBER_SMALL_BLACK_A,        // number/small_black_A.png
+    RID_NUMBER_SMALL_BLACK_2,        // number/small_black_2.png
+    RID_NUMBER_SMALL_BLACK_3,        // number/small_black_3.png
+    RID_NUMBER_SMALL_BLACK_4,        // number/small_black_4.png
+    RID_NUMBER_SMALL_BLACK_5,        // number/small_black_5.png
+    RID_NUMBER_SMALL_BLACK_6,        // number/small_black_6.png
+    RID_NUMBER_SMALL_BLACK_7,        // number/small_black_7.png
+    RID_NUMBER_SMALL_BLACK_8,        // number/small_black_8.png
+    RID_NUMBER_SMALL_BLACK_9,        // number/small_black_9.png
+    RID_NUMBER_SMALL_BLACK_10,       // number/small_black_10.png
+    RID_NUMBER_SMALL_BLACK_J,        // number/small_black_J.png
+    RID_NUMBER_SMALL_BLACK_Q,        // number/small_black_Q.png
+    RID_NUMBER_SMALL_BLACK_K,        // number/small_black_K.png
+    RID_NUMBER_SMALL_RED_A,          // number/small_red_A.png
+    RID_NUMBER_SMALL_RED_2,          // number/small_red_2.png
+    RID_NUMBER_SMALL_RED_3,          // number/small_red_3.png
+    RID_NUMBER_SMALL_RED_4,          // number/small_red_4.png
+    RID_NUMBER_SMALL_RED_5,          // number/small_red_5.png
+    RID_NUMBER_SMALL_RED_6,          // number/small_red_6.png
+    RID_NUMBER_SMALL_RED_7,          // number/small_red_7.png
+    RID_NUMBER_SMALL_RED_8,          // number/small_red_8.png
+    RID_NUMBER_SMALL_RED_9,          // number/small_red_9.png
+    RID_NUMBER_SMALL_RED_10,         // number/small_red_10.png
+    RID_NUMBER_SMALL_RED_J,          // number/small_red_J.png
+    RID_NUMBER_SMALL_RED_Q,          // number/small_red_Q.png
+    RID_NUMBER_SMALL_RED_K,          // number/small_red_K.png
+    RID_NUM_RESOURCES
+};
+
+// 第一张按档位存放的图片，此前的资源（字体）不分档位
+const ResourceId RID_FIRST_IMAGE = RID_CARD_GENERAL;
+
+// 档位数，顺序与AssetTierType一致
+const int RESOURCE_TIER_COUNT = 3;
+
+/**
+ * 清单项
+ */
+struct ResourceEntry
+{
+    uint32_t hash;          // 名称的FNV-1a哈希，跨平台稳定，可在日志与持久化数据中代替名称
+    const char* name;       // 名称，图片相对档位目录，其余相对Resources/
+};
+
+constexpr ResourceEntry RESOURCE_ENTRIES[RID_NUM_RESOURCES] = {
+    { 0xdbca4bc5u, "fonts/Marker Felt.ttf" },
+    { 0xf13a3b2du, "card_general.png" },
+    { 0xbd47a0d2u, "desk_scene.png" },
+    { 0x59eb9c7au, "hand_scene.png" },
+    { 0x0c24f8eeu, "suits/clubs.png" },
+    { 0x6c9e9bd2u, "suits/diamonds.png" },
+    { 0xd31d6ae6u, "suits/hearts.png" },
+    { 0xc5d12de5u, "suits/spades.png" },
+    { 0x67e74298u, "number/big_black_A.png" },
+    { 0x0e69f2a1u, "number/big_black_2.png" },
+    { 0xf7f076eeu, "number/big_black_3.png" },
+    { 0xaec77e87u, "number/big_black_4.png" },
+    { 0xe2d8a574u, "number/big_black_5.png" },
+    { 0x7fc3944du, "number/big_black_6.png" },
+    { 0x20034f9au, "number/big_black_7.png" },
+    { 0x448c2123u, "number/big_black_8.png" },
+    { 0x2dba0d30u, "number/big_black_9.png" },
+    { 0xbbbbad0eu, "number/big_black_10.png" },
+    { 0xc57e40f9u, "number/big_black_J.png" },
+    { 0x36251de8u, "number/big_black_Q.png" },
+    { 0xaefbdee6u, "number/big_black_K.png" },
+    { 0x17680f2cu, "number/big_red_A.png" },
+    { 0x14ba3a35u, "number/big_red_2.png" },
+    { 0x1461da02u, "number/big_red_3.png" },
+    { 0x18300063u, "number/big_red_4.png" },
+    { 0x1aaaa170u, "number/big_red_5.png" },
+    { 0x6c7b1569u, "number/big_red_6.png" },
+    { 0x6c726716u, "number/big_red_7.png" },
+    { 0x7ff0f4c7u, "number/big_red_8.png" },
+    { 0xb67c84b4u, "number/big_red_9.png" },
+    { 0xd00e9e1au, "number/big_red_10.png" },
+    { 0x443351ddu, "number/big_red_J.png" },
+    { 0xe5a4577cu, "number/big_red_Q.png" },
+    { 0xe19e78eau, "number/big_red_K.png" },
+    { 0x53f423f1u, "number/small_black_A.png" },
+    { 0x58235a48u, "number/small_black_2.png" },
+    { 0x55b3329bu, "number/small_black_3.png" },
+    { 0x3b62721au, "number/small_black_4.png" },
+    { 0x9b22b6cdu, "number/small_black_5.png" },
+    { 0xfe37c7f4u, "number/small_black_6.png" },
+    { 0xca26a107u, "number/small_black_7.png" },
+    { 0xb6a81356u, "number/small_black_8.png" },
+    { 0x9d659fa9u, "number/small_black_9.png" },
+    { 0x1f132139u, "number/small_black_10.png" },
+    { 0x8d305740u, "number/small_black_J.png" },
+    { 0x23286841u, "number/small_black_Q.png" },
+    { 0xa30a6f33u, "number/small_black_K.png" },
+    { 0xf27537b1u, "number/small_red_A.png" },
+    { 0x30fd2d88u, "number/small_red_2.png" },
+    { 0x3105dbdbu, "number/small_red_3.png" },
+    { 0x2d88fa5au, "number/small_red_4.png" },
+    { 0x8fc3a80du, "number/small_red_5.png" },
+    { 0xd98c0434u, "number/small_red_6.png" },
+    { 0xa3007447u, "number/small_red_7.png" },
+    { 0x8f81e696u, "number/small_red_8.png" },
+    { 0x8f8a94e9u, "number/small_red_9.png" },
+    { 0x27dbeff9u, "number/small_red_10.png" },
+    { 0x14df1f00u, "number/small_red_J.png" },
+    { 0xa85cc701u, "number/small_red_Q.png" },
+    { 0x2ab936f3u, "number/small_red_K.png" },
+};
+
+// 各档位下的完整路径，按[档位][资源ID]索引
+constexpr const char* RESOURCE_PATHS[RESOURCE_TIER_COUNT][RID_NUM_RESOURCES] = {
+    {
+        "fonts/Marker Felt.ttf",
+        "res-small/card_general.png",
+        "res-small/desk_scene.png",
+        "res-small/hand_scene.png",
+        "res-small/suits/clubs.png",
+        "res-small/suits/diamonds.png",
+        "res-small/suits/hearts.png",
+        "res-small/suits/spades.png",
+        "res-small/number/big_black_A.png",
+        "res-small/number/big_black_2.png",
+        "res-small/number/big_black_3.png",
+        "res-small/number/big_black_4.png",
+        "res-small/number/big_black_5.png",
+        "res-small/number/big_black_6.png",
+        "res-small/number/big_black_7.png",
+        "res-small/number/big_black_8.png",
+        "res-small/number/big_black_9.png",
+        "res-small/number/big_black_10.png",
+        "res-small/number/big_black_J.png",
+        "res-small/number/big_black_Q.png",
+        "res-small/number/big_black_K.png",
+        "res-small/number/big_red_A.png",
+        "res-small/number/big_red_2.png",
+        "res-small/number/big_red_3.png",
+        "res-small/number/big_red_4.png",
+        "res-small/number/big_red_5.png",
+        "res-small/number/big_red_6.png",
+        "res-small/number/big_red_7.png",
+        "res-small/number/big_red_8.png",
+        "res-small/number/big_red_9.png",
+        "res-small/number/big_red_10.png",
+        "res-small/number/big_red_J.png",
+        "res-small/number/big_red_Q.png",
+        "res-small/number/big_red_K.png",
+        "res-small/number/small_black_A.png",
+        "res-small/number/small_black_2.png",
+        "res-small/number/small_black_3.png",
+        "res-small/number/small_black_4.png",
+        "res-small/number/small_black_5.png",
+        "res-small/number/small_black_6.png",
+        "res-small/number/small_black_7.png",
+        "res-small/number/small_black_8.png",
+        "res-small/number/small_black_9.png",
+        "res-small/number/small_black_10.png",
+        "res-small/number/small_black_J.png",
+        "res-small/number/small_black_Q.png",
+        "res-small/number/small_black_K.png",
+        "res-small/number/small_red_A.png",
+        "res-small/number/small_red_2.png",
+        "res-small/number/small_red_3.png",
+        "res-small/number/small_red_4.png",
+        "res-small/number/small_red_5.png",
+        "res-small/number/small_red_6.png",
+        "res-small/number/small_red_7.png",
+        "res-small/number/small_red_8.png",
+        "res-small/number/small_red_9.png",
+        "res-small/number/small_red_10.png",
+        "res-small/number/small_red_J.png",
+        "res-small/number/small_red_Q.png",
+        "res-small/number/small_red_K.png",
+    },
+    {
+        "fonts/Marker Felt.ttf",
+        "res-medium/card_general.png",
+        "res-medium/desk_scene.png",
+        "res-medium/hand_scene.png",
+        "res-medium/suits/clubs.png",
+        "res-medium/suits/diamonds.png",
+        "res-medium/suits/hearts.png",
+        "res-medium/suits/spades.png",
+        "res-medium/number/big_black_A.png",
+        "res-medium/number/big_black_2.png",
+        "res-medium/number/big_black_3.png",
+        "res-medium/number/big_black_4.png",
+        "res-medium/number/big_black_5.png",
+        "res-medium/number/big_black_6.png",
+        "res-medium/number/big_black_7.png",
+        "res-medium/number/big_black_8.png",
+        "res-medium/number/big_black_9.png",
+        "res-medium/number/big_black_10.png",
+        "res-medium/number/big_black_J.png",
+        "res-medium/number/big_black_Q.png",
+        "res-medium/number/big_black_K.png",
+        "res-medium/number/big_red_A.png",
+        "res-medium/number/big_red_2.png",
+        "res-medium/number/big_red_3.png",
+        "res-medium/number/big_red_4.png",
+        "res-medium/number/big_red_5.png",
+        "res-medium/number/big_red_6.png",
+        "res-medium/number/big_red_7.png",
+        "res-medium/number/big_red_8.png",
+        "res-medium/number/big_red_9.png",
+        "res-medium/number/big_red_10.png",
+        "res-medium/number/big_red_J.png",
+        "res-medium/number/big_red_Q.png",
+        "res-medium/number/big_red_K.png",
+        "res-medium/number/small_black_A.png",
+        "res-medium/number/small_black_2.png",
+        "res-medium/number/small_black_3.png",
+        "res-medium/number/small_black_4.png",
+        "res-medium/number/small_black_5.png",
+        "res-medium/number/small_black_6.png",
+        "res-medium/number/small_black_7.png",
+        "res-medium/number/small_black_8.png",
+        "res-medium/number/small_black_9.png",
+        "res-medium/number/small_black_10.png",
+        "res-medium/number/small_black_J.png",
+        "res-medium/number/small_black_Q.png",
+        "res-medium/number/small_black_K.png",
+        "res-medium/number/small_red_A.png",
+        "res-medium/number/small_red_2.png",
+        "res-medium/number/small_red_3.png",
+        "res-medium/number/small_red_4.png",
+        "res-medium/number/small_red_5.png",
+        "res-medium/number/small_red_6.png",
+        "res-medium/number/small_red_7.png",
+        "res-medium/number/small_red_8.png",
+        "res-medium/number/small_red_9.png",
+        "res-medium/number/small_red_10.png",
+        "res-medium/number/small_red_J.png",
+        "res-medium/number/small_red_Q.png",
+        "res-medium/number/small_red_K.png",
+    },
+    {
+        "fonts/Marker Felt.ttf",
+        "res-large/card_general.png",
+        "res-large/desk_scene.png",
+        "res-large/hand_scene.png",
+        "res-large/suits/clubs.png",
+        "res-large/suits/diamonds.png",
+        "res-large/suits/hearts.png",
+        "res-large/suits/spades.png",
+        "res-large/number/big_black_A.png",
+        "res-large/number/big_black_2.png",
+        "res-large/number/big_black_3.png",
+        "res-large/number/big_black_4.png",
+        "res-large/number/big_black_5.png",
+        "res-large/number/big_black_6.png",
+        "res-large/number/big_black_7.png",
+        "res-large/number/big_black_8.png",
+        "res-large/number/big_black_9.png",
+        "res-large/number/big_black_10.png",
+        "res-large/number/big_black_J.png",
+        "res-large/number/big_black_Q.png",
+        "res-large/number/big_black_K.png",
+        "res-large/number/big_red_A.png",
+        "res-large/number/big_red_2.png",
+        "res-large/number/big_red_3.png",
+        "res-large/number/big_red_4.png",
+        "res-large/number/big_red_5.png",
+        "res-large/number/big_red_6.png",
+        "res-large/number/big_red_7.png",
+        "res-large/number/big_red_8.png",
+        "res-large/number/big_red_9.png",
+        "res-large/number/big_red_10.png",
+        "res-large/number/big_red_J.png",
+        "res-large/number/big_red_Q.png",
+        "res-large/number/big_red_K.png",
+        "res-large/number/small_black_A.png",
+        "res-large/number/small_black_2.png",
+        "res-large/number/small_black_3.png",
+        "res-large/number/small_black_4.png",
+        "res-large/number/small_black_5.png",
+        "res-large/number/small_black_6.png",
+        "res-large/number/small_black_7.png",
+        "res-large/number/small_black_8.png",
+        "res-large/number/small_black_9.png",
+        "res-large/number/small_black_10.png",
+        "res-large/number/small_black_J.png",
+        "res-large/number/small_black_Q.png",
+        "res-large/number/small_black_K.png",
+        "res-large/number/small_red_A.png",
+        "res-large/number/small_red_2.png",
+        "res-large/number/small_red_3.png",
+        "res-large/number/small_red_4.png",
+        "res-large/number/small_red_5.png",
+        "res-large/number/small_red_6.png",
+        "res-large/number/small_red_7.png",
+        "res-large/number/small_red_8.png",
+        "res-large/number/small_red_9.png",
+        "res-large/number/small_red_10.png",
+        "res-large/number/small_red_J.png",
+        "res-large/number/small_red_Q.png",
+        "res-large/number/small_red_K.png",
+    },
+};
+
+// 花色图片，按CardSuitType索引
+constexpr ResourceId CARD_SUIT_RESOURCES[4] = {
+    RID_SUIT_CLUBS,
+    RID_SUIT_DIAMONDS,
+    RID_SUIT_HEARTS,
+    RID_SUIT_SPADES,
+};
+
+// 数字图片，按[是否小数字][是否红色][CardFaceType]索引
+constexpr ResourceId CARD_NUMBER_RESOURCES[2][2][13] = {
+    {
+        {
+            RID_NUMBER_BIG_BLACK_A, RID_NUMBER_BIG_BLACK_2, RID_NUMBER_BIG_BLACK_3, RID_NUMBER_BIG_BLACK_4,
+            RID_NUMBER_BIG_BLACK_5, RID_NUMBER_BIG_BLACK_6, RID_NUMBER_BIG_BLACK_7, RID_NUMBER_BIG_BLACK_8,
+            RID_NUMBER_BIG_BLACK_9, RID_NUMBER_BIG_BLACK_10, RID_NUMBER_BIG_BLACK_J, RID_NUMBER_BIG_BLACK_Q,
+            RID_NUMBER_BIG_BLACK_K,
+        },
+        {
+            RID_NUMBER_BIG_RED_A, RID_NUMBER_BIG_RED_2, RID_NUMBER_BIG_RED_3, RID_NUMBER_BIG_RED_4,
+            RID_NUMBER_BIG_RED_5, RID_NUMBER_BIG_RED_6, RID_NUMBER_BIG_RED_7, RID_NUMBER_BIG_RED_8,
+            RID_NUMBER_BIG_RED_9, RID_NUMBER_BIG_RED_10, RID_NUMBER_BIG_RED_J, RID_NUMBER_BIG_RED_Q,
+            RID_NUMBER_BIG_RED_K,
+        },
+    },
+    {
+        {
+            RID_NUMBER_SMALL_BLACK_A, RID_NUMBER_SMALL_BLACK_2, RID_NUMBER_SMALL_BLACK_3, RID_NUMBER_SMALL_BLACK_4,
+            RID_NUMBER_SMALL_BLACK_5, RID_NUMBER_SMALL_BLACK_6, RID_NUMBER_SMALL_BLACK_7, RID_NUMBER_SMALL_BLACK_8,
+            RID_NUMBER_SMALL_BLACK_9, RID_NUMBER_SMALL_BLACK_10, RID_NUMBER_SMALL_BLACK_J, RID_NUMBER_SMALL_BLACK_Q,
+            RID_NUMBER_SMALL_BLACK_K,
+        },
+        {
+            RID_NUMBER_SMALL_RED_A, RID_NUMBER_SMALL_RED_2, RID_NUMBER_SMALL_RED_3, RID_NUMBER_SMALL_RED_4,
+            RID_NUMBER_SMALL_RED_5, RID_NUMBER_SMALL_RED_6, RID_NUMBER_SMALL_RED_7, RID_NUMBER_SMALL_RED_8,
+            RID_NUMBER_SMALL_RED_9, RID_NUMBER_SMALL_RED_10, RID_NUMBER_SMALL_RED_J, RID_NUMBER_SMALL_RED_Q,
+            RID_NUMBER_SMALL_RED_K,
+        },
+    },
+};
+
+/**
+ * 资源名称的FNV-1a哈希，可在编译期计算
+ * @param name 资源名称
+ * @return 哈希
+ */
+constexpr uint32_t hashResourceName(const char* name, uint32_t hash = 2166136261u)
+{
+    return *name ? hashResourceName(name + 1, (hash ^ static_cast<uint8_t>(*name)) * 16777619u) : hash;
+}
+
+/**
+ * 校验清单中的哈希与hashResourceName一致
+ */
+constexpr bool checkResourceHashes(int index = 0)
+{
+    return index == RID_NUM_RESOURCES ||
+           (RESOURCE_ENTRIES[index].hash == hashResourceName(RESOURCE_ENTRIES[index].name) &&
+            checkResourceHashes(index + 1));
+}
+
+static_assert(checkResourceHashes(), "resource manifest hashes are stale, rerun GenerateResourceManifest");
+
+#endif // __RESOURCE_MANIFEST_H__
@@ -0,0 +1,231 @@
+/**
+ * FramePacer.cpp
+ * 按需渲染实现
+ */
+
+#include "FramePacer.h"
+#include "../core/profile/FrameProfiler.h"
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+USING_NS_CC;
+
+// 触摸监听的固定优先级，早于浮层（-1）与场景中的监听器
+static const int PACER_TOUCH_PRIORITY = -2;
+
+// 运行中的控制对象
+static FramePacer* s_instance = nullptr;
+
+/**
+ * 读取浮点环境变量
+ */
+static float getEnvFloat(const char* name, float defaultValue)
+{
+    const char* value = getenv(name);
+    return value && value[0] ? static_cast<float>(atof(value)) : defaultValue;
+}
+
+FramePacer* FramePacer::start(const FramePacerOptions& options)
+{
+    if (s_instance) {
+        return s_instance;
+    }
+    
+    // 调度器不持有非节点目标的引用，创建时的引用保留到程序结束
+    s_instance = new (std::nothrow) FramePacer();
+    if (!s_instance) {
+        return nullptr;
+    }
+    s_instance->init(options);
+    Director::getInstance()->getScheduler()->scheduleUpdate(s_instance, 0, false);
+    return s_instance;
+}
+
+FramePacer* FramePacer::startFromEnvironment()
+{
+    FramePacerOptions options;
+    const char* pacing = getenv("CARD_FRAME_PACING");
+    if (pacing && strcmp(pacing, "off") == 0) {
+        options.enabled = false;
+    }
+    float idleFps = getEnvFloat("CARD_IDLE_FPS", 0.0f);
+    if (idleFps > 0.0f) {
+        options.idleInterval = 1.0f / idleFps;
+    }
+    options.reportInterval = getEnvFloat("CARD_PACING_REPORT_SECONDS", options.reportInterval);
+    return start(options);
+}
+
+void FramePacer::wake()
+{
+    if (!s_instance) {
+        return;
+    }
+    
+    // 立即恢复帧率，下一帧不用等满一个空闲间隔
+    s_instance->_woken = true;
+    if (s_instance->_idle) {
+        s_instance->setIdle(false);
+    }
+}
+
+bool FramePacer::isIdle()
+{
+    return s_instance && s_instance->_idle;
+}
+
+uint64_t FramePacer::getProcessCpuNanos()
+{
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_WIN32)
+    FILETIME creationTime;
+    FILETIME exitTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        return 0;
+    }
+    // FILETIME以100纳秒为单位
+    uint64_t kernel = (static_cast<uint64_t>(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+    uint64_t user = (static_cast<uint64_t>(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+    return (kernel + user) * 100;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    uint64_t micros = static_cast<uint64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000 +
+                      usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+    return micros * 1000;
+#endif
+}
+
+FramePacer::FramePacer()
+    : _touchListener(nullptr)
+    , _touchesDown(0)
+    , _woken(false)
+    , _idle(false)
+    , _quietSeconds(0.0f)
+    , _sampleNanos(0)
+    , _sampleCpuNanos(0)
+    , _reportNanos(0)
+{
+    for (int i = 0; i < 2; i++) {
+        _stateNanos[i] = 0;
+        _stateCpuNanos[i] = 0;
+        _stateFrames[i] = 0;
+    }
+}
+
+FramePacer::~FramePacer()
+{
+    if (_touchListener) {
+        Director::getInstance()->getEventDispatcher()->removeEventListener(_touchListener);
+    }
+}
+
+void FramePacer::init(const FramePacerOptions& options)
+{
+    _options = options;
+    _sampleNanos = FrameProfiler::nowNanos();
+    _sampleCpuNanos = getProcessCpuNanos();
+    _reportNanos = _sampleNanos;
+    
+    // 只观察触摸，不吞掉，返回true才能收到抬起事件
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(false);
+    _touchListener->onTouchBegan = [this](Touch*, Event*) {
+        _touchesDown++;
+        wake();
+        return true;
+    };
+    _touchListener->onTouchMoved = [this](Touch*, Event*) {
+        wake();
+    };
+    _touchListener->onTouchEnded = [this](Touch*, Event*) {
+        _touchesDown = std::max(0, _touchesDown - 1);
+        wake();
+    };
+    _touchListener->onTouchCancelled = _touchListener->onTouchEnded;
+    Director::getInstance()->getEventDispatcher()->addEventListenerWithFixedPriority(_touchListener,
+                                                                                      PACER_TOUCH_PRIORITY);
+    
+    Director::getInstance()->setAnimationInterval(_options.activeInterval);
+}
+
+void FramePacer::update(float dt)
+{
+    _stateFrames[_idle ? 1 : 0]++;
+    
+    // 动作管理器在系统优先级上先于本更新运行，这里看到的是本帧之后仍在运行的动作
+    Director* director = Director::getInstance();
+    bool active = _woken || _touchesDown > 0 || director->getActionManager()->getNumberOfRunningActions() > 0;
+    _woken = false;
+    
+    if (active) {
+        _quietSeconds = 0.0f;
+        if (_idle) {
+            setIdle(false);
+        }
+    } else if (!_idle) {
+        _quietSeconds += dt;
+        if (_quietSeconds >= _options.idleDelay) {
+            setIdle(true);
+        }
+    }
+    
+    if (_options.reportInterval > 0.0f &&
+        FrameProfiler::nowNanos() - _reportNanos >= static_cast<uint64_t>(_options.reportInterval * 1e9)) {
+        writeReport();
+    }
+}
+
+void FramePacer::setIdle(bool idle)
+{
+    sample();
+    _idle = idle;
+    _quietSeconds = 0.0f;
+    
+    // 关闭时仍区分空闲与活动，只是不改帧率，统计出的空闲CPU时间即固定帧率下的基线
+    if (_options.enabled) {
+        Director::getInstance()->setAnimationInterval(idle ? _options.idleInterval : _options.activeInterval);
+    }
+}
+
+void FramePacer::sample()
+{
+    uint64_t now = FrameProfiler::nowNanos();
+    uint64_t cpu = getProcessCpuNanos();
+    int state = _idle ? 1 : 0;
+    _stateNanos[state] += now - _sampleNanos;
+    _stateCpuNanos[state] += cpu - _sampleCpuNanos;
+    _sampleNanos = now;
+    _sampleCpuNanos = cpu;
+}
+
+void FramePacer::writeReport()
+{
+    sample();
+    _reportNanos = _sampleNanos;
+    
+    // 每个空闲分钟的CPU时间：空闲状态下的CPU时间按空闲时长折算到60秒
+    double idleSeconds = _stateNanos[1] / 1e9;
+    double activeSeconds = _stateNanos[0] / 1e9;
+    double idleCpuPerMinute = idleSeconds > 0.0 ? _stateCpuNanos[1] / 1e6 / idleSeconds * 60.0 : 0.0;
+    // 用log而不是CCLOG，发布版本（COCOS2D_DEBUG为0）也要输出，是否输出只由reportInterval决定
+    log("FramePacer: %s, idle %.1f s (%d frames, %.1f ms CPU per idle minute), "
+        "active %.1f s (%d frames, %.1f ms CPU)", _options.enabled ? "on demand" : "fixed rate", idleSeconds,
+        _stateFrames[1], idleCpuPerMinute, activeSeconds, _stateFrames[0], _stateCpuNanos[0] / 1e6);
+    
+    for (int i = 0; i < 2; i++) {
+        _stateNanos[i] = 0;
+        _stateCpuNanos[i] = 0;
+        _stateFrames[i] = 0;
+    }
+}
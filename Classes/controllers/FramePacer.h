@@ -0,0 +1,120 @@
+/**
+ * FramePacer.h
+ * 按需渲染：画面静止时降低导演的帧率，有触摸、动作或模型变化时恢复满帧率
+ */
+
+#ifndef __FRAME_PACER_H__
+#define __FRAME_PACER_H__
+
+#include "cocos2d.h"
+
+/**
+ * 按需渲染参数
+ */
+struct FramePacerOptions
+{
+    float activeInterval;       // 有活动时的帧间隔（秒）
+    float idleInterval;         // 空闲时的帧间隔（秒）
+    float idleDelay;            // 连续多久没有活动后降低帧率（秒）
+    float reportInterval;       // 两次统计日志之间的间隔（秒），不大于0时不输出（默认）
+    bool enabled;               // 为false时保持固定帧率，只统计空闲时的CPU时间，用作对比基线
+    
+    FramePacerOptions()
+        : activeInterval(1.0f / 60)
+        , idleInterval(1.0f / 5)
+        , idleDelay(0.5f)
+        , reportInterval(0.0f)
+        , enabled(true)
+    {}
+};
+
+/**
+ * 按需渲染控制
+ * 挂在导演的调度器上，不随场景切换销毁。每帧检查动作管理器中是否有运行的动作、是否有按住的触摸、
+ * 是否有人调用了wake（模型变化、等待后台结果），都没有且持续idleDelay后把帧间隔调到idleInterval；
+ * 触摸开始或wake时立即恢复activeInterval，动作在下一帧被检测到。
+ * 空闲时每一帧仍完整更新和绘制，只是次数变少；需要按帧推进的分析任务在得出结论前应持续调用wake。
+ * 分别累计空闲与活动状态下的时长、帧数和进程CPU时间，每隔reportInterval输出每个空闲分钟的CPU时间
+ */
+class FramePacer : public cocos2d::Ref
+{
+public:
+    /**
+     * 创建并开始运行，重复调用时返回已有的对象
+     * @param options 运行参数
+     * @return 控制对象（运行到程序结束）
+     */
+    static FramePacer* start(const FramePacerOptions& options);
+    
+    /**
+     * 按环境变量开始运行：CARD_FRAME_PACING=off时保持固定帧率（只统计），
+     * CARD_IDLE_FPS覆盖空闲帧率，设置CARD_PACING_REPORT_SECONDS时才输出统计日志（调试与发布版本都输出）
+     * @return 控制对象
+     */
+    static FramePacer* startFromEnvironment();
+    
+    /**
+     * 请求满帧率：模型变化或等待后台任务结果时调用，未运行时不做任何事
+     */
+    static void wake();
+    
+    /**
+     * 当前是否处于空闲状态
+     * @return 未运行时返回false
+     */
+    static bool isIdle();
+    
+    /**
+     * 获取进程的CPU时间（用户态与内核态之和）
+     * @return 纳秒，平台不支持时返回0
+     */
+    static uint64_t getProcessCpuNanos();
+    
+    /**
+     * 每帧更新，由调度器调用
+     * @param dt 帧间隔（秒）
+     */
+    void update(float dt);
+    
+private:
+    FramePacer();
+    ~FramePacer();
+    
+    /**
+     * 初始化，注册触摸监听
+     * @param options 运行参数
+     */
+    void init(const FramePacerOptions& options);
+    
+    /**
+     * 切换空闲/活动状态并调整导演的帧间隔
+     * @param idle 是否空闲
+     */
+    void setIdle(bool idle);
+    
+    /**
+     * 把上次采样以来的时长与CPU时间计入当前状态
+     */
+    void sample();
+    
+    /**
+     * 输出一行统计并清空累计值
+     */
+    void writeReport();
+    
+    FramePacerOptions _options;                 // 运行参数
+    cocos2d::EventListenerTouchOneByOne* _touchListener; // 触摸监听，最先收到全部触摸且不吞掉
+    int _touchesDown;                           // 按住的触摸数
+    bool _woken;                                // 本帧是否有人请求满帧率
+    bool _idle;                                 // 是否处于空闲状态
+    float _quietSeconds;                        // 连续没有活动的时长（秒）
+    
+    uint64_t _sampleNanos;                      // 上次采样的时刻
+    uint64_t _sampleCpuNanos;                   // 上次采样时的进程CPU时间
+    uint64_t _reportNanos;                      // 上次输出统计的时刻
+    uint64_t _stateNanos[2];                    // 活动/空闲状态的累计时长，下标为是否空闲
+    uint64_t _stateCpuNanos[2];                 // 活动/空闲状态的累计CPU时间
+    int _stateFrames[2];                        // 活动/空闲状态的帧数
+};
+
+#endif // __FRAME_PACER_H__
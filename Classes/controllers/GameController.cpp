@@ -1,251 +1,470 @@
-/**
- * GameController.cpp
- * 游戏控制器实现
- */
-
-#include "GameController.h"
-#include "../configs/loaders/LevelConfigLoader.h"
-#include "../services/GameModelFromLevelGenerator.h"
-
-USING_NS_CC;
-
-GameController::GameController()
-    : _gameModel(nullptr)
-    , _gameView(nullptr)
-    , _undoManager(nullptr)
-{
-}
-
-GameController::~GameController()
-{
-    CC_SAFE_DELETE(_gameModel);
-    CC_SAFE_DELETE(_undoManager);
-    // _gameView是autorelease对象，不需要手动删除
-}
-
-bool GameController::init(int levelId, Node* parent)
-{
-    // 初始化游戏数据模型
-    if (!initGameModel(levelId)) {
-        return false;
-    }
-    
-    // 初始化游戏视图
-    if (!initGameView(parent)) {
-        return false;
-    }
-    
-    // 初始化回退管理器
-    if (!initUndoManager()) {
-        return false;
-    }
-    
-    // 初始化事件处理
-    initEventHandlers();
-    
-    return true;
-}
-
-bool GameController::initGameModel(int levelId)
-{
-    // 加载关卡配置
-    auto levelConfig = LevelConfigLoader::loadLevelConfig(levelId);
-    if (!levelConfig) {
-        return false;
-    }
-    
-    // 生成游戏模型
-    _gameModel = GameModelFromLevelGenerator::generateGameModel(levelConfig);
-    
-    // 释放关卡配置
-    CC_SAFE_DELETE(levelConfig);
-    
-    return _gameModel != nullptr;
-}
-
-bool GameController::initGameView(Node* parent)
-{
-    if (!_gameModel || !parent) {
-        return false;
-    }
-    
-    // 创建游戏视图
-    _gameView = GameView::create(_gameModel);
-    if (!_gameView) {
-        return false;
-    }
-    
-    // 设置游戏视图的控制器引用
-    _gameView->setGameController(this);
-    
-    // 添加到父节点
-    parent->addChild(_gameView);
-    
-    return true;
-}
-
-bool GameController::initUndoManager()
-{
-    if (!_gameModel || !_gameView) {
-        return false;
-    }
-    
-    // 创建回退管理器
-    _undoManager = new UndoManager();
-    if (!_undoManager) {
-        return false;
-    }
-    
-    // 初始化回退管理器
-    return _undoManager->init(_gameModel, _gameView);
-}
-
-void GameController::initEventHandlers()
-{
-    if (!_gameView) {
-        return;
-    }
-    
-    // 设置主牌区卡牌点击回调
-    _gameView->setOnPlayfieldCardClickCallback(CC_CALLBACK_1(GameController::handlePlayfieldCardClick, this));
-    
-    // 设置备用牌堆点击回调
-    _gameView->setOnStackClickCallback(CC_CALLBACK_0(GameController::handleStackClick, this));
-    
-    // 设置回退按钮点击回调
-    _gameView->setOnUndoClickCallback(CC_CALLBACK_0(GameController::handleUndoClick, this));
-}
-
-bool GameController::handlePlayfieldCardClick(int cardId)
-{
-    if (!_gameModel || !_gameView || !_undoManager) {
-        return false;
-    }
-    
-    // 获取卡牌模型
-    CardModel* card = _gameModel->getPlayfieldCardById(cardId);
-    if (!card) {
-        return false;
-    }
-    
-    // 获取当前手牌区顶部卡牌
-    CardModel* trayTopCard = _gameModel->getTrayTopCard();
-    int prevTrayCardId = trayTopCard ? trayTopCard->getCardId() : -1;
-    
-    // 检查是否可以移动卡牌
-    if (trayTopCard && !card->canMatch(trayTopCard)) {
-        return false;
-    }
-    
-    // 记录操作
-    _undoManager->recordPlayfieldToTrayOperation(cardId, card->getPosition(), 
-                                                Vec2::ZERO, prevTrayCardId);
-    
-    // 判断是否是匹配的牌（差值为1的牌）
-    bool isMatchingCard = trayTopCard && card->canMatch(trayTopCard);
-    
-    if (isMatchingCard) {
-        // 如果是匹配的牌，使用直接覆盖动画
-        _gameView->playDirectCoverAnimation(cardId);
-    } else {
-        // 否则使用普通的移动到手牌区动画
-        _gameView->playCardMoveToTrayAnimation(cardId);
-    }
-    
-    // 更新游戏模型
-    _gameModel->moveCardFromPlayfieldToTray(cardId);
-    
-    // 检查游戏结束
-    checkGameOver();
-    
-    return true;
-}
-
-bool GameController::handleStackClick()
-{
-    if (!_gameModel || !_gameView || !_undoManager) {
-        return false;
-    }
-    
-    // 获取当前手牌区顶部卡牌
-    CardModel* trayTopCard = _gameModel->getTrayTopCard();
-    int prevTrayCardId = trayTopCard ? trayTopCard->getCardId() : -1;
-    
-    // 从备用牌堆抽一张牌
-    if (!_gameModel->drawCardFromStack()) {
-        return false;
-    }
-    
-    // 获取新的手牌区顶部卡牌
-    CardModel* newTrayTopCard = _gameModel->getTrayTopCard();
-    if (!newTrayTopCard) {
-        return false;
-    }
-    
-    // 记录操作
-    _undoManager->recordStackToTrayOperation(newTrayTopCard->getCardId(), prevTrayCardId);
-    
-    // 播放动画
-    _gameView->playStackToTrayAnimation();
-    
-    // 检查游戏结束
-    checkGameOver();
-    
-    return true;
-}
-
-bool GameController::handleUndoClick()
-{
-    if (!_undoManager) {
-        return false;
-    }
-    
-    // 执行撤销操作
-    return _undoManager->undo();
-}
-
-void GameController::checkGameOver()
-{
-    if (!_gameModel || !_gameView) {
-        return;
-    }
-    
-    // 检查游戏是否结束
-    if (_gameModel->isGameOver()) {
-        // 游戏结束，显示结果
-        if (_gameModel->isGameWon()) {
-            // 赢了
-            auto winLabel = Label::createWithTTF("You Win!", "fonts/Marker Felt.ttf", 80);
-            winLabel->setPosition(Vec2(_gameView->getContentSize().width/2, _gameView->getContentSize().height/2));
-            _gameView->addChild(winLabel, 100);
-        } else {
-            // 输了
-            auto loseLabel = Label::createWithTTF("Game Over!", "fonts/Marker Felt.ttf", 80);
-            loseLabel->setPosition(Vec2(_gameView->getContentSize().width/2, _gameView->getContentSize().height/2));
-            _gameView->addChild(loseLabel, 100);
-        }
-        
-        // 禁用所有交互
-        _gameView->setPlayfieldCardsInteractive(false);
-        _gameView->setStackInteractive(false);
-        _gameView->setUndoButtonEnabled(false);
-    }
-}
-
-void GameController::resetGameState()
-{
-    // 注意：删除了对不存在的updateValidMoves方法的调用
-    
-    // 更新游戏视图的交互状态
-    _gameView->setPlayfieldCardsInteractive(true);
-    
-    // 更新牌堆交互状态
-    if (_gameModel->getStackCards().size() > 0) {
-        _gameView->setStackInteractive(true);
-    } else {
-        _gameView->setStackInteractive(false);
-    }
-    
-    // 检查游戏结束条件
-    checkGameOver();
+/**
+ * GameController.cpp
+ * 游戏控制器实现
+ */
+
+#include "GameController.h"
+#include "../adapters/CocosLevelConfigLoader.h"
+#include "../configs/models/CardResConfig.h"
+#include "../services/GameModelFromLevelGenerator.h"
+#include "../core/profile/TraceRecorder.h"
+#include "../core/profile/AllocationTracker.h"
+#include "../core/hint/SharedTablebase.h"
+#include "FramePacer.h"
+
+USING_NS_CC;
+
+// 提示与可通关结论每帧更新的调度键
+static const char* ANALYSIS_UPDATE_KEY = "analysis_update";
+
+GameController::GameController()
+    : _gameModel(nullptr)
+    , _gameView(nullptr)
+    , _undoManager(nullptr)
+    , _hintEngine(nullptr)
+    , _hintRequested(false)
+    , _winnabilityTracker(nullptr)
+    , _noWinsShown(false)
+{
+}
+
+GameController::~GameController()
+{
+    if (_hintEngine || _winnabilityTracker) {
+        Director::getInstance()->getScheduler()->unschedule(ANALYSIS_UPDATE_KEY, this);
+    }
+    if (_hintEngine) {
+        _hintEngine->stop();
+    }
+    CC_SAFE_DELETE(_hintEngine);
+    CC_SAFE_DELETE(_winnabilityTracker);
+    CC_SAFE_DELETE(_gameModel);
+    CC_SAFE_DELETE(_undoManager);
+    // _gameView是autorelease对象，不需要手动删除
+}
+
+bool GameController::init(int levelId, Node* parent)
+{
+    CORE_ALLOCATION_SCOPE(AS_LOAD);
+    
+    // 初始化游戏数据模型
+    if (!initGameModel(levelId)) {
+        return false;
+    }
+    
+    // 初始化游戏视图
+    if (!initGameView(parent)) {
+        return false;
+    }
+    
+    // 初始化回退管理器
+    if (!initUndoManager()) {
+        return false;
+    }
+    
+    // 初始化事件处理
+    initEventHandlers();
+    
+    // 初始化提示引擎，失败时只是没有提示功能
+    if (!initHintEngine()) {
+        _gameView->setHintButtonEnabled(false);
+    }
+    
+    // 初始化可通关追踪器（结论来自提示引擎），失败时不提前结束对局
+    initWinnabilityTracker();
+    
+    // 工作线程模式下提示引擎在此只读取结果，时间片模式下还在此搜索
+    if (_hintEngine || _winnabilityTracker) {
+        Director::getInstance()->getScheduler()->schedule(CC_CALLBACK_1(GameController::updateAnalysis, this),
+                                                          this, 0.0f, false, ANALYSIS_UPDATE_KEY);
+    }
+    
+    return true;
+}
+
+bool GameController::initGameModel(int levelId)
+{
+    // 加载关卡配置
+    auto levelConfig = CocosLevelConfigLoader::loadLevelConfig(levelId);
+    if (!levelConfig) {
+        return false;
+    }
+    
+    // 生成游戏模型
+    _gameModel = GameModelFromLevelGenerator::generateGameModel(levelConfig);
+    
+    // 生成提示搜索使用的牌局定义，本关卡的所有局面快照共享
+    CompactDeal* compactDeal = new CompactDeal();
+    if (compactDeal->initWithLevelConfig(levelConfig)) {
+        _compactDeal.reset(compactDeal);
+    } else {
+        delete compactDeal;
+    }
+    
+    // 释放关卡配置
+    CC_SAFE_DELETE(levelConfig);
+    
+    return _gameModel != nullptr;
+}
+
+bool GameController::initGameView(Node* parent)
+{
+    if (!_gameModel || !parent) {
+        return false;
+    }
+    
+    // 创建游戏视图
+    _gameView = GameView::create(_gameModel);
+    if (!_gameView) {
+        return false;
+    }
+    
+    // 设置游戏视图的控制器引用
+    _gameView->setGameController(this);
+    
+    // 添加到父节点
+    parent->addChild(_gameView);
+    
+    return true;
+}
+
+bool GameController::initUndoManager()
+{
+    if (!_gameModel || !_gameView) {
+        return false;
+    }
+    
+    // 创建回退管理器
+    _undoManager = new UndoManager();
+    if (!_undoManager) {
+        return false;
+    }
+    
+    // 初始化回退管理器
+    return _undoManager->init(_gameModel, _gameView);
+}
+
+void GameController::initEventHandlers()
+{
+    if (!_gameView) {
+        return;
+    }
+    
+    // 设置主牌区卡牌点击回调
+    _gameView->setOnPlayfieldCardClickCallback(CC_CALLBACK_1(GameController::handlePlayfieldCardClick, this));
+    
+    // 设置备用牌堆点击回调
+    _gameView->setOnStackClickCallback(CC_CALLBACK_0(GameController::handleStackClick, this));
+    
+    // 设置回退按钮点击回调
+    _gameView->setOnUndoClickCallback(CC_CALLBACK_0(GameController::handleUndoClick, this));
+    
+    // 设置提示按钮点击回调
+    _gameView->setOnHintClickCallback(CC_CALLBACK_0(GameController::handleHintClick, this));
+}
+
+bool GameController::initHintEngine()
+{
+    if (!_gameModel || !_compactDeal) {
+        return false;
+    }
+    
+    // 残局库在后台构建，完成前照常搜索，完成后由updateHint交给引擎
+    SharedTablebase::buildAsync();
+    _hintEngine = new HintEngine();
+    _hintEngine->setTablebase(SharedTablebase::get());
+    if (!_hintEngine->start(HintEngineOptions())) {
+        CC_SAFE_DELETE(_hintEngine);
+        return false;
+    }
+    
+    // 初始局面立即开始搜索，玩家点击提示时通常已有结果
+    submitHintSnapshot();
+    
+    return true;
+}
+
+void GameController::submitHintSnapshot()
+{
+    // 每次模型变化都会走到这里，立即恢复满帧率
+    FramePacer::wake();
+    
+    if (!_hintEngine) {
+        return;
+    }
+    
+    // 旧局面的提示已经失效
+    _hintRequested = false;
+    _gameView->clearHint();
+    _hintEngine->submitSnapshot(HintSnapshot::createFromGameModel(_gameModel, _compactDeal));
+}
+
+void GameController::updateHint()
+{
+    if (!_hintEngine) {
+        return;
+    }
+    
+    // 残局库范围内的局面直接查表，不再搜索
+    _hintEngine->setTablebase(SharedTablebase::get());
+    _hintEngine->update();
+    
+    if (!_hintRequested) {
+        return;
+    }
+    
+    // 等待提示结果期间保持满帧率，结果出来后立即显示
+    FramePacer::wake();
+    
+    // 搜索中的结果可能还会变化，等到得出结论或用完时间预算再显示
+    HintResult result;
+    if (!_hintEngine->pollResult(result) || result.status == HS_SEARCHING) {
+        return;
+    }
+    
+    _hintRequested = false;
+    if (result.hasMove) {
+        // 主牌区卡牌ID即牌局定义中的下标
+        _gameView->showHint(result.move == CompactGameState::MOVE_DRAW ? -1 : result.move);
+    }
+}
+
+bool GameController::handleHintClick()
+{
+    CORE_TRACE_SCOPE("input", "GameController::handleHintClick");
+    
+    if (!_hintEngine || !_gameModel || _gameModel->isGameOver()) {
+        return false;
+    }
+    
+    _hintRequested = true;
+    updateHint();
+    
+    return true;
+}
+
+bool GameController::initWinnabilityTracker()
+{
+    if (!_compactDeal || !_hintEngine) {
+        return false;
+    }
+    
+    _winnabilityTracker = new WinnabilityTracker();
+    if (!_winnabilityTracker->reset(_compactDeal)) {
+        CC_SAFE_DELETE(_winnabilityTracker);
+        return false;
+    }
+    
+    return true;
+}
+
+void GameController::updateWinnability()
+{
+    if (!_winnabilityTracker || !_hintEngine || _noWinsShown || _gameModel->isGameOver()) {
+        return;
+    }
+    
+    // 提示引擎已经在搜索同一局面，这里只读取它发布的结论，主线程不再另外搜索
+    HintResult result;
+    if (_winnabilityTracker->getVerdict() == WV_UNKNOWN) {
+        if (!_hintEngine->pollResult(result) || result.status == HS_SEARCHING) {
+            // 结论未出时保持满帧率：时间片模式下每帧搜索一片，空闲帧率会让结论晚到数秒；
+            // 引擎的时间预算用完后结论变为HS_UNKNOWN，不会一直占用满帧率
+            FramePacer::wake();
+        } else if (result.status == HS_LOST) {
+            _winnabilityTracker->setVerdict(WV_LOST, -1);
+        } else if (result.status == HS_WINNING) {
+            _winnabilityTracker->setVerdict(WV_WINNABLE, result.hasMove ? result.move : -1);
+        }
+    }
+    
+    if (_winnabilityTracker->getVerdict() != WV_LOST) {
+        return;
+    }
+    
+    // 已无法通关：提前提示并禁用出牌和抽牌，保留回退
+    _noWinsShown = true;
+    _gameView->setNoWinsLeftVisible(true);
+    _gameView->setPlayfieldCardsInteractive(false);
+    _gameView->setStackInteractive(false);
+}
+
+void GameController::updateAnalysis(float dt)
+{
+    updateHint();
+    updateWinnability();
+}
+
+bool GameController::handlePlayfieldCardClick(int cardId)
+{
+    CORE_TRACE_SCOPE("input", "GameController::handlePlayfieldCardClick");
+    CORE_ALLOCATION_SCOPE(AS_MOVE);
+    
+    if (!_gameModel || !_gameView || !_undoManager) {
+        return false;
+    }
+    
+    // 获取卡牌模型
+    CardModel* card = _gameModel->getPlayfieldCardById(cardId);
+    if (!card) {
+        return false;
+    }
+    
+    // 获取当前手牌区顶部卡牌
+    CardModel* trayTopCard = _gameModel->getTrayTopCard();
+    int prevTrayCardId = trayTopCard ? trayTopCard->getCardId() : -1;
+    
+    // 检查是否可以移动卡牌
+    if (trayTopCard && !GameModel::canMatch(card, trayTopCard)) {
+        return false;
+    }
+    
+    // 记录操作
+    _undoManager->recordPlayfieldToTrayOperation(cardId, card->getPosition(), 
+                                                CoreVec2::ZERO, prevTrayCardId);
+    
+    // 判断是否是匹配的牌（差值为1的牌）
+    bool isMatchingCard = trayTopCard && GameModel::canMatch(card, trayTopCard);
+    
+    if (isMatchingCard) {
+        // 如果是匹配的牌，使用直接覆盖动画
+        _gameView->playDirectCoverAnimation(cardId);
+    } else {
+        // 否则使用普通的移动到手牌区动画
+        _gameView->playCardMoveToTrayAnimation(cardId);
+    }
+    
+    // 更新游戏模型
+    _gameModel->moveCardFromPlayfieldToTray(cardId);
+    submitHintSnapshot();
+    if (_winnabilityTracker) {
+        // 主牌区卡牌ID即牌局定义中的下标
+        _winnabilityTracker->applyMove(cardId);
+    }
+    
+    // 检查游戏结束
+    checkGameOver();
+    
+    return true;
+}
+
+bool GameController::handleStackClick()
+{
+    CORE_TRACE_SCOPE("input", "GameController::handleStackClick");
+    CORE_ALLOCATION_SCOPE(AS_MOVE);
+    
+    if (!_gameModel || !_gameView || !_undoManager) {
+        return false;
+    }
+    
+    // 获取当前手牌区顶部卡牌
+    CardModel* trayTopCard = _gameModel->getTrayTopCard();
+    int prevTrayCardId = trayTopCard ? trayTopCard->getCardId() : -1;
+    
+    // 从备用牌堆抽一张牌
+    if (!_gameModel->drawCardFromStack()) {
+        return false;
+    }
+    
+    // 获取新的手牌区顶部卡牌
+    CardModel* newTrayTopCard = _gameModel->getTrayTopCard();
+    if (!newTrayTopCard) {
+        return false;
+    }
+    
+    // 记录操作
+    _undoManager->recordStackToTrayOperation(newTrayTopCard->getCardId(), prevTrayCardId);
+    
+    // 播放动画
+    _gameView->playStackToTrayAnimation();
+    submitHintSnapshot();
+    if (_winnabilityTracker) {
+        _winnabilityTracker->applyMove(CompactGameState::MOVE_DRAW);
+    }
+    
+    // 检查游戏结束
+    checkGameOver();
+    
+    return true;
+}
+
+bool GameController::handleUndoClick()
+{
+    CORE_TRACE_SCOPE("input", "GameController::handleUndoClick");
+    CORE_ALLOCATION_SCOPE(AS_MOVE);
+    
+    if (!_undoManager) {
+        return false;
+    }
+    
+    // 执行撤销操作，模型在undo中立即恢复，动画随后播放
+    if (!_undoManager->undo()) {
+        return false;
+    }
+    submitHintSnapshot();
+    
+    // 回退直接恢复上一步记录的结论，回到仍可通关的局面时恢复交互
+    if (_winnabilityTracker) {
+        _winnabilityTracker->undoMove();
+        if (_noWinsShown && _winnabilityTracker->getVerdict() != WV_LOST) {
+            _noWinsShown = false;
+            _gameView->setNoWinsLeftVisible(false);
+            resetGameState();
+        }
+    }
+    
+    return true;
+}
+
+void GameController::checkGameOver()
+{
+    if (!_gameModel || !_gameView) {
+        return;
+    }
+    
+    // 检查游戏是否结束
+    if (_gameModel->isGameOver()) {
+        // 游戏结束，显示结果
+        const char* fontPath = CardResConfig::getResourcePath(RID_FONT_MARKER_FELT);
+        if (_gameModel->isGameWon()) {
+            // 赢了
+            auto winLabel = Label::createWithTTF("You Win!", fontPath, 80);
+            winLabel->setPosition(Vec2(_gameView->getContentSize().width/2, _gameView->getContentSize().height/2));
+            _gameView->addChild(winLabel, 100);
+        } else {
+            // 输了
+            auto loseLabel = Label::createWithTTF("Game Over!", fontPath, 80);
+            loseLabel->setPosition(Vec2(_gameView->getContentSize().width/2, _gameView->getContentSize().height/2));
+            _gameView->addChild(loseLabel, 100);
+        }
+        
+        // 禁用所有交互
+        _gameView->setPlayfieldCardsInteractive(false);
+        _gameView->setStackInteractive(false);
+        _gameView->setUndoButtonEnabled(false);
+        _gameView->setHintButtonEnabled(false);
+    }
+}
+
+bool GameController::canUndo() const
+{
+    return _undoManager && _undoManager->canUndo();
+}
+
+void GameController::resetGameState()
+{
+    // 注意：删除了对不存在的updateValidMoves方法的调用
+    
+    // 更新游戏视图的交互状态
+    _gameView->setPlayfieldCardsInteractive(true);
+    
+    // 更新牌堆交互状态
+    if (_gameModel->getStackCards().size() > 0) {
+        _gameView->setStackInteractive(true);
+    } else {
+        _gameView->setStackInteractive(false);
+    }
+    
+    // 检查游戏结束条件
+    checkGameOver();
 }
\ No newline at end of file
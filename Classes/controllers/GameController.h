@@ -1,98 +1,160 @@
-/**
- * GameController.h
- * 游戏控制器，管理整个游戏流程
- */
-
-#ifndef __GAME_CONTROLLER_H__
-#define __GAME_CONTROLLER_H__
-
-#include "cocos2d.h"
-#include "../models/GameModel.h"
-#include "../views/GameView.h"
-#include "../managers/UndoManager.h"
-
-/**
- * 游戏控制器类，管理游戏逻辑
- */
-class GameController
-{
-public:
-    /**
-     * 构造函数
-     */
-    GameController();
-    
-    /**
-     * 析构函数
-     */
-    ~GameController();
-    
-    /**
-     * 初始化游戏控制器
-     * @param levelId 关卡ID
-     * @param parent 父节点
-     * @return 是否初始化成功
-     */
-    bool init(int levelId, cocos2d::Node* parent);
-    
-    /**
-     * 处理主牌区卡牌点击事件
-     * @param cardId 卡牌ID
-     * @return 是否处理成功
-     */
-    bool handlePlayfieldCardClick(int cardId);
-    
-    /**
-     * 处理备用牌堆点击事件
-     * @return 是否处理成功
-     */
-    bool handleStackClick();
-    
-    /**
-     * 处理回退按钮点击事件
-     * @return 是否处理成功
-     */
-    bool handleUndoClick();
-    
-    /**
-     * 重置游戏状态，重新计算有效移动
-     */
-    void resetGameState();
-    
-private:
-    GameModel* _gameModel;        // 游戏数据模型
-    GameView* _gameView;          // 游戏视图
-    UndoManager* _undoManager;    // 回退管理器
-    
-    /**
-     * 初始化游戏数据模型
-     * @param levelId 关卡ID
-     * @return 是否初始化成功
-     */
-    bool initGameModel(int levelId);
-    
-    /**
-     * 初始化游戏视图
-     * @param parent 父节点
-     * @return 是否初始化成功
-     */
-    bool initGameView(cocos2d::Node* parent);
-    
-    /**
-     * 初始化回退管理器
-     * @return 是否初始化成功
-     */
-    bool initUndoManager();
-    
-    /**
-     * 初始化事件处理
-     */
-    void initEventHandlers();
-    
-    /**
-     * 检查游戏结束
-     */
-    void checkGameOver();
-};
-
+/**
+ * GameController.h
+ * 游戏控制器，管理整个游戏流程
+ */
+
+#ifndef __GAME_CONTROLLER_H__
+#define __GAME_CONTROLLER_H__
+
+#include "cocos2d.h"
+#include "../models/GameModel.h"
+#include "../views/GameView.h"
+#include "../managers/UndoManager.h"
+#include "core/hint/HintEngine.h"
+#include "core/hint/WinnabilityTracker.h"
+#include <memory>
+
+/**
+ * 游戏控制器类，管理游戏逻辑
+ */
+class GameController
+{
+public:
+    /**
+     * 构造函数
+     */
+    GameController();
+    
+    /**
+     * 析构函数
+     */
+    ~GameController();
+    
+    /**
+     * 初始化游戏控制器
+     * @param levelId 关卡ID
+     * @param parent 父节点
+     * @return 是否初始化成功
+     */
+    bool init(int levelId, cocos2d::Node* parent);
+    
+    /**
+     * 处理主牌区卡牌点击事件
+     * @param cardId 卡牌ID
+     * @return 是否处理成功
+     */
+    bool handlePlayfieldCardClick(int cardId);
+    
+    /**
+     * 处理备用牌堆点击事件
+     * @return 是否处理成功
+     */
+    bool handleStackClick();
+    
+    /**
+     * 处理回退按钮点击事件
+     * @return 是否处理成功
+     */
+    bool handleUndoClick();
+    
+    /**
+     * 处理提示按钮点击事件，结果就绪后高亮推荐的操作
+     * @return 是否处理成功
+     */
+    bool handleHintClick();
+    
+    /**
+     * 重置游戏状态，重新计算有效移动
+     */
+    void resetGameState();
+    
+    /**
+     * 获取游戏数据模型
+     */
+    const GameModel* getGameModel() const { return _gameModel; }
+    
+    /**
+     * 获取游戏视图
+     */
+    GameView* getGameView() const { return _gameView; }
+    
+    /**
+     * 是否有可回退的操作
+     */
+    bool canUndo() const;
+    
+private:
+    GameModel* _gameModel;        // 游戏数据模型
+    GameView* _gameView;          // 游戏视图
+    UndoManager* _undoManager;    // 回退管理器
+    HintEngine* _hintEngine;      // 提示引擎
+    std::shared_ptr<const CompactDeal> _compactDeal;    // 提示搜索使用的牌局定义
+    bool _hintRequested;          // 玩家是否在等待提示结果
+    WinnabilityTracker* _winnabilityTracker;    // 可通关追踪器
+    bool _noWinsShown;            // 是否已显示无法通关提示
+    
+    /**
+     * 初始化游戏数据模型
+     * @param levelId 关卡ID
+     * @return 是否初始化成功
+     */
+    bool initGameModel(int levelId);
+    
+    /**
+     * 初始化游戏视图
+     * @param parent 父节点
+     * @return 是否初始化成功
+     */
+    bool initGameView(cocos2d::Node* parent);
+    
+    /**
+     * 初始化回退管理器
+     * @return 是否初始化成功
+     */
+    bool initUndoManager();
+    
+    /**
+     * 初始化事件处理
+     */
+    void initEventHandlers();
+    
+    /**
+     * 初始化提示引擎
+     * @return 是否初始化成功
+     */
+    bool initHintEngine();
+    
+    /**
+     * 模型变化后向提示引擎提交新的局面快照
+     */
+    void submitHintSnapshot();
+    
+    /**
+     * 更新提示引擎并读取结果
+     */
+    void updateHint();
+    
+    /**
+     * 初始化可通关追踪器
+     * @return 是否初始化成功
+     */
+    bool initWinnabilityTracker();
+    
+    /**
+     * 读取提示引擎对当前局面的结论更新可通关结论，确认无法通关时提前结束对局
+     */
+    void updateWinnability();
+    
+    /**
+     * 每帧更新提示与可通关结论
+     * @param dt 帧间隔
+     */
+    void updateAnalysis(float dt);
+    
+    /**
+     * 检查游戏结束
+     */
+    void checkGameOver();
+};
+
 #endif // __GAME_CONTROLLER_H__
\ No newline at end of file
@@ -0,0 +1,276 @@
+/**
+ * SoakBot.cpp
+ * 长时间自动对局实现
+ */
+
+#include "SoakBot.h"
+#include "GameController.h"
+#include "../scenes/GameScene.h"
+#include "../adapters/CocosAdapter.h"
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+#include <unistd.h>
+#endif
+
+USING_NS_CC;
+
+// 注入点击使用的触点ID，避开真实触点常用的0
+static const intptr_t SOAK_TOUCH_ID = 7;
+
+/**
+ * 读取浮点环境变量
+ */
+static float getEnvFloat(const char* name, float defaultValue)
+{
+    const char* value = getenv(name);
+    return value && value[0] ? static_cast<float>(atof(value)) : defaultValue;
+}
+
+/**
+ * 读取无符号整数环境变量
+ */
+static uint32_t getEnvUint(const char* name, uint32_t defaultValue)
+{
+    const char* value = getenv(name);
+    return value && value[0] ? static_cast<uint32_t>(strtoul(value, nullptr, 10)) : defaultValue;
+}
+
+/**
+ * 统计节点树中的节点数
+ */
+static int countNodes(const Node* node)
+{
+    int count = 1;
+    for (const Node* child : node->getChildren()) {
+        count += countNodes(child);
+    }
+    return count;
+}
+
+/**
+ * 计算百分位数，会对输入排序
+ */
+static float percentile(std::vector<float>& samples, float percentile)
+{
+    if (samples.empty()) {
+        return 0.0f;
+    }
+    std::sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(percentile / 100.0f * (samples.size() - 1) + 0.5f);
+    return samples[std::min(index, samples.size() - 1)];
+}
+
+SoakBot* SoakBot::start(const std::string& csvPath, const SoakBotOptions& options)
+{
+    SoakBot* bot = new (std::nothrow) SoakBot();
+    if (!bot || !bot->init(csvPath, options)) {
+        CC_SAFE_DELETE(bot);
+        return nullptr;
+    }
+    
+    // 调度器不持有非节点目标的引用，创建时的引用保留到运行结束
+    Director::getInstance()->getScheduler()->scheduleUpdate(bot, 0, false);
+    return bot;
+}
+
+SoakBot* SoakBot::startFromEnvironment()
+{
+    const char* csvPath = getenv("CARD_SOAK_CSV");
+    if (!csvPath || !csvPath[0]) {
+        return nullptr;
+    }
+    
+    SoakBotOptions options;
+    options.seed = getEnvUint("CARD_SOAK_SEED", options.seed);
+    options.duration = getEnvFloat("CARD_SOAK_HOURS", 0.0f) * 3600.0f;
+    options.tapInterval = getEnvFloat("CARD_SOAK_TAP_SECONDS", options.tapInterval);
+    options.reportInterval = getEnvFloat("CARD_SOAK_REPORT_SECONDS", options.reportInterval);
+    return start(csvPath, options);
+}
+
+long SoakBot::getResidentMemoryKB()
+{
+#if (CC_TARGET_PLATFORM == CC_PLATFORM_LINUX)
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;
+    }
+    long totalPages = 0;
+    long residentPages = 0;
+    int fields = fscanf(file, "%ld %ld", &totalPages, &residentPages);
+    fclose(file);
+    return fields == 2 ? residentPages * (sysconf(_SC_PAGESIZE) / 1024) : 0;
+#else
+    return 0;
+#endif
+}
+
+SoakBot::SoakBot()
+    : _elapsed(0.0f)
+    , _sinceTap(0.0f)
+    , _sinceReport(0.0f)
+    , _moves(0)
+    , _misses(0)
+    , _draws(0)
+    , _undos(0)
+    , _restarts(0)
+{
+}
+
+SoakBot::~SoakBot()
+{
+}
+
+bool SoakBot::init(const std::string& csvPath, const SoakBotOptions& options)
+{
+    _options = options;
+    _random.seed(options.seed);
+    _csv.open(csvPath.c_str(), std::ios::out | std::ios::trunc);
+    if (!_csv) {
+        return false;
+    }
+    
+    _csv << "elapsed_s,frames,frame_p50_ms,frame_p95_ms,frame_p99_ms,frame_max_ms,"
+            "nodes,textures,texture_kb,rss_kb,moves,misses,draws,undos,restarts\n";
+    _csv.flush();
+    return true;
+}
+
+void SoakBot::update(float dt)
+{
+    _elapsed += dt;
+    _sinceTap += dt;
+    _sinceReport += dt;
+    _frameTimes.push_back(dt * 1000.0f);
+    
+    if (_sinceTap >= _options.tapInterval) {
+        _sinceTap = 0.0f;
+        step();
+    }
+    
+    if (_sinceReport >= _options.reportInterval) {
+        _sinceReport = 0.0f;
+        writeReport();
+    }
+    
+    if (_options.duration > 0.0f && _elapsed >= _options.duration) {
+        writeReport();
+        Director::getInstance()->getScheduler()->unscheduleUpdate(this);
+        Director::getInstance()->end();
+        autorelease();
+    }
+}
+
+void SoakBot::step()
+{
+    GameController* controller = findGameController();
+    const GameModel* model = controller ? controller->getGameModel() : nullptr;
+    if (!model || !controller->getGameView()) {
+        return;
+    }
+    if (model->isGameOver()) {
+        restartGame();
+        return;
+    }
+    
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    if (controller->canUndo() && chance(_random) < _options.undoRate) {
+        _undos += tapTarget(controller, GameView::TOUCH_TARGET_UNDO);
+        return;
+    }
+    
+    // 按手牌区顶部卡牌把主牌区卡牌分成能匹配与不能匹配两组
+    std::vector<int> matching;
+    std::vector<int> blocked;
+    for (const CardModel* card : model->getPlayfieldCards()) {
+        bool canMatch = !model->getTrayTopCard() || GameModel::canMatch(card, model->getTrayTopCard());
+        (canMatch ? matching : blocked).push_back(card->getCardId());
+    }
+    
+    if (!blocked.empty() && chance(_random) < _options.missRate) {
+        _misses += tapTarget(controller, blocked[_random() % blocked.size()]);
+    } else if (!matching.empty()) {
+        _moves += tapTarget(controller, matching[_random() % matching.size()]);
+    } else if (!model->getStackCards().empty()) {
+        _draws += tapTarget(controller, GameView::TOUCH_TARGET_STACK);
+    } else if (controller->canUndo()) {
+        _undos += tapTarget(controller, GameView::TOUCH_TARGET_UNDO);
+    } else {
+        restartGame();
+    }
+}
+
+void SoakBot::tap(const Vec2& worldPosition)
+{
+    GLView* glview = Director::getInstance()->getOpenGLView();
+    if (!glview) {
+        return;
+    }
+    
+    // GLView按视口与缩放把屏幕坐标换算成设计分辨率坐标，触点位置再由导演翻转Y轴，这里做逆变换
+    Size winSize = Director::getInstance()->getWinSize();
+    Rect viewport = glview->getViewPortRect();
+    intptr_t ids[1] = { SOAK_TOUCH_ID };
+    float xs[1] = { worldPosition.x * glview->getScaleX() + viewport.origin.x };
+    float ys[1] = { (winSize.height - worldPosition.y) * glview->getScaleY() + viewport.origin.y };
+    glview->handleTouchesBegin(1, ids, xs, ys);
+    glview->handleTouchesEnd(1, ids, xs, ys);
+}
+
+bool SoakBot::tapTarget(GameController* controller, int target)
+{
+    Vec2 position;
+    if (!controller->getGameView()->getTouchTargetPosition(target, position)) {
+        return false;
+    }
+    tap(position);
+    return true;
+}
+
+void SoakBot::restartGame()
+{
+    _restarts++;
+    Director::getInstance()->replaceScene(GameScene::createScene());
+}
+
+void SoakBot::writeReport()
+{
+    Scene* scene = Director::getInstance()->getRunningScene();
+    int textures = 0;
+    long textureKB = 0;
+    CocosAdapter::getTextureCacheUsage(textures, textureKB);
+    
+    size_t frames = _frameTimes.size();
+    float p50 = percentile(_frameTimes, 50.0f);
+    float p95 = percentile(_frameTimes, 95.0f);
+    float p99 = percentile(_frameTimes, 99.0f);
+    float maxTime = _frameTimes.empty() ? 0.0f : _frameTimes.back();
+    _frameTimes.clear();
+    
+    char line[256];
+    snprintf(line, sizeof(line), "%.1f,%d,%.2f,%.2f,%.2f,%.2f,%d,%d,%ld,%ld,%d,%d,%d,%d,%d\n", _elapsed,
+             static_cast<int>(frames), p50, p95, p99, maxTime, scene ? countNodes(scene) : 0, textures, textureKB,
+             getResidentMemoryKB(), _moves, _misses, _draws, _undos, _restarts);
+    _csv << line;
+    _csv.flush();
+}
+
+GameController* SoakBot::findGameController() const
+{
+    Scene* scene = Director::getInstance()->getRunningScene();
+    if (!scene) {
+        return nullptr;
+    }
+    
+    // GameScene::createScene把GameScene作为子节点放在外层场景中
+    for (Node* child : scene->getChildren()) {
+        GameScene* gameScene = dynamic_cast<GameScene*>(child);
+        if (gameScene) {
+            return gameScene->getGameController();
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,132 @@
+/**
+ * SoakBot.h
+ * 长时间自动对局：按种子策略注入模拟点击，定时把帧耗时与内存统计写入CSV
+ */
+
+#ifndef __SOAK_BOT_H__
+#define __SOAK_BOT_H__
+
+#include "cocos2d.h"
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+class GameController;
+
+/**
+ * 自动对局参数
+ */
+struct SoakBotOptions
+{
+    uint32_t seed;              // 策略随机种子
+    float tapInterval;          // 两次点击之间的间隔（秒）
+    float reportInterval;       // 两行统计之间的间隔（秒）
+    float duration;             // 运行时长（秒），到时结束程序；不大于0时一直运行
+    float undoRate;             // 有可回退的操作时点击回退的概率
+    float missRate;             // 点击一张不能匹配的主牌区卡牌的概率，覆盖拒绝出牌的路径
+    
+    SoakBotOptions()
+        : seed(1)
+        , tapInterval(0.4f)
+        , reportInterval(10.0f)
+        , duration(0.0f)
+        , undoRate(0.15f)
+        , missRate(0.05f)
+    {}
+};
+
+/**
+ * 自动对局驱动
+ * 挂在导演的调度器上，不随场景切换销毁。每隔tapInterval按策略选择一个目标（能匹配的主牌区卡牌、
+ * 备用牌堆、回退按钮），把目标的世界坐标换算成屏幕坐标后经GLView::handleTouchesBegin/End注入，
+ * 与真实点击一样经过事件分发器；对局结束或无路可走时重新创建GameScene。
+ * 每隔reportInterval向CSV追加一行：帧耗时分位数、场景节点数、纹理数与纹理内存、进程常驻内存
+ */
+class SoakBot : public cocos2d::Ref
+{
+public:
+    /**
+     * 创建并开始运行
+     * @param csvPath CSV文件路径
+     * @param options 运行参数
+     * @return 驱动对象（运行到结束为止），文件无法写入时返回nullptr
+     */
+    static SoakBot* start(const std::string& csvPath, const SoakBotOptions& options);
+    
+    /**
+     * 按环境变量开始运行：CARD_SOAK_CSV为CSV路径（未设置时不运行），
+     * CARD_SOAK_SEED、CARD_SOAK_HOURS、CARD_SOAK_TAP_SECONDS、CARD_SOAK_REPORT_SECONDS覆盖默认参数
+     * @return 驱动对象，未设置或无法运行时返回nullptr
+     */
+    static SoakBot* startFromEnvironment();
+    
+    /**
+     * 每帧更新，由调度器调用
+     * @param dt 帧间隔（秒）
+     */
+    void update(float dt);
+    
+    /**
+     * 获取进程常驻内存
+     * @return 千字节，平台不支持时返回0
+     */
+    static long getResidentMemoryKB();
+    
+private:
+    SoakBot();
+    ~SoakBot();
+    
+    /**
+     * 初始化
+     * @return CSV文件能否写入
+     */
+    bool init(const std::string& csvPath, const SoakBotOptions& options);
+    
+    /**
+     * 按策略执行一次操作
+     */
+    void step();
+    
+    /**
+     * 在世界坐标处注入一次完整点击（按下与抬起）
+     * @param worldPosition 世界坐标
+     */
+    void tap(const cocos2d::Vec2& worldPosition);
+    
+    /**
+     * 点击游戏视图中的目标
+     * @return 目标不存在或不可见时返回false
+     */
+    bool tapTarget(GameController* controller, int target);
+    
+    /**
+     * 重新创建游戏场景
+     */
+    void restartGame();
+    
+    /**
+     * 写一行统计并清空帧耗时窗口
+     */
+    void writeReport();
+    
+    /**
+     * 查找当前运行场景中的游戏控制器
+     */
+    GameController* findGameController() const;
+    
+    SoakBotOptions _options;        // 运行参数
+    std::ofstream _csv;             // 统计输出
+    std::mt19937 _random;           // 策略随机数
+    std::vector<float> _frameTimes; // 当前统计窗口的帧耗时（毫秒）
+    float _elapsed;                 // 累计运行时间（秒）
+    float _sinceTap;                // 距上次点击的时间（秒）
+    float _sinceReport;             // 距上次统计的时间（秒）
+    int _moves;                     // 点击能匹配的卡牌次数
+    int _misses;                    // 点击不能匹配的卡牌次数
+    int _draws;                     // 点击备用牌堆次数
+    int _undos;                     // 点击回退次数
+    int _restarts;                  // 重新开局次数
+};
+
+#endif // __SOAK_BOT_H__
@@ -0,0 +1,32 @@
+/**
+ * CoreMacros.h
+ * 核心库通用宏定义，替代引擎中的同类宏
+ */
+
+#ifndef __CORE_MACROS_H__
+#define __CORE_MACROS_H__
+
+/**
+ * 安全删除指针并置空
+ */
+#define CORE_SAFE_DELETE(p)     do { delete (p); (p) = nullptr; } while (0)
+
+/**
+ * 拼接两个记号（参数先展开），用于生成带行号的局部变量名
+ */
+#define CORE_CONCAT_INNER(a, b) a##b
+#define CORE_CONCAT(a, b)       CORE_CONCAT_INNER(a, b)
+
+/**
+ * 性能剖析开关：调试构建（COCOS2D_DEBUG > 0）默认打开，发布构建默认关闭，
+ * 也可以在编译参数中显式定义为0或1。关闭时计时宏展开为空，统计浮层也不会编译进来
+ */
+#ifndef CARD_PROFILING
+#if defined(COCOS2D_DEBUG) && COCOS2D_DEBUG > 0
+#define CARD_PROFILING 1
+#else
+#define CARD_PROFILING 0
+#endif
+#endif
+
+#endif // __CORE_MACROS_H__
@@ -0,0 +1,8 @@
+/**
+ * CoreMath.cpp
+ * 核心库数学类型实现
+ */
+
+#include "CoreMath.h"
+
+const CoreVec2 CoreVec2::ZERO(0.0f, 0.0f);
@@ -0,0 +1,33 @@
+/**
+ * CoreMath.h
+ * 核心库使用的轻量数学类型，不依赖引擎头文件
+ */
+
+#ifndef __CORE_MATH_H__
+#define __CORE_MATH_H__
+
+/**
+ * 二维向量，用于保存卡牌位置等纯数据
+ */
+struct CoreVec2
+{
+    float x;    // X坐标
+    float y;    // Y坐标
+    
+    CoreVec2()
+        : x(0.0f)
+        , y(0.0f)
+    {}
+    
+    CoreVec2(float xx, float yy)
+        : x(xx)
+        , y(yy)
+    {}
+    
+    bool operator==(const CoreVec2& other) const { return x == other.x && y == other.y; }
+    bool operator!=(const CoreVec2& other) const { return !(*this == other); }
+    
+    static const CoreVec2 ZERO;    // 零向量
+};
+
+#endif // __CORE_MATH_H__
@@ -0,0 +1,217 @@
+/**
+ * DailyChallenge.cpp
+ * 每日挑战文件实现
+ */
+
+#include "DailyChallenge.h"
+#include "core/rules/CompactGameState.h"
+#include "core/verify/Sha256.h"
+#include <fstream>
+#include <sstream>
+#include <string.h>
+
+const char DailyChallengeFile::FILE_MAGIC[4] = { 'C', 'D', 'L', 'Y' };
+const uint16_t DailyChallengeFile::FILE_VERSION;
+const uint8_t DailyChallengeFile::MOVE_DRAW_CODE;
+
+static void appendUint8(std::string& buffer, uint8_t value)
+{
+    buffer.push_back(static_cast<char>(value));
+}
+
+static void appendUint16(std::string& buffer, uint16_t value)
+{
+    appendUint8(buffer, static_cast<uint8_t>(value & 0xFF));
+    appendUint8(buffer, static_cast<uint8_t>(value >> 8));
+}
+
+static void appendUint32(std::string& buffer, uint32_t value)
+{
+    appendUint16(buffer, static_cast<uint16_t>(value & 0xFFFF));
+    appendUint16(buffer, static_cast<uint16_t>(value >> 16));
+}
+
+static void appendUint64(std::string& buffer, uint64_t value)
+{
+    appendUint32(buffer, static_cast<uint32_t>(value));
+    appendUint32(buffer, static_cast<uint32_t>(value >> 32));
+}
+
+/**
+ * 顺序读取小端数据，越界后所有读取返回0并标记失败
+ */
+class ChallengeReader
+{
+public:
+    ChallengeReader(const uint8_t* data, size_t size) : _data(data), _size(size), _offset(0), _failed(false) {}
+    
+    uint8_t readUint8()
+    {
+        if (_offset + 1 > _size) {
+            _failed = true;
+            return 0;
+        }
+        return _data[_offset++];
+    }
+    
+    uint16_t readUint16()
+    {
+        uint16_t low = readUint8();
+        uint16_t high = readUint8();
+        return static_cast<uint16_t>(low | (high << 8));
+    }
+    
+    uint32_t readUint32()
+    {
+        uint32_t low = readUint16();
+        uint32_t high = readUint16();
+        return low | (high << 16);
+    }
+    
+    uint64_t readUint64()
+    {
+        uint64_t low = readUint32();
+        uint64_t high = readUint32();
+        return low | (high << 32);
+    }
+    
+    bool failed() const { return _failed; }
+    bool atEnd() const { return _offset == _size; }
+    
+private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _offset;
+    bool _failed;
+};
+
+bool DailyChallengeFile::write(const DailyChallenge& challenge, const std::string& key, std::ostream& output)
+{
+    if (challenge.templateSpec.size() > 255 || challenge.solution.size() > 0xFFFF
+        || challenge.parDraws < 0 || challenge.parDraws > 0xFFFF || challenge.parMoves < 0 || challenge.parMoves > 0xFFFF
+        || challenge.shuffle.mode < 0 || challenge.shuffle.mode >= DSM_COUNT
+        || challenge.shuffle.deckCount < 0 || challenge.shuffle.deckCount > 255) {
+        return false;
+    }
+    
+    std::string buffer(FILE_MAGIC, 4);
+    appendUint16(buffer, FILE_VERSION);
+    appendUint32(buffer, challenge.date);
+    appendUint64(buffer, challenge.seed);
+    appendUint32(buffer, challenge.candidate);
+    appendUint8(buffer, static_cast<uint8_t>(challenge.shuffle.mode));
+    appendUint8(buffer, static_cast<uint8_t>(challenge.shuffle.deckCount));
+    appendUint8(buffer, static_cast<uint8_t>(challenge.templateSpec.size()));
+    buffer += challenge.templateSpec;
+    appendUint16(buffer, static_cast<uint16_t>(challenge.parDraws));
+    appendUint16(buffer, static_cast<uint16_t>(challenge.parMoves));
+    float difficulty = challenge.difficulty < 0.0f ? 0.0f : (challenge.difficulty > 1.0f ? 1.0f : challenge.difficulty);
+    appendUint16(buffer, static_cast<uint16_t>(difficulty * 65535.0f + 0.5f));
+    appendUint16(buffer, static_cast<uint16_t>(challenge.solution.size()));
+    for (auto move : challenge.solution) {
+        if (move != CompactGameState::MOVE_DRAW && (move < 0 || move >= MOVE_DRAW_CODE)) {
+            return false;
+        }
+        appendUint8(buffer, move == CompactGameState::MOVE_DRAW ? MOVE_DRAW_CODE : static_cast<uint8_t>(move));
+    }
+    
+    uint8_t mac[Sha256::DIGEST_SIZE];
+    Sha256::hmac(key.data(), key.size(), buffer.data(), buffer.size(), mac);
+    buffer.append(reinterpret_cast<const char*>(mac), Sha256::DIGEST_SIZE);
+    
+    output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    return static_cast<bool>(output);
+}
+
+bool DailyChallengeFile::parseFromBuffer(const char* data, size_t size, const std::string& key, DailyChallenge& challenge)
+{
+    if (!data || size < 4 + Sha256::DIGEST_SIZE || memcmp(data, FILE_MAGIC, 4) != 0) {
+        return false;
+    }
+    
+    // 先校验签名，之后的内容才可信
+    size_t bodySize = size - Sha256::DIGEST_SIZE;
+    uint8_t mac[Sha256::DIGEST_SIZE];
+    Sha256::hmac(key.data(), key.size(), data, bodySize, mac);
+    if (!Sha256::equalDigests(mac, reinterpret_cast<const uint8_t*>(data + bodySize))) {
+        return false;
+    }
+    
+    ChallengeReader reader(reinterpret_cast<const uint8_t*>(data + 4), bodySize - 4);
+    if (reader.readUint16() != FILE_VERSION) {
+        return false;
+    }
+    
+    DailyChallenge parsed;
+    parsed.date = reader.readUint32();
+    parsed.seed = reader.readUint64();
+    parsed.candidate = reader.readUint32();
+    parsed.shuffle.mode = reader.readUint8();
+    parsed.shuffle.deckCount = reader.readUint8();
+    int specLength = reader.readUint8();
+    for (int i = 0; i < specLength; i++) {
+        parsed.templateSpec.push_back(static_cast<char>(reader.readUint8()));
+    }
+    parsed.parDraws = reader.readUint16();
+    parsed.parMoves = reader.readUint16();
+    parsed.difficulty = reader.readUint16() / 65535.0f;
+    int solutionLength = reader.readUint16();
+    for (int i = 0; i < solutionLength && !reader.failed(); i++) {
+        uint8_t code = reader.readUint8();
+        parsed.solution.push_back(code == MOVE_DRAW_CODE ? CompactGameState::MOVE_DRAW : static_cast<int32_t>(code));
+    }
+    
+    if (reader.failed() || !reader.atEnd() || parsed.shuffle.mode >= DSM_COUNT) {
+        return false;
+    }
+    
+    challenge = parsed;
+    return true;
+}
+
+bool DailyChallengeFile::loadFromFile(const std::string& filePath, const std::string& key, DailyChallenge& challenge)
+{
+    std::ifstream file(filePath.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    
+    std::ostringstream content;
+    content << file.rdbuf();
+    std::string data = content.str();
+    
+    return parseFromBuffer(data.data(), data.size(), key, challenge);
+}
+
+bool DailyChallengeFile::expand(const DailyChallenge& challenge, LevelConfig& levelConfig)
+{
+    LevelTemplate levelTemplate;
+    if (!LevelTemplate::parseSpec(challenge.templateSpec, levelTemplate)) {
+        return false;
+    }
+    return DealShuffler::shuffleLevel(levelTemplate, challenge.seed, challenge.shuffle, levelConfig);
+}
+
+bool DailyChallengeFile::verifySolution(const DailyChallenge& challenge)
+{
+    LevelConfig levelConfig;
+    CompactDeal deal;
+    if (!expand(challenge, levelConfig) || !deal.initWithLevelConfig(&levelConfig)) {
+        return false;
+    }
+    
+    CompactGameState state;
+    state.reset(&deal);
+    int draws = 0;
+    for (auto move : challenge.solution) {
+        if (!state.applyMove(move)) {
+            return false;
+        }
+        if (move == CompactGameState::MOVE_DRAW) {
+            draws++;
+        }
+    }
+    
+    return state.isGameWon() && draws == challenge.parDraws
+        && static_cast<int>(challenge.solution.size()) == challenge.parMoves;
+}
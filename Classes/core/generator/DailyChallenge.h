@@ -0,0 +1,103 @@
+/**
+ * DailyChallenge.h
+ * 每日挑战：带签名的紧凑挑战文件，牌局由种子展开，内含已验证的标准杆解法
+ */
+
+#ifndef __DAILY_CHALLENGE_H__
+#define __DAILY_CHALLENGE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include <ostream>
+#include "DealShuffler.h"
+#include "configs/models/LevelConfig.h"
+
+/**
+ * 每日挑战
+ */
+struct DailyChallenge
+{
+    uint32_t date;                      // 日期（YYYYMMDD）
+    std::string templateSpec;           // 布局模板描述串（LevelTemplate::parseSpec）
+    DealShuffleParams shuffle;          // 发牌参数
+    uint64_t seed;                      // 展开牌局的种子
+    uint32_t candidate;                 // 当天的候选序号
+    int parDraws;                       // 标准杆：最少抽牌次数
+    int parMoves;                       // 标准杆：最少操作数
+    float difficulty;                   // 难度（随机对局的失败率，0-1）
+    std::vector<int32_t> solution;      // 达到标准杆的操作序列（主牌区下标或MOVE_DRAW）
+    
+    DailyChallenge()
+        : date(0)
+        , seed(0)
+        , candidate(0)
+        , parDraws(-1)
+        , parMoves(-1)
+        , difficulty(0.0f)
+    {}
+};
+
+/**
+ * 每日挑战文件
+ * 格式（小端）：
+ *   "CDLY" 版本(u16) 日期(u32) 种子(u64) 候选序号(u32)
+ *   发牌方式(u8) 牌副数(u8) 模板描述串长度(u8) 模板描述串
+ *   最少抽牌次数(u16) 最少操作数(u16) 难度(u16，乘以65535)
+ *   解法长度(u16) 解法（每步u8，0xFF为抽牌，其余为主牌区下标）
+ *   HMAC-SHA256(32字节，覆盖之前的全部内容)
+ * 文件不保存卡牌，加载后用模板与种子重新展开，再重放解法校验
+ */
+class DailyChallengeFile
+{
+public:
+    static const char FILE_MAGIC[4];            // 文件标识
+    static const uint16_t FILE_VERSION = 1;     // 格式版本
+    static const uint8_t MOVE_DRAW_CODE = 0xFF; // 解法中抽牌的编码
+    
+    /**
+     * 编码并签名
+     * @param challenge 挑战
+     * @param key 签名密钥
+     * @param output 输出流
+     * @return 字段超出格式范围时返回false
+     */
+    static bool write(const DailyChallenge& challenge, const std::string& key, std::ostream& output);
+    
+    /**
+     * 从内存解析，签名不符时拒绝
+     * @param data 数据
+     * @param size 数据长度
+     * @param key 签名密钥
+     * @param challenge 输出的挑战
+     * @return 是否解析成功
+     */
+    static bool parseFromBuffer(const char* data, size_t size, const std::string& key, DailyChallenge& challenge);
+    
+    /**
+     * 从文件加载，签名不符时拒绝
+     * @param filePath 文件路径
+     * @param key 签名密钥
+     * @param challenge 输出的挑战
+     * @return 是否加载成功
+     */
+    static bool loadFromFile(const std::string& filePath, const std::string& key, DailyChallenge& challenge);
+    
+    /**
+     * 展开挑战的牌局
+     * @param challenge 挑战
+     * @param levelConfig 输出的关卡配置
+     * @return 是否展开成功
+     */
+    static bool expand(const DailyChallenge& challenge, LevelConfig& levelConfig);
+    
+    /**
+     * 展开牌局并重放解法，检查能通关且步数与标准杆一致
+     * @param challenge 挑战
+     * @return 校验是否通过
+     */
+    static bool verifySolution(const DailyChallenge& challenge);
+};
+
+#endif // __DAILY_CHALLENGE_H__
@@ -0,0 +1,167 @@
+/**
+ * DailyChallengeBuilder.cpp
+ * 每日挑战生成器实现
+ */
+
+#include "DailyChallengeBuilder.h"
+#include "core/CoreMacros.h"
+#include "core/rules/PlayoutBatch.h"
+#include "core/solver/ParSolver.h"
+#include "services/GameModelFromLevelGenerator.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <stdio.h>
+
+bool DailyChallengeBuilder::parseDate(const std::string& text, uint32_t& date)
+{
+    int year = 0, month = 0, day = 0;
+    char tail = 0;
+    if (sscanf(text.c_str(), "%4d-%2d-%2d%c", &year, &month, &day, &tail) != 3) {
+        return false;
+    }
+    
+    static const int DAYS_IN_MONTH[12] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    if (year < 1 || month < 1 || month > 12 || day < 1 || day > DAYS_IN_MONTH[month - 1]
+        || (month == 2 && day == 29 && !leap)) {
+        return false;
+    }
+    
+    date = static_cast<uint32_t>(year * 10000 + month * 100 + day);
+    return true;
+}
+
+uint64_t DailyChallengeBuilder::seedForDate(uint32_t date, uint64_t salt)
+{
+    uint32_t counter[4] = { date, 0, 0, 0 };
+    uint32_t key[2] = { static_cast<uint32_t>(salt), static_cast<uint32_t>(salt >> 32) };
+    uint32_t output[4];
+    PhiloxRandom::generateBlock(counter, key, output);
+    return output[0] | (static_cast<uint64_t>(output[1]) << 32);
+}
+
+uint64_t DailyChallengeBuilder::seedForCandidate(uint64_t dateSeed, uint32_t candidate)
+{
+    uint32_t counter[4] = { candidate, 1, 0, 0 };
+    uint32_t key[2] = { static_cast<uint32_t>(dateSeed), static_cast<uint32_t>(dateSeed >> 32) };
+    uint32_t output[4];
+    PhiloxRandom::generateBlock(counter, key, output);
+    return output[0] | (static_cast<uint64_t>(output[1]) << 32);
+}
+
+bool DailyChallengeBuilder::build(uint32_t date, const DailyChallengeOptions& options, DailyChallenge& challenge,
+                                  DailyChallengeStats* stats)
+{
+    LevelTemplate levelTemplate;
+    if (!LevelTemplate::parseSpec(options.templateSpec, levelTemplate) || options.maxCandidates <= 0) {
+        return false;
+    }
+    
+    int threadCount = options.threadCount;
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) {
+            threadCount = 1;
+        }
+    }
+    
+    uint64_t dateSeed = seedForDate(date, options.salt);
+    std::atomic<uint32_t> nextCandidate(0);
+    std::atomic<uint32_t> bestCandidate(static_cast<uint32_t>(options.maxCandidates));
+    std::atomic<uint32_t> evaluated(0), outOfDifficulty(0), unsolvable(0), nodeLimited(0), outOfPar(0);
+    std::atomic<uint64_t> nodes(0);
+    std::mutex resultMutex;
+    DailyChallenge best;
+    
+    auto worker = [&]() {
+        ParSolver solver;
+        if (!solver.init(options.tableBits)) {
+            return;
+        }
+        
+        while (true) {
+            // 序号比已找到的结果大的候选不再需要
+            uint32_t candidate = nextCandidate.fetch_add(1, std::memory_order_relaxed);
+            if (candidate >= bestCandidate.load(std::memory_order_relaxed)) {
+                return;
+            }
+            evaluated.fetch_add(1, std::memory_order_relaxed);
+            
+            // 与客户端相同的展开路径：模板 + 种子 -> 关卡配置 -> 游戏模型
+            uint64_t seed = seedForCandidate(dateSeed, candidate);
+            LevelConfig levelConfig;
+            CompactDeal deal;
+            if (!DealShuffler::shuffleLevel(levelTemplate, seed, options.shuffle, levelConfig)
+                || !deal.initWithLevelConfig(&levelConfig)) {
+                continue;
+            }
+            GameModel* gameModel = GameModelFromLevelGenerator::generateGameModel(&levelConfig);
+            if (!gameModel) {
+                continue;
+            }
+            CORE_SAFE_DELETE(gameModel);
+            
+            float difficulty = 1.0f - PlayoutBatch::estimateWinRate<DefaultRule>(deal, options.playouts, seed);
+            if (difficulty < options.minDifficulty || difficulty > options.maxDifficulty) {
+                outOfDifficulty.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            
+            ParResult result;
+            solver.solve(deal, result, options.nodeLimit);
+            nodes.fetch_add(result.nodes, std::memory_order_relaxed);
+            if (result.status == PS_UNSOLVABLE) {
+                unsolvable.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            if (result.status != PS_OPTIMAL) {
+                nodeLimited.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            if (result.parDraws < options.minParDraws || result.parDraws > options.maxParDraws) {
+                outOfPar.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            
+            std::lock_guard<std::mutex> lock(resultMutex);
+            if (candidate < bestCandidate.load(std::memory_order_relaxed)) {
+                best.candidate = candidate;
+                best.seed = seed;
+                best.parDraws = result.parDraws;
+                best.parMoves = result.parMoves;
+                best.difficulty = difficulty;
+                best.solution = result.line;
+                bestCandidate.store(candidate, std::memory_order_relaxed);
+            }
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; i++) {
+        threads.push_back(std::thread(worker));
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    if (stats) {
+        stats->candidates = evaluated.load();
+        stats->outOfDifficulty = outOfDifficulty.load();
+        stats->unsolvable = unsolvable.load();
+        stats->nodeLimited = nodeLimited.load();
+        stats->outOfPar = outOfPar.load();
+        stats->nodes = nodes.load();
+    }
+    
+    if (bestCandidate.load() >= static_cast<uint32_t>(options.maxCandidates)) {
+        return false;
+    }
+    
+    best.date = date;
+    best.templateSpec = options.templateSpec;
+    best.shuffle = options.shuffle;
+    challenge = best;
+    return true;
+}
@@ -0,0 +1,110 @@
+/**
+ * DailyChallengeBuilder.h
+ * 每日挑战生成：按日期得到种子，并行展开、求解候选牌局，取第一个满足难度范围的牌局
+ */
+
+#ifndef __DAILY_CHALLENGE_BUILDER_H__
+#define __DAILY_CHALLENGE_BUILDER_H__
+
+#include <stdint.h>
+#include <string>
+#include "DailyChallenge.h"
+
+/**
+ * 生成参数
+ */
+struct DailyChallengeOptions
+{
+    std::string templateSpec;   // 布局模板描述串
+    DealShuffleParams shuffle;  // 发牌参数
+    uint64_t salt;              // 种子盐值，换盐值得到另一套每日序列
+    float minDifficulty;        // 难度下限
+    float maxDifficulty;        // 难度上限
+    int minParDraws;            // 标准杆抽牌次数下限
+    int maxParDraws;            // 标准杆抽牌次数上限
+    int playouts;               // 估计难度时的随机对局数
+    int threadCount;            // 线程数，为0时使用CPU核心数
+    int maxCandidates;          // 最多尝试的候选牌局数
+    int tableBits;              // 每个线程的标准杆求解置换表位数
+    uint64_t nodeLimit;         // 每个候选的求解节点上限
+    
+    DailyChallengeOptions()
+        : templateSpec("grid:4x5:24")
+        , salt(0x4441494C59ull)
+        , minDifficulty(0.6f)
+        , maxDifficulty(0.95f)
+        , minParDraws(4)
+        , maxParDraws(12)
+        , playouts(512)
+        , threadCount(0)
+        , maxCandidates(4096)
+        , tableBits(18)
+        , nodeLimit(2000000)
+    {}
+};
+
+/**
+ * 生成统计
+ */
+struct DailyChallengeStats
+{
+    uint32_t candidates;        // 完成评估的候选数
+    uint32_t outOfDifficulty;   // 难度不在范围内的候选数
+    uint32_t unsolvable;        // 无解的候选数
+    uint32_t nodeLimited;       // 达到节点上限的候选数
+    uint32_t outOfPar;          // 标准杆不在范围内的候选数
+    uint64_t nodes;             // 求解节点总数
+    
+    DailyChallengeStats()
+        : candidates(0)
+        , outOfDifficulty(0)
+        , unsolvable(0)
+        , nodeLimited(0)
+        , outOfPar(0)
+        , nodes(0)
+    {}
+};
+
+/**
+ * 每日挑战生成器类
+ * 第i个候选的种子由（日期，盐值，i）决定，候选经GameModelFromLevelGenerator展开并检查能生成游戏模型，
+ * 先用批量随机对局筛选难度，再用ParSolver求最优标准杆。多个线程按序号领取候选，
+ * 结果取满足条件的最小序号，与线程数和调度无关；所有更小序号都评估完后立即停止
+ */
+class DailyChallengeBuilder
+{
+public:
+    /**
+     * 解析日期
+     * @param text YYYY-MM-DD
+     * @param date 输出YYYYMMDD
+     * @return 格式或日期无效时返回false
+     */
+    static bool parseDate(const std::string& text, uint32_t& date);
+    
+    /**
+     * 由日期得到当天的基础种子
+     * @param date 日期（YYYYMMDD）
+     * @param salt 盐值
+     * @return 种子
+     */
+    static uint64_t seedForDate(uint32_t date, uint64_t salt);
+    
+    /**
+     * 由基础种子得到第candidate个候选的种子
+     */
+    static uint64_t seedForCandidate(uint64_t dateSeed, uint32_t candidate);
+    
+    /**
+     * 生成当天的挑战
+     * @param date 日期（YYYYMMDD）
+     * @param options 生成参数
+     * @param challenge 输出的挑战
+     * @param stats 输出的统计，可为nullptr
+     * @return 在候选上限内找到满足条件的牌局时返回true
+     */
+    static bool build(uint32_t date, const DailyChallengeOptions& options, DailyChallenge& challenge,
+                      DailyChallengeStats* stats);
+};
+
+#endif // __DAILY_CHALLENGE_BUILDER_H__
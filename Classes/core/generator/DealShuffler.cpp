@@ -0,0 +1,195 @@
+/**
+ * DealShuffler.cpp
+ * 确定性发牌服务实现
+ */
+
+#include "DealShuffler.h"
+#include "ReverseDealBuilder.h"
+#include "core/rules/CardRules.h"
+
+// Philox4x32的乘数与密钥增量（Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3"）
+static const uint32_t PHILOX_M0 = 0xD2511F53u;
+static const uint32_t PHILOX_M1 = 0xCD9E8D57u;
+static const uint32_t PHILOX_W0 = 0x9E3779B9u;
+static const uint32_t PHILOX_W1 = 0xBB67AE85u;
+static const int PHILOX_ROUNDS = 10;
+
+PhiloxRandom::PhiloxRandom(uint64_t seed, uint64_t stream)
+: _bufferIndex(4)
+{
+    _key[0] = static_cast<uint32_t>(seed);
+    _key[1] = static_cast<uint32_t>(seed >> 32);
+    _counter[0] = 0;
+    _counter[1] = 0;
+    _counter[2] = static_cast<uint32_t>(stream);
+    _counter[3] = static_cast<uint32_t>(stream >> 32);
+}
+
+uint32_t PhiloxRandom::nextBelow(uint32_t bound)
+{
+    uint64_t product = static_cast<uint64_t>(nextUint32()) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < bound) {
+        // 2^32 mod bound，落在这一段的结果会引入偏差，重新抽取
+        uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            product = static_cast<uint64_t>(nextUint32()) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+void PhiloxRandom::generateBlock(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4])
+{
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+        uint64_t product0 = static_cast<uint64_t>(PHILOX_M0) * c0;
+        uint64_t product1 = static_cast<uint64_t>(PHILOX_M1) * c2;
+        uint32_t next0 = static_cast<uint32_t>(product1 >> 32) ^ c1 ^ k0;
+        uint32_t next2 = static_cast<uint32_t>(product0 >> 32) ^ c3 ^ k1;
+        c1 = static_cast<uint32_t>(product1);
+        c3 = static_cast<uint32_t>(product0);
+        c0 = next0;
+        c2 = next2;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    
+    output[0] = c0;
+    output[1] = c1;
+    output[2] = c2;
+    output[3] = c3;
+}
+
+void PhiloxRandom::refill()
+{
+    generateBlock(_counter, _key, _buffer);
+    _bufferIndex = 0;
+    
+    // 块序号为64位，进位到第二个字
+    if (++_counter[0] == 0) {
+        _counter[1]++;
+    }
+}
+
+bool DealShuffler::shuffleCards(int cardCount, uint64_t seed, const DealShuffleParams& params, uint8_t* faces, uint8_t* suits)
+{
+    if (cardCount <= 0 || !faces || !suits) {
+        return false;
+    }
+    
+    PhiloxRandom random(seed, 0);
+    
+    if (params.mode == DSM_UNIFORM) {
+        // 一次抽取同时决定面值与花色
+        for (int i = 0; i < cardCount; i++) {
+            uint32_t card = random.nextBelow(DECK_SIZE);
+            faces[i] = static_cast<uint8_t>(card % CardRules::NUM_CARD_VALUES);
+            suits[i] = static_cast<uint8_t>(card / CardRules::NUM_CARD_VALUES);
+        }
+        return true;
+    }
+    
+    if (params.mode != DSM_DECK) {
+        return false;
+    }
+    
+    int deckCount = params.deckCount > 0 ? params.deckCount : (cardCount + DECK_SIZE - 1) / DECK_SIZE;
+    if (deckCount > MAX_DECK_COUNT || cardCount > deckCount * DECK_SIZE) {
+        return false;
+    }
+    
+    // 只洗出需要的前cardCount张（Fisher-Yates只执行前cardCount步）
+    uint8_t deck[DECK_SIZE * MAX_DECK_COUNT];
+    int deckSize = deckCount * DECK_SIZE;
+    for (int d = 0; d < deckCount; d++) {
+        for (int c = 0; c < DECK_SIZE; c++) {
+            deck[d * DECK_SIZE + c] = static_cast<uint8_t>(c);
+        }
+    }
+    for (int i = 0; i < cardCount; i++) {
+        int pick = i + static_cast<int>(random.nextBelow(static_cast<uint32_t>(deckSize - i)));
+        uint8_t card = deck[pick];
+        deck[pick] = deck[i];
+        deck[i] = card;
+        faces[i] = static_cast<uint8_t>(card % CardRules::NUM_CARD_VALUES);
+        suits[i] = static_cast<uint8_t>(card / CardRules::NUM_CARD_VALUES);
+    }
+    return true;
+}
+
+bool DealShuffler::shuffleDeal(int playfieldCount, int stackCount, uint64_t seed, const DealShuffleParams& params,
+                               CompactDeal& deal)
+{
+    if (playfieldCount < 0 || stackCount <= 0) {
+        return false;
+    }
+    
+    int cardCount = playfieldCount + stackCount;
+    std::vector<uint8_t> faces(cardCount), suits(cardCount);
+    if (!shuffleCards(cardCount, seed, params, faces.data(), suits.data())) {
+        return false;
+    }
+    
+    return deal.init(std::vector<uint8_t>(faces.begin(), faces.begin() + playfieldCount),
+                     std::vector<uint8_t>(suits.begin(), suits.begin() + playfieldCount),
+                     std::vector<uint8_t>(faces.begin() + playfieldCount, faces.end()),
+                     std::vector<uint8_t>(suits.begin() + playfieldCount, suits.end()));
+}
+
+bool DealShuffler::shuffleLevel(const LevelTemplate& levelTemplate, uint64_t seed, const DealShuffleParams& params,
+                                LevelConfig& levelConfig)
+{
+    if (levelTemplate.stackCount <= 0) {
+        return false;
+    }
+    
+    if (params.mode == DSM_SOLVABLE) {
+        std::vector<int32_t> solution;
+        return ReverseDealBuilder::build(levelTemplate, seed, levelConfig, solution);
+    }
+    
+    int playfieldCount = static_cast<int>(levelTemplate.positions.size());
+    int cardCount = playfieldCount + levelTemplate.stackCount;
+    std::vector<uint8_t> faces(cardCount), suits(cardCount);
+    if (!shuffleCards(cardCount, seed, params, faces.data(), suits.data())) {
+        return false;
+    }
+    
+    std::vector<CardConfig> playfieldCards(playfieldCount);
+    for (int i = 0; i < playfieldCount; i++) {
+        playfieldCards[i].cardFace = faces[i];
+        playfieldCards[i].cardSuit = suits[i];
+        playfieldCards[i].position = levelTemplate.positions[i];
+    }
+    
+    std::vector<CardConfig> stackCards(levelTemplate.stackCount);
+    for (int i = 0; i < levelTemplate.stackCount; i++) {
+        stackCards[i].cardFace = faces[playfieldCount + i];
+        stackCards[i].cardSuit = suits[playfieldCount + i];
+    }
+    
+    levelConfig.setPlayfieldCards(playfieldCards);
+    levelConfig.setStackCards(stackCards);
+    return true;
+}
+
+bool DealShuffler::parseMode(const std::string& name, int& mode)
+{
+    for (int m = 0; m < DSM_COUNT; m++) {
+        if (name == getModeName(m)) {
+            mode = m;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* DealShuffler::getModeName(int mode)
+{
+    static const char* NAMES[DSM_COUNT] = { "deck", "uniform", "solvable" };
+    return mode >= 0 && mode < DSM_COUNT ? NAMES[mode] : "unknown";
+}
@@ -0,0 +1,152 @@
+/**
+ * DealShuffler.h
+ * 按种子确定性发牌：计数器型随机数（Philox4x32-10）与洗牌服务
+ */
+
+#ifndef __DEAL_SHUFFLER_H__
+#define __DEAL_SHUFFLER_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "LevelTemplate.h"
+#include "configs/models/LevelConfig.h"
+#include "core/rules/CompactDeal.h"
+
+/**
+ * Philox4x32-10计数器型随机数
+ * 输出只由（种子，流号，块序号）决定，每块4个32位数；只用32位整数乘法、异或与加法，
+ * 不依赖标准库分布的实现，各平台、各编译器结果一致。不同流号的序列互不相关，可以按对局并行生成
+ */
+class PhiloxRandom
+{
+public:
+    /**
+     * 创建随机数流
+     * @param seed 种子（作为密钥）
+     * @param stream 流号（计数器高64位）
+     */
+    PhiloxRandom(uint64_t seed, uint64_t stream);
+    
+    /**
+     * 获取下一个32位随机数
+     */
+    uint32_t nextUint32()
+    {
+        if (_bufferIndex == 4) {
+            refill();
+        }
+        return _buffer[_bufferIndex++];
+    }
+    
+    /**
+     * 获取[0, bound)内均匀分布的随机数（乘法取高位，拒绝偏差区间）
+     * @param bound 上界，必须大于0
+     */
+    uint32_t nextBelow(uint32_t bound);
+    
+    /**
+     * 计算一个块：10轮Philox4x32
+     * @param counter 计数器（4个字）
+     * @param key 密钥（2个字）
+     * @param output 输出4个32位数
+     */
+    static void generateBlock(const uint32_t counter[4], const uint32_t key[2], uint32_t output[4]);
+    
+private:
+    /**
+     * 生成下一块
+     */
+    void refill();
+    
+    uint32_t _key[2];           // 密钥
+    uint32_t _counter[4];       // 计数器：低64位为块序号，高64位为流号
+    uint32_t _buffer[4];        // 当前块
+    int _bufferIndex;           // 当前块读取位置
+};
+
+/**
+ * 发牌方式
+ */
+enum DealShuffleMode
+{
+    DSM_DECK = 0,       // 若干副52张的牌洗匀后依次发到主牌区与备用牌堆
+    DSM_UNIFORM,        // 每张卡牌的面值、花色独立均匀随机
+    DSM_SOLVABLE,       // 倒推发牌（ReverseDealBuilder），必然可解
+    DSM_COUNT
+};
+
+/**
+ * 发牌参数
+ */
+struct DealShuffleParams
+{
+    int mode;           // 发牌方式（DealShuffleMode）
+    int deckCount;      // DSM_DECK使用的牌副数，为0时按需要的张数取最少副数
+    
+    DealShuffleParams()
+        : mode(DSM_DECK)
+        , deckCount(0)
+    {}
+};
+
+/**
+ * 确定性发牌服务
+ * 关卡可以只用（布局模板，种子，发牌参数）描述，加载时展开成完整的关卡配置。
+ * 主牌区按模板位置顺序发牌，其后是备用牌堆（最后一张为开局翻到手牌区的牌）
+ */
+class DealShuffler
+{
+public:
+    static const int DECK_SIZE = 52;        // 一副牌的张数
+    static const int MAX_DECK_COUNT = 8;    // DSM_DECK最多使用的牌副数
+    
+    /**
+     * 生成卡牌面值与花色（DSM_DECK / DSM_UNIFORM），不分配内存，用于大批量模拟
+     * @param cardCount 总张数（主牌区 + 备用牌堆）
+     * @param seed 种子
+     * @param params 发牌参数
+     * @param faces 输出面值（CardFaceType），cardCount项
+     * @param suits 输出花色（CardSuitType），cardCount项
+     * @return 参数无效（如张数超过牌副数）时返回false
+     */
+    static bool shuffleCards(int cardCount, uint64_t seed, const DealShuffleParams& params, uint8_t* faces, uint8_t* suits);
+    
+    /**
+     * 生成紧凑牌局（DSM_DECK / DSM_UNIFORM）
+     * @param playfieldCount 主牌区张数
+     * @param stackCount 备用牌堆张数
+     * @param seed 种子
+     * @param params 发牌参数
+     * @param deal 输出的牌局
+     * @return 是否生成成功
+     */
+    static bool shuffleDeal(int playfieldCount, int stackCount, uint64_t seed, const DealShuffleParams& params,
+                            CompactDeal& deal);
+    
+    /**
+     * 按布局模板展开关卡
+     * @param levelTemplate 布局模板
+     * @param seed 种子
+     * @param params 发牌参数
+     * @param levelConfig 输出的关卡配置
+     * @return 是否展开成功
+     */
+    static bool shuffleLevel(const LevelTemplate& levelTemplate, uint64_t seed, const DealShuffleParams& params,
+                             LevelConfig& levelConfig);
+    
+    /**
+     * 按名称解析发牌方式（deck / uniform / solvable）
+     * @param name 名称
+     * @param mode 输出的发牌方式
+     * @return 名称无效时返回false
+     */
+    static bool parseMode(const std::string& name, int& mode);
+    
+    /**
+     * 获取发牌方式名称
+     */
+    static const char* getModeName(int mode);
+};
+
+#endif // __DEAL_SHUFFLER_H__
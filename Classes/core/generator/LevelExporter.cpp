@@ -0,0 +1,98 @@
+/**
+ * LevelExporter.cpp
+ * 关卡导出实现
+ */
+
+#include "LevelExporter.h"
+#include "configs/loaders/LevelPackLoader.h"
+#include <stdio.h>
+
+/**
+ * 写入一张卡牌的JSON对象
+ */
+static void writeCardJson(const CardConfig& card, bool last, std::ostream& output)
+{
+    char position[64];
+    snprintf(position, sizeof(position), "{\"x\": %g, \"y\": %g}", card.position.x, card.position.y);
+    
+    output << "        {\n"
+           << "            \"CardFace\": " << card.cardFace << ",\n"
+           << "            \"CardSuit\": " << card.cardSuit << ",\n"
+           << "            \"Position\": " << position << "\n"
+           << "        }" << (last ? "\n" : ",\n");
+}
+
+static void writeUint16(std::ostream& output, uint16_t value)
+{
+    char bytes[2] = { static_cast<char>(value & 0xFF), static_cast<char>(value >> 8) };
+    output.write(bytes, 2);
+}
+
+static void writeUint32(std::ostream& output, uint32_t value)
+{
+    writeUint16(output, static_cast<uint16_t>(value & 0xFFFF));
+    writeUint16(output, static_cast<uint16_t>(value >> 16));
+}
+
+void LevelExporter::writeJson(const LevelConfig& levelConfig, const LevelMetadata* metadata, std::ostream& output)
+{
+    const auto& playfieldCards = levelConfig.getPlayfieldCards();
+    const auto& stackCards = levelConfig.getStackCards();
+    
+    output << "{\n    \"Playfield\": [\n";
+    for (size_t i = 0; i < playfieldCards.size(); i++) {
+        writeCardJson(playfieldCards[i], i + 1 == playfieldCards.size(), output);
+    }
+    output << "    ],\n    \"Stack\": [\n";
+    for (size_t i = 0; i < stackCards.size(); i++) {
+        writeCardJson(stackCards[i], i + 1 == stackCards.size(), output);
+    }
+    output << "    ]";
+    
+    if (metadata) {
+        char hash[32];
+        snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(metadata->hash));
+        output << ",\n    \"Meta\": {\n"
+               << "        \"Hash\": \"" << hash << "\",\n";
+        if (metadata->difficulty >= 0.0f) {
+            output << "        \"Difficulty\": " << metadata->difficulty << ",\n";
+        }
+        if (metadata->parDraws >= 0) {
+            output << "        \"ParDraws\": " << metadata->parDraws << ",\n"
+                   << "        \"ParMoves\": " << metadata->parMoves << ",\n";
+        }
+        output << "        \"Solution\": [";
+        for (size_t i = 0; i < metadata->solution.size(); i++) {
+            output << (i == 0 ? "" : ", ") << metadata->solution[i];
+        }
+        output << "]\n    }";
+    }
+    
+    output << "\n}\n";
+}
+
+void LevelExporter::writePack(const std::vector<const LevelConfig*>& levelConfigs, std::ostream& output)
+{
+    output.write(LevelPackLoader::PACK_MAGIC, 4);
+    writeUint16(output, LevelPackLoader::PACK_VERSION);
+    writeUint32(output, static_cast<uint32_t>(levelConfigs.size()));
+    
+    for (auto levelConfig : levelConfigs) {
+        const auto& playfieldCards = levelConfig->getPlayfieldCards();
+        const auto& stackCards = levelConfig->getStackCards();
+        
+        writeUint16(output, static_cast<uint16_t>(playfieldCards.size()));
+        writeUint16(output, static_cast<uint16_t>(stackCards.size()));
+        
+        for (const auto& card : playfieldCards) {
+            output.put(static_cast<char>(card.cardFace));
+            output.put(static_cast<char>(card.cardSuit));
+            writeUint16(output, static_cast<uint16_t>(static_cast<int16_t>(card.position.x)));
+            writeUint16(output, static_cast<uint16_t>(static_cast<int16_t>(card.position.y)));
+        }
+        for (const auto& card : stackCards) {
+            output.put(static_cast<char>(card.cardFace));
+            output.put(static_cast<char>(card.cardSuit));
+        }
+    }
+}
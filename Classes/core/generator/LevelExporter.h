@@ -0,0 +1,55 @@
+/**
+ * LevelExporter.h
+ * 关卡导出：LevelConfigLoader可读取的JSON，或LevelPackLoader可读取的紧凑二进制包
+ */
+
+#ifndef __LEVEL_EXPORTER_H__
+#define __LEVEL_EXPORTER_H__
+
+#include <stdint.h>
+#include <ostream>
+#include <vector>
+#include "configs/models/LevelConfig.h"
+
+/**
+ * 关卡附加信息，写入JSON的"Meta"字段，LevelConfigLoader解析时会忽略
+ */
+struct LevelMetadata
+{
+    uint64_t hash;                      // 牌局规范哈希
+    float difficulty;                   // 难度（0-1），小于0时不输出
+    int parDraws;                       // 标准杆：最少抽牌次数，小于0时不输出
+    int parMoves;                       // 标准杆：最少操作数，小于0时不输出
+    std::vector<int32_t> solution;      // 必胜操作序列，-1表示抽牌
+    
+    LevelMetadata()
+        : hash(0)
+        , difficulty(-1.0f)
+        , parDraws(-1)
+        , parMoves(-1)
+    {}
+};
+
+/**
+ * 关卡导出类
+ */
+class LevelExporter
+{
+public:
+    /**
+     * 导出为JSON
+     * @param levelConfig 关卡配置
+     * @param metadata 附加信息，可为nullptr
+     * @param output 输出流
+     */
+    static void writeJson(const LevelConfig& levelConfig, const LevelMetadata* metadata, std::ostream& output);
+    
+    /**
+     * 导出为二进制关卡包，格式见LevelPackLoader
+     * @param levelConfigs 关卡配置列表
+     * @param output 输出流
+     */
+    static void writePack(const std::vector<const LevelConfig*>& levelConfigs, std::ostream& output);
+};
+
+#endif // __LEVEL_EXPORTER_H__
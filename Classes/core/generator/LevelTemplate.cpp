@@ -0,0 +1,59 @@
+/**
+ * LevelTemplate.cpp
+ * 关卡布局模板实现
+ */
+
+#include "LevelTemplate.h"
+#include "configs/models/LevelConfig.h"
+#include <stdio.h>
+
+LevelTemplate LevelTemplate::createGrid(const std::string& name, int rows, int cols, int stackCount)
+{
+    LevelTemplate levelTemplate;
+    levelTemplate.name = name;
+    levelTemplate.stackCount = stackCount;
+    
+    // 在主牌区中均匀排布，卡牌尺寸为182x282
+    const float areaWidth = 1080.0f;
+    const float areaHeight = 1500.0f;
+    float stepX = cols > 1 ? (areaWidth - 2 * 150.0f) / (cols - 1) : 0.0f;
+    float stepY = rows > 1 ? (areaHeight - 2 * 250.0f) / (rows - 1) : 0.0f;
+    
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            float x = cols > 1 ? 150.0f + c * stepX : areaWidth / 2;
+            float y = rows > 1 ? areaHeight - 250.0f - r * stepY : areaHeight / 2;
+            levelTemplate.positions.push_back(CoreVec2(x, y));
+        }
+    }
+    
+    return levelTemplate;
+}
+
+LevelTemplate LevelTemplate::createFromLevelConfig(const std::string& name, const LevelConfig* levelConfig, int stackCount)
+{
+    LevelTemplate levelTemplate;
+    levelTemplate.name = name;
+    
+    if (levelConfig) {
+        for (const auto& card : levelConfig->getPlayfieldCards()) {
+            levelTemplate.positions.push_back(card.position);
+        }
+        levelTemplate.stackCount = stackCount > 0 ? stackCount : static_cast<int>(levelConfig->getStackCards().size());
+    }
+    
+    return levelTemplate;
+}
+
+bool LevelTemplate::parseSpec(const std::string& spec, LevelTemplate& levelTemplate)
+{
+    int rows = 0, cols = 0, stackCount = 0;
+    char tail = 0;
+    if (sscanf(spec.c_str(), "grid:%dx%d:%d%c", &rows, &cols, &stackCount, &tail) != 3
+        || rows <= 0 || cols <= 0 || stackCount <= 0) {
+        return false;
+    }
+    
+    levelTemplate = createGrid(spec, rows, cols, stackCount);
+    return true;
+}
@@ -0,0 +1,56 @@
+/**
+ * LevelTemplate.h
+ * 关卡布局模板，描述主牌区卡牌位置与备用牌堆张数
+ */
+
+#ifndef __LEVEL_TEMPLATE_H__
+#define __LEVEL_TEMPLATE_H__
+
+#include <string>
+#include <vector>
+#include "core/CoreMath.h"
+
+class LevelConfig;
+
+/**
+ * 关卡布局模板
+ */
+struct LevelTemplate
+{
+    std::string name;                   // 模板名称
+    std::vector<CoreVec2> positions;    // 主牌区卡牌位置
+    int stackCount;                     // 备用牌堆张数（含开局翻到手牌区的一张）
+    
+    LevelTemplate()
+        : stackCount(0)
+    {}
+    
+    /**
+     * 创建网格布局模板，位置落在主牌区（1080x1500）中
+     * @param name 模板名称
+     * @param rows 行数
+     * @param cols 列数
+     * @param stackCount 备用牌堆张数
+     * @return 布局模板
+     */
+    static LevelTemplate createGrid(const std::string& name, int rows, int cols, int stackCount);
+    
+    /**
+     * 使用已有关卡的主牌区位置与备用牌堆张数作为模板
+     * @param name 模板名称
+     * @param levelConfig 关卡配置
+     * @param stackCount 备用牌堆张数，为0时沿用关卡的张数
+     * @return 布局模板
+     */
+    static LevelTemplate createFromLevelConfig(const std::string& name, const LevelConfig* levelConfig, int stackCount);
+    
+    /**
+     * 按描述串创建模板，目前支持网格布局 grid:ROWSxCOLS:STACK
+     * @param spec 描述串，同时作为模板名称
+     * @param levelTemplate 输出的布局模板
+     * @return 描述串无效时返回false
+     */
+    static bool parseSpec(const std::string& spec, LevelTemplate& levelTemplate);
+};
+
+#endif // __LEVEL_TEMPLATE_H__
@@ -0,0 +1,86 @@
+/**
+ * ReverseDealBuilder.cpp
+ * 倒推发牌实现
+ */
+
+#include "ReverseDealBuilder.h"
+#include "core/rules/CardRules.h"
+#include "core/rules/CompactGameState.h"
+#include <random>
+#include <algorithm>
+
+bool ReverseDealBuilder::build(const LevelTemplate& levelTemplate, uint64_t seed,
+                               LevelConfig& levelConfig, std::vector<int32_t>& solution)
+{
+    int playfieldCount = static_cast<int>(levelTemplate.positions.size());
+    int drawCount = levelTemplate.stackCount - 1;
+    if (playfieldCount == 0 || drawCount < 0) {
+        return false;
+    }
+    
+    std::mt19937_64 rng(seed);
+    
+    // 主牌区空位，反向出牌时随机填入
+    std::vector<int> freeSlots;
+    for (int i = 0; i < playfieldCount; i++) {
+        freeSlots.push_back(i);
+    }
+    
+    std::vector<CardConfig> playfieldCards(playfieldCount);
+    std::vector<CardConfig> stackCards;
+    std::vector<int32_t> reverseMoves;
+    
+    int trayValue = static_cast<int>(rng() % CardRules::NUM_CARD_VALUES) + CardRules::MIN_CARD_VALUE;
+    int playsLeft = playfieldCount;
+    int drawsLeft = drawCount;
+    
+    while (playsLeft > 0 || drawsLeft > 0) {
+        // 按剩余数量加权选择，使抽牌均匀地穿插在出牌之间
+        bool undoDraw = rng() % static_cast<uint64_t>(playsLeft + drawsLeft) < static_cast<uint64_t>(drawsLeft);
+        
+        CardConfig card;
+        card.cardFace = trayValue - 1;
+        card.cardSuit = static_cast<int>(rng() % 4);
+        
+        if (undoDraw) {
+            // 反向抽牌：放回备用牌堆顶部（末尾最先被抽出）
+            stackCards.push_back(card);
+            reverseMoves.push_back(CompactGameState::MOVE_DRAW);
+            drawsLeft--;
+            
+            trayValue = static_cast<int>(rng() % CardRules::NUM_CARD_VALUES) + CardRules::MIN_CARD_VALUE;
+        } else {
+            // 反向出牌：放回主牌区空位
+            size_t pick = static_cast<size_t>(rng() % freeSlots.size());
+            int slot = freeSlots[pick];
+            freeSlots[pick] = freeSlots.back();
+            freeSlots.pop_back();
+            
+            card.position = levelTemplate.positions[slot];
+            playfieldCards[slot] = card;
+            reverseMoves.push_back(slot);
+            playsLeft--;
+            
+            // 下面一张牌与当前牌相差1
+            if (trayValue == CardRules::MIN_CARD_VALUE) {
+                trayValue++;
+            } else if (trayValue == CardRules::MAX_CARD_VALUE) {
+                trayValue--;
+            } else {
+                trayValue += (rng() % 2 == 0) ? 1 : -1;
+            }
+        }
+    }
+    
+    // 最后一张手牌就是开局时从备用牌堆翻开的牌
+    CardConfig firstCard;
+    firstCard.cardFace = trayValue - 1;
+    firstCard.cardSuit = static_cast<int>(rng() % 4);
+    stackCards.push_back(firstCard);
+    
+    levelConfig.setPlayfieldCards(playfieldCards);
+    levelConfig.setStackCards(stackCards);
+    
+    solution.assign(reverseMoves.rbegin(), reverseMoves.rend());
+    return true;
+}
@@ -0,0 +1,37 @@
+/**
+ * ReverseDealBuilder.h
+ * 倒推发牌：从胜利的终局开始反向撤销操作，生成必然可解的牌局
+ */
+
+#ifndef __REVERSE_DEAL_BUILDER_H__
+#define __REVERSE_DEAL_BUILDER_H__
+
+#include <stdint.h>
+#include <vector>
+#include "LevelTemplate.h"
+#include "configs/models/LevelConfig.h"
+
+/**
+ * 倒推发牌类
+ * 终局时主牌区为空、手牌区顶部为任意一张牌，之后反复执行两种反向操作：
+ * - 反向出牌：手牌区顶部卡牌放回主牌区空位，下面一张牌的数值与它相差1
+ * - 反向抽牌：手牌区顶部卡牌放回备用牌堆顶部，下面一张牌可以是任意数值
+ * 主牌区填满、备用牌堆达到模板张数后，最后一张手牌放回备用牌堆作为开局翻开的牌。
+ * 反向操作序列倒过来就是一条必胜的操作序列
+ */
+class ReverseDealBuilder
+{
+public:
+    /**
+     * 按模板倒推生成一个牌局
+     * @param levelTemplate 布局模板
+     * @param seed 随机种子
+     * @param levelConfig 输出的关卡配置
+     * @param solution 输出的必胜操作序列（主牌区下标或CompactGameState::MOVE_DRAW）
+     * @return 是否生成成功
+     */
+    static bool build(const LevelTemplate& levelTemplate, uint64_t seed,
+                      LevelConfig& levelConfig, std::vector<int32_t>& solution);
+};
+
+#endif // __REVERSE_DEAL_BUILDER_H__
@@ -0,0 +1,153 @@
+/**
+ * SolvableLevelGenerator.cpp
+ * 可解关卡生成器实现
+ */
+
+#include "SolvableLevelGenerator.h"
+#include "ReverseDealBuilder.h"
+#include "core/rules/CanonicalForm.h"
+#include "core/rules/PlayoutBatch.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_set>
+
+// 去重表分片数，降低线程间的锁竞争
+static const int DEDUPE_SHARD_COUNT = 16;
+
+/**
+ * 混合基础种子与生成序号，得到每次尝试独立的种子
+ */
+static uint64_t mixSeed(uint64_t seed, uint64_t attempt)
+{
+    uint64_t z = seed + attempt * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+bool SolvableLevelGenerator::generate(const std::vector<LevelTemplate>& templates, const LevelGenerationOptions& options,
+                                      std::vector<GeneratedLevel>& levels, LevelGenerationStats* stats)
+{
+    if (templates.empty() || options.levelCount <= 0) {
+        return false;
+    }
+    
+    int threadCount = options.threadCount;
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) {
+            threadCount = 1;
+        }
+    }
+    
+    std::unordered_set<uint64_t> seenHashes[DEDUPE_SHARD_COUNT];
+    std::mutex seenMutexes[DEDUPE_SHARD_COUNT];
+    std::mutex resultMutex;
+    std::atomic<uint64_t> nextAttempt(0);
+    std::atomic<int> accepted(0);
+    std::atomic<uint64_t> duplicates(0);
+    std::atomic<uint64_t> outOfDifficulty(0);
+    std::vector<GeneratedLevel> results;
+    
+    auto worker = [&]() {
+        CompactGameState verifyState;
+        
+        while (accepted.load(std::memory_order_relaxed) < options.levelCount) {
+            uint64_t attempt = nextAttempt.fetch_add(1, std::memory_order_relaxed);
+            if (attempt >= options.maxAttempts) {
+                return;
+            }
+            
+            GeneratedLevel level;
+            level.attempt = attempt;
+            level.templateIndex = static_cast<int>(attempt % templates.size());
+            uint64_t seed = mixSeed(options.seed, attempt);
+            
+            if (!ReverseDealBuilder::build(templates[level.templateIndex], seed, level.config, level.solution)) {
+                continue;
+            }
+            
+            CompactDeal deal;
+            if (!deal.initWithLevelConfig(&level.config)) {
+                continue;
+            }
+            
+            // 按规则重放一遍倒推得到的操作序列，确认确实可解
+            bool solved = verifyState.reset(&deal);
+            for (size_t i = 0; solved && i < level.solution.size(); i++) {
+                solved = verifyState.applyMove(level.solution[i]);
+            }
+            if (!solved || !verifyState.isGameWon()) {
+                continue;
+            }
+            
+            level.difficulty = estimateDifficulty(deal, options.playouts, seed);
+            if (level.difficulty < options.minDifficulty || level.difficulty > options.maxDifficulty) {
+                outOfDifficulty.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            
+            // 这里只统计不重复的数量用于提前结束，重复的牌局也保留下来，
+            // 最终按生成序号去重，保证结果与线程调度无关
+            level.hash = CanonicalForm::hashDeal(deal);
+            int shard = static_cast<int>(level.hash % DEDUPE_SHARD_COUNT);
+            {
+                std::lock_guard<std::mutex> lock(seenMutexes[shard]);
+                if (seenHashes[shard].insert(level.hash).second) {
+                    accepted.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            
+            std::lock_guard<std::mutex> lock(resultMutex);
+            results.push_back(level);
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; i++) {
+        threads.push_back(std::thread(worker));
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    // 按生成序号排序、去重并截断，多线程多生成的部分丢弃
+    std::sort(results.begin(), results.end(), [](const GeneratedLevel& a, const GeneratedLevel& b) {
+        return a.attempt < b.attempt;
+    });
+    
+    std::unordered_set<uint64_t> keptHashes;
+    levels.clear();
+    for (auto& level : results) {
+        if (static_cast<int>(levels.size()) == options.levelCount) {
+            break;
+        }
+        if (keptHashes.insert(level.hash).second) {
+            levels.push_back(level);
+        } else {
+            duplicates.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
+    if (stats) {
+        stats->attempts = std::min<uint64_t>(nextAttempt.load(), options.maxAttempts);
+        stats->duplicates = duplicates.load();
+        stats->outOfDifficulty = outOfDifficulty.load();
+    }
+    
+    return static_cast<int>(levels.size()) == options.levelCount;
+}
+
+float SolvableLevelGenerator::estimateDifficulty(const CompactDeal& deal, int playouts, uint64_t seed)
+{
+    if (playouts <= 0) {
+        return 0.0f;
+    }
+    
+    // 按批同时推进，走子生成走向量化内核；结果只由种子决定，与批大小和指令集无关
+    return 1.0f - PlayoutBatch::estimateWinRate<DefaultRule>(deal, playouts, seed ^ 0x5DEECE66Dull);
+}
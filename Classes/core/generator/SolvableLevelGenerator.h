@@ -0,0 +1,102 @@
+/**
+ * SolvableLevelGenerator.h
+ * 批量生成必然可解的关卡：多线程倒推发牌、按难度筛选、按规范哈希去重
+ */
+
+#ifndef __SOLVABLE_LEVEL_GENERATOR_H__
+#define __SOLVABLE_LEVEL_GENERATOR_H__
+
+#include <stdint.h>
+#include <vector>
+#include "LevelTemplate.h"
+#include "configs/models/LevelConfig.h"
+#include "core/rules/CompactDeal.h"
+
+/**
+ * 生成的关卡
+ */
+struct GeneratedLevel
+{
+    LevelConfig config;                 // 关卡配置
+    std::vector<int32_t> solution;      // 倒推得到的必胜操作序列
+    uint64_t hash;                      // 牌局规范哈希（与花色无关，见CanonicalForm）
+    uint64_t attempt;                   // 生成序号（决定随机种子）
+    float difficulty;                   // 难度（随机对局的失败率，0-1）
+    int templateIndex;                  // 使用的模板下标
+    
+    GeneratedLevel()
+        : hash(0)
+        , attempt(0)
+        , difficulty(0.0f)
+        , templateIndex(0)
+    {}
+};
+
+/**
+ * 生成参数
+ */
+struct LevelGenerationOptions
+{
+    int levelCount;         // 需要的关卡数
+    int threadCount;        // 线程数，为0时使用CPU核心数
+    uint64_t seed;          // 基础随机种子
+    float minDifficulty;    // 难度下限
+    float maxDifficulty;    // 难度上限
+    int playouts;           // 估计难度时的随机对局数
+    uint64_t maxAttempts;   // 最多尝试次数
+    
+    LevelGenerationOptions()
+        : levelCount(100)
+        , threadCount(0)
+        , seed(1)
+        , minDifficulty(0.0f)
+        , maxDifficulty(1.0f)
+        , playouts(64)
+        , maxAttempts(10000000)
+    {}
+};
+
+/**
+ * 生成统计
+ */
+struct LevelGenerationStats
+{
+    uint64_t attempts;              // 尝试次数
+    uint64_t duplicates;            // 重复牌局数
+    uint64_t outOfDifficulty;       // 难度不符合要求的牌局数
+    
+    LevelGenerationStats()
+        : attempts(0)
+        , duplicates(0)
+        , outOfDifficulty(0)
+    {}
+};
+
+/**
+ * 可解关卡生成器类
+ */
+class SolvableLevelGenerator
+{
+public:
+    /**
+     * 生成关卡，结果按生成序号排序，同样的参数得到同样的关卡
+     * @param templates 布局模板，按生成序号轮流使用
+     * @param options 生成参数
+     * @param levels 输出的关卡
+     * @param stats 输出的统计，可为nullptr
+     * @return 是否生成了要求数量的关卡
+     */
+    static bool generate(const std::vector<LevelTemplate>& templates, const LevelGenerationOptions& options,
+                         std::vector<GeneratedLevel>& levels, LevelGenerationStats* stats);
+    
+    /**
+     * 用随机策略估计难度：有可出的牌时随机出一张，否则抽牌
+     * @param deal 牌局
+     * @param playouts 随机对局数
+     * @param seed 随机种子
+     * @return 失败率（0-1）
+     */
+    static float estimateDifficulty(const CompactDeal& deal, int playouts, uint64_t seed);
+};
+
+#endif // __SOLVABLE_LEVEL_GENERATOR_H__
@@ -0,0 +1,229 @@
+/**
+ * HintEngine.cpp
+ * 后台提示引擎实现
+ */
+
+#include "HintEngine.h"
+#include <chrono>
+
+// 每次检查时间和新快照之间搜索的节点数
+static const uint64_t SEARCH_CHUNK_NODES = 2048;
+// 工作线程空闲时的最长等待时间（毫秒），兜底唤醒通知丢失的情况
+static const int IDLE_WAIT_MILLISECONDS = 50;
+
+/**
+ * 打包结果：低32位版本号，32-39位结论，40-55位推荐操作+2（0表示没有推荐操作）
+ */
+static uint64_t packResult(uint32_t version, int status, bool hasMove, int move)
+{
+    uint64_t packedMove = hasMove ? static_cast<uint64_t>(move + 2) : 0;
+    return version | (static_cast<uint64_t>(status) << 32) | (packedMove << 40);
+}
+
+HintEngine::HintEngine()
+    : _running(false)
+    , _threaded(false)
+    , _submitVersion(0)
+    , _stopRequested(false)
+    , _pending(nullptr)
+    , _published(0)
+    , _reuseCount(0)
+    , _tablebase(nullptr)
+    , _current(nullptr)
+    , _spentSeconds(0.0)
+{
+}
+
+HintEngine::~HintEngine()
+{
+    stop();
+}
+
+bool HintEngine::start(const HintEngineOptions& options)
+{
+    if (_running || !_search.init(options.tableBits)) {
+        return false;
+    }
+    
+    _options = options;
+    if (options.mode == HEM_AUTO) {
+        _threaded = std::thread::hardware_concurrency() > 1;
+    } else {
+        _threaded = options.mode == HEM_THREAD;
+    }
+    
+    _running = true;
+    _stopRequested.store(false, std::memory_order_relaxed);
+    if (_threaded) {
+        _thread = std::thread(&HintEngine::workerLoop, this);
+    }
+    
+    return true;
+}
+
+void HintEngine::stop()
+{
+    if (!_running) {
+        return;
+    }
+    
+    if (_threaded) {
+        {
+            std::lock_guard<std::mutex> lock(_wakeMutex);
+            _stopRequested.store(true, std::memory_order_relaxed);
+        }
+        _wakeCond.notify_one();
+        _thread.join();
+    }
+    _running = false;
+    
+    delete _pending.exchange(nullptr, std::memory_order_acq_rel);
+    delete _current;
+    _current = nullptr;
+    _published.store(0, std::memory_order_relaxed);
+}
+
+uint32_t HintEngine::submitSnapshot(HintSnapshot* snapshot)
+{
+    if (!_running) {
+        delete snapshot;
+        return 0;
+    }
+    
+    // 无法创建快照时局面同样已经变化：推进版本号让旧结果失效，并丢弃未取走的旧快照
+    if (!snapshot) {
+        ++_submitVersion;
+        delete _pending.exchange(nullptr, std::memory_order_acq_rel);
+        return 0;
+    }
+    
+    snapshot->version = ++_submitVersion;
+    // 搜索方还没取走的旧快照已经过时，直接丢弃
+    delete _pending.exchange(snapshot, std::memory_order_acq_rel);
+    
+    if (_threaded) {
+        { std::lock_guard<std::mutex> lock(_wakeMutex); }
+        _wakeCond.notify_one();
+    }
+    
+    return _submitVersion;
+}
+
+bool HintEngine::pollResult(HintResult& result) const
+{
+    uint64_t packed = _published.load(std::memory_order_acquire);
+    uint32_t version = static_cast<uint32_t>(packed);
+    if (!_running || _submitVersion == 0 || version != _submitVersion) {
+        return false;
+    }
+    
+    uint32_t packedMove = static_cast<uint32_t>((packed >> 40) & 0xFFFF);
+    result.version = version;
+    result.status = static_cast<int>((packed >> 32) & 0xFF);
+    result.hasMove = packedMove != 0;
+    result.move = result.hasMove ? static_cast<int>(packedMove) - 2 : 0;
+    return result.status != HS_PENDING;
+}
+
+void HintEngine::update()
+{
+    if (!_running || _threaded) {
+        return;
+    }
+    
+    consumePending();
+    if (needsSearch()) {
+        searchFor(_options.frameSliceSeconds);
+    }
+}
+
+void HintEngine::workerLoop()
+{
+    while (!_stopRequested.load(std::memory_order_relaxed)) {
+        consumePending();
+        if (needsSearch()) {
+            searchFor(_options.timeBudgetSeconds - _spentSeconds);
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(_wakeMutex);
+        if (!_stopRequested.load(std::memory_order_relaxed) && !_pending.load(std::memory_order_acquire)) {
+            _wakeCond.wait_for(lock, std::chrono::milliseconds(IDLE_WAIT_MILLISECONDS));
+        }
+    }
+}
+
+bool HintEngine::consumePending()
+{
+    HintSnapshot* snapshot = _pending.exchange(nullptr, std::memory_order_acq_rel);
+    if (!snapshot) {
+        return false;
+    }
+    _search.setTablebase(_tablebase.load(std::memory_order_acquire));
+    
+    // 重复提交同一局面时沿用当前搜索，只更新版本号
+    if (_current && _current->isSamePosition(*snapshot)) {
+        _current->version = snapshot->version;
+        delete snapshot;
+        publish();
+        return true;
+    }
+    
+    if (!_current) {
+        _search.reset(*snapshot);
+    } else if (_search.advance(*snapshot)) {
+        _reuseCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    delete _current;
+    _current = snapshot;
+    _spentSeconds = 0.0;
+    publish();
+    
+    return true;
+}
+
+bool HintEngine::needsSearch() const
+{
+    return _current && _search.getStatus() == HSS_RUNNING && _spentSeconds < _options.timeBudgetSeconds;
+}
+
+void HintEngine::searchFor(double seconds)
+{
+    auto begin = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    _search.setTablebase(_tablebase.load(std::memory_order_acquire));
+    
+    while (_search.run(SEARCH_CHUNK_NODES) == HSS_RUNNING) {
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        if (elapsed >= seconds || _spentSeconds + elapsed >= _options.timeBudgetSeconds
+            || _pending.load(std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    
+    _spentSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    publish();
+}
+
+void HintEngine::publish()
+{
+    int status = HS_SEARCHING;
+    switch (_search.getStatus()) {
+        case HSS_WON:
+            status = HS_WINNING;
+            break;
+        case HSS_LOST:
+            status = HS_LOST;
+            break;
+        case HSS_RUNNING:
+            status = _spentSeconds >= _options.timeBudgetSeconds ? HS_UNKNOWN : HS_SEARCHING;
+            break;
+        default:
+            status = HS_UNKNOWN;
+            break;
+    }
+    
+    int move = 0;
+    bool hasMove = _search.getBestMove(move);
+    _published.store(packResult(_current->version, status, hasMove, move), std::memory_order_release);
+}
@@ -0,0 +1,183 @@
+/**
+ * HintEngine.h
+ * 后台提示引擎，在工作线程或主线程时间片中持续搜索当前局面的推荐操作
+ */
+
+#ifndef __HINT_ENGINE_H__
+#define __HINT_ENGINE_H__
+
+#include <stdint.h>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include "HintSearch.h"
+
+/**
+ * 提示引擎运行方式
+ */
+enum HintEngineMode
+{
+    HEM_AUTO = 0,           // 多核设备使用工作线程，单核设备使用主线程时间片
+    HEM_THREAD,             // 工作线程
+    HEM_FRAME_SLICED        // 主线程每帧调用update时搜索一个时间片
+};
+
+/**
+ * 提示结论
+ */
+enum HintStatus
+{
+    HS_PENDING = 0,         // 最新局面还没有结果
+    HS_SEARCHING,           // 仍在搜索，推荐操作为目前走得最远的分支
+    HS_WINNING,             // 推荐操作所在的序列可以通关
+    HS_LOST,                // 当前局面已无法通关
+    HS_UNKNOWN              // 用完时间预算仍未得出结论
+};
+
+/**
+ * 提示引擎配置
+ */
+struct HintEngineOptions
+{
+    double timeBudgetSeconds;   // 每个局面的搜索时间预算（秒）
+    double frameSliceSeconds;   // 时间片模式下每帧的搜索时间（秒）
+    int tableBits;              // 置换表桶数的位数
+    int mode;                   // 运行方式（HintEngineMode）
+    
+    HintEngineOptions()
+        : timeBudgetSeconds(0.5)
+        , frameSliceSeconds(0.002)
+        , tableBits(20)
+        , mode(HEM_AUTO)
+    {}
+};
+
+/**
+ * 提示结果
+ */
+struct HintResult
+{
+    uint32_t version;       // 对应的快照版本号
+    int status;             // 提示结论（HintStatus）
+    bool hasMove;           // 是否有推荐操作
+    int move;               // 推荐操作（主牌区下标或MOVE_DRAW）
+    
+    HintResult()
+        : version(0)
+        , status(HS_PENDING)
+        , hasMove(false)
+        , move(0)
+    {}
+};
+
+/**
+ * 提示引擎
+ * 主线程每次操作后提交一份局面快照，快照通过原子指针交给搜索方，未被取走的旧快照直接丢弃。
+ * 搜索结果打包在一个64位原子变量中发布，主线程每帧读取，不需要加锁。
+ * submitSnapshot、pollResult、update只能在主线程调用
+ */
+class HintEngine
+{
+public:
+    HintEngine();
+    ~HintEngine();
+    
+    /**
+     * 设置残局库，可在运行期间调用（如残局库在后台构建完成后），搜索方在下一段搜索前换用
+     * @param tablebase 残局库，需在引擎运行期间保持有效
+     */
+    void setTablebase(const EndgameTablebase* tablebase) { _tablebase.store(tablebase, std::memory_order_release); }
+    
+    /**
+     * 启动引擎
+     * @param options 配置
+     * @return 是否成功
+     */
+    bool start(const HintEngineOptions& options);
+    
+    /**
+     * 停止引擎，丢弃未完成的搜索
+     */
+    void stop();
+    
+    /**
+     * 提交新的局面快照
+     * @param snapshot 局面快照，所有权转移给引擎；为nullptr时只让之前的结果失效
+     * @return 分配给快照的版本号，未启动或快照为nullptr时返回0
+     */
+    uint32_t submitSnapshot(HintSnapshot* snapshot);
+    
+    /**
+     * 读取最新局面的提示结果
+     * @param result 输出结果
+     * @return 是否已有最新局面的结果
+     */
+    bool pollResult(HintResult& result) const;
+    
+    /**
+     * 每帧调用，时间片模式下在此搜索，工作线程模式下不做任何事
+     */
+    void update();
+    
+    /**
+     * 是否使用工作线程
+     * @return 是否使用工作线程
+     */
+    bool isThreaded() const { return _threaded; }
+    
+    /**
+     * 获取沿用已有搜索的快照数
+     * @return 快照数
+     */
+    uint64_t getReuseCount() const { return _reuseCount.load(std::memory_order_relaxed); }
+    
+private:
+    HintEngineOptions _options;                 // 配置
+    HintSearch _search;                         // 搜索（只在搜索方访问）
+    bool _running;                              // 是否已启动
+    bool _threaded;                             // 是否使用工作线程
+    uint32_t _submitVersion;                    // 最近提交的快照版本号（只在主线程访问）
+    
+    std::thread _thread;                        // 工作线程
+    std::mutex _wakeMutex;                      // 唤醒工作线程用的锁
+    std::condition_variable _wakeCond;          // 唤醒工作线程用的条件变量
+    std::atomic<bool> _stopRequested;           // 是否请求停止
+    std::atomic<HintSnapshot*> _pending;        // 待搜索的快照
+    std::atomic<uint64_t> _published;           // 打包发布的结果
+    std::atomic<uint64_t> _reuseCount;          // 沿用已有搜索的快照数
+    std::atomic<const EndgameTablebase*> _tablebase;    // 残局库，搜索方在每段搜索前交给_search
+    
+    HintSnapshot* _current;                     // 正在搜索的快照（只在搜索方访问）
+    double _spentSeconds;                       // 当前快照已用的搜索时间（只在搜索方访问）
+    
+    /**
+     * 工作线程主循环
+     */
+    void workerLoop();
+    
+    /**
+     * 取走待搜索的快照并切换搜索
+     * @return 是否取到新快照
+     */
+    bool consumePending();
+    
+    /**
+     * 当前快照是否还需要继续搜索
+     * @return 是否需要
+     */
+    bool needsSearch() const;
+    
+    /**
+     * 搜索一段时间，有新快照提交时提前返回
+     * @param seconds 最长搜索时间（秒）
+     */
+    void searchFor(double seconds);
+    
+    /**
+     * 发布当前快照的结果
+     */
+    void publish();
+};
+
+#endif // __HINT_ENGINE_H__
@@ -0,0 +1,331 @@
+/**
+ * HintSearch.cpp
+ * 提示搜索实现
+ */
+
+#include "HintSearch.h"
+
+HintSearch::HintSearch()
+    : _tablebase(nullptr)
+    , _dealCount(0)
+    , _rootStackRemaining(0)
+    , _rootTrayValue(0)
+    , _bestRemaining(0)
+    , _status(HSS_IDLE)
+    , _nodes(0)
+{
+}
+
+bool HintSearch::init(int tableBits)
+{
+    return _table.init(tableBits);
+}
+
+bool HintSearch::reset(const HintSnapshot& snapshot)
+{
+    _status = HSS_IDLE;
+    if (!snapshot.deal) {
+        return false;
+    }
+    
+    // 关卡切换时更换盐值，上一关卡的记录不会被误用，也不必清空置换表
+    if (snapshot.deal != _deal) {
+        _deal = snapshot.deal;
+        _dealCount++;
+        uint64_t salt = _dealCount * 0x9E3779B97F4A7C15ULL;
+        _keys.init(_deal.get(), salt ^ (salt >> 29));
+        _table.newGeneration();
+    }
+    
+    if (!_state.resetToPosition(_deal.get(), snapshot.playfieldMask, snapshot.stackRemaining, snapshot.trayValue)) {
+        return false;
+    }
+    
+    _rootMask = snapshot.playfieldMask;
+    _rootStackRemaining = snapshot.stackRemaining;
+    _rootTrayValue = snapshot.trayValue;
+    _frames.clear();
+    _moves.clear();
+    _path.clear();
+    _bestLine.clear();
+    _bestRemaining = _state.getPlayfieldRemaining();
+    _winningLine.clear();
+    _nodes = 0;
+    
+    if (_state.isGameWon()) {
+        _status = HSS_WON;
+        return true;
+    }
+    
+    if (_tablebase && _tablebase->covers(_state)) {
+        EndgameProbe probe;
+        CompactGameState endgame = _state;
+        if (_tablebase->probe(_state, probe) && probe.winnable && _tablebase->playOut(endgame, _winningLine)) {
+            _status = HSS_WON;
+        } else {
+            _winningLine.clear();
+            _status = HSS_LOST;
+        }
+        return true;
+    }
+    
+    uint64_t key = _keys.computeKey(_state);
+    if (_table.probe(key) == TTR_LOSS) {
+        _status = HSS_LOST;
+        return true;
+    }
+    
+    pushFrame(key);
+    _status = HSS_RUNNING;
+    return true;
+}
+
+bool HintSearch::advance(const HintSnapshot& snapshot)
+{
+    int move = 0;
+    if (!findRootMove(snapshot, move)) {
+        reset(snapshot);
+        return false;
+    }
+    
+    if (_status == HSS_WON && !_winningLine.empty() && isEquivalentMove(*_deal, _winningLine[0], move)) {
+        dropFirstMove(_winningLine, move);
+        _state.resetToPosition(_deal.get(), snapshot.playfieldMask, snapshot.stackRemaining, snapshot.trayValue);
+        _rootMask = snapshot.playfieldMask;
+        _rootStackRemaining = snapshot.stackRemaining;
+        _rootTrayValue = snapshot.trayValue;
+        _frames.clear();
+        _moves.clear();
+        _path.clear();
+        _bestLine = _winningLine;
+        _bestRemaining = 0;
+        return true;
+    }
+    
+    if (_status != HSS_RUNNING || _path.empty() || !isEquivalentMove(*_deal, _path[0], move)) {
+        reset(snapshot);
+        return false;
+    }
+    
+    // 去掉根节点一层，玩家所走分支下的搜索栈原样保留
+    int original = _path[0];
+    uint32_t rootCount = _frames[0].end - _frames[0].begin;
+    _moves.erase(_moves.begin(), _moves.begin() + rootCount);
+    _frames.erase(_frames.begin());
+    for (auto& frame : _frames) {
+        frame.begin -= rootCount;
+        frame.end -= rootCount;
+        frame.next -= rootCount;
+    }
+    if (original != move) {
+        for (auto& pending : _moves) {
+            if (pending == move) {
+                pending = original;
+            }
+        }
+    }
+    dropFirstMove(_path, move);
+    
+    _state.resetToPosition(_deal.get(), snapshot.playfieldMask, snapshot.stackRemaining, snapshot.trayValue);
+    if (!_bestLine.empty() && isEquivalentMove(*_deal, _bestLine[0], move)) {
+        dropFirstMove(_bestLine, move);
+    } else {
+        _bestLine.clear();
+        _bestRemaining = _state.getPlayfieldRemaining();
+    }
+    for (auto pathMove : _path) {
+        _state.applyMove(pathMove);
+    }
+    _rootMask = snapshot.playfieldMask;
+    _rootStackRemaining = snapshot.stackRemaining;
+    _rootTrayValue = snapshot.trayValue;
+    
+    return true;
+}
+
+int HintSearch::run(uint64_t nodeBudget)
+{
+    uint64_t searched = 0;
+    while (_status == HSS_RUNNING && searched < nodeBudget) {
+        Frame& frame = _frames.back();
+        if (frame.next == frame.end) {
+            // 所有分支均无解
+            _table.store(frame.key, TTR_LOSS, _state.getPlayfieldRemaining() + _state.getStackRemaining());
+            _moves.resize(frame.begin);
+            _frames.pop_back();
+            if (_frames.empty()) {
+                _status = HSS_LOST;
+                break;
+            }
+            _state.undo();
+            _path.pop_back();
+            continue;
+        }
+        
+        int move = _moves[frame.next++];
+        uint64_t key = frame.key;
+        int prevTrayValue = _state.getTrayValue();
+        _state.applyMove(move);
+        _path.push_back(move);
+        _nodes++;
+        searched++;
+        
+        if (_state.getPlayfieldRemaining() < _bestRemaining) {
+            _bestRemaining = _state.getPlayfieldRemaining();
+            _bestLine = _path;
+        }
+        
+        if (_state.isGameWon()) {
+            _winningLine = _path;
+            _status = HSS_WON;
+            break;
+        }
+        
+        if (_tablebase && _tablebase->covers(_state)) {
+            EndgameProbe probe;
+            if (_tablebase->probe(_state, probe) && probe.winnable) {
+                CompactGameState endgame = _state;
+                _winningLine = _path;
+                if (_tablebase->playOut(endgame, _winningLine)) {
+                    _status = HSS_WON;
+                    break;
+                }
+                _winningLine.clear();
+            }
+            _state.undo();
+            _path.pop_back();
+            continue;
+        }
+        
+        uint64_t childKey = _keys.updateKey(key, move, prevTrayValue, _state);
+        if (_table.probe(childKey) == TTR_LOSS) {
+            _state.undo();
+            _path.pop_back();
+            continue;
+        }
+        
+        pushFrame(childKey);
+    }
+    
+    return _status;
+}
+
+bool HintSearch::getBestMove(int& move) const
+{
+    if (_status == HSS_WON) {
+        if (_winningLine.empty()) {
+            return false;
+        }
+        move = _winningLine[0];
+        return true;
+    }
+    
+    if (!_bestLine.empty()) {
+        move = _bestLine[0];
+        return true;
+    }
+    // 还没有走出任何分支时推荐根节点的第一个操作
+    if (!_frames.empty() && _frames[0].end > _frames[0].begin) {
+        move = _moves[_frames[0].begin];
+        return true;
+    }
+    
+    return false;
+}
+
+void HintSearch::pushFrame(uint64_t key)
+{
+    Frame frame;
+    frame.key = key;
+    frame.begin = static_cast<uint32_t>(_moves.size());
+    
+    // 先出牌后抽牌，数值相同的卡牌打出后得到同一个规范状态，每个数值只取一张
+    const std::vector<uint8_t>& faces = _deal->getPlayfieldFaces();
+    uint32_t pendingValues = _state.getPlayableValueMask();
+    for (size_t i = 0; i < faces.size() && pendingValues != 0; i++) {
+        uint32_t bit = 1u << faces[i];
+        if ((pendingValues & bit) && _state.isPlayfieldCardPresent(static_cast<int>(i))) {
+            _moves.push_back(static_cast<int>(i));
+            pendingValues &= ~bit;
+        }
+    }
+    if (_state.canDrawCardFromStack()) {
+        _moves.push_back(CompactGameState::MOVE_DRAW);
+    }
+    
+    frame.end = static_cast<uint32_t>(_moves.size());
+    frame.next = frame.begin;
+    _frames.push_back(frame);
+}
+
+bool HintSearch::findRootMove(const HintSnapshot& snapshot, int& move) const
+{
+    if (_status == HSS_IDLE || snapshot.deal != _deal || snapshot.playfieldMask.size() != _rootMask.size()) {
+        return false;
+    }
+    
+    if (snapshot.stackRemaining == _rootStackRemaining - 1) {
+        if (snapshot.playfieldMask != _rootMask || snapshot.trayValue != _deal->getStackValue(snapshot.stackRemaining)) {
+            return false;
+        }
+        move = CompactGameState::MOVE_DRAW;
+        return true;
+    }
+    
+    if (snapshot.stackRemaining != _rootStackRemaining) {
+        return false;
+    }
+    
+    // 主牌区恰好少了一张卡牌，且该卡牌可以打到根局面的手牌上
+    int removed = -1;
+    for (size_t i = 0; i < _rootMask.size(); i++) {
+        uint64_t diff = _rootMask[i] ^ snapshot.playfieldMask[i];
+        if (diff == 0) {
+            continue;
+        }
+        if ((diff & snapshot.playfieldMask[i]) != 0 || (diff & (diff - 1)) != 0 || removed >= 0) {
+            return false;
+        }
+        int bit = 0;
+        while (!((diff >> bit) & 1)) {
+            bit++;
+        }
+        removed = static_cast<int>(i) * 64 + bit;
+    }
+    if (removed < 0) {
+        return false;
+    }
+    
+    int value = _deal->getPlayfieldValue(removed);
+    if (snapshot.trayValue != value || !CardRules::canMatchValues(value, _rootTrayValue)) {
+        return false;
+    }
+    move = removed;
+    return true;
+}
+
+bool HintSearch::isEquivalentMove(const CompactDeal& deal, int a, int b)
+{
+    if (a == b) {
+        return true;
+    }
+    if (a == CompactGameState::MOVE_DRAW || b == CompactGameState::MOVE_DRAW) {
+        return false;
+    }
+    return deal.getPlayfieldValue(a) == deal.getPlayfieldValue(b);
+}
+
+void HintSearch::dropFirstMove(std::vector<int32_t>& line, int played)
+{
+    int original = line[0];
+    line.erase(line.begin());
+    
+    // 玩家打出的是另一张同值卡牌时，序列原本打出的卡牌仍在主牌区，代替玩家打出的卡牌出现在后续操作中
+    if (original != played) {
+        for (auto& move : line) {
+            if (move == played) {
+                move = original;
+            }
+        }
+    }
+}
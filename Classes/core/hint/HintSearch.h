@@ -0,0 +1,163 @@
+/**
+ * HintSearch.h
+ * 可分段执行的提示搜索
+ */
+
+#ifndef __HINT_SEARCH_H__
+#define __HINT_SEARCH_H__
+
+#include <stdint.h>
+#include <vector>
+#include <memory>
+#include "HintSnapshot.h"
+#include "core/solver/TranspositionTable.h"
+#include "core/solver/SolverKeys.h"
+#include "core/solver/EndgameTablebase.h"
+
+/**
+ * 提示搜索状态
+ */
+enum HintSearchStatus
+{
+    HSS_IDLE = 0,       // 尚未设置局面
+    HSS_RUNNING,        // 搜索未完成
+    HSS_WON,            // 找到通关操作序列
+    HSS_LOST            // 穷举后确认无法通关
+};
+
+/**
+ * 提示搜索
+ * 深度优先搜索使用显式栈，可以在任意节点暂停，之后从暂停处继续，便于按时间片执行。
+ * 置换表只记录无解局面，这一结论与局面在对局中的位置无关，因此在同一关卡的多次搜索间保留。
+ * 玩家执行了搜索预测的操作时，搜索栈去掉根节点一层后继续使用，已搜索的子树不会重复搜索
+ */
+class HintSearch
+{
+public:
+    HintSearch();
+    
+    /**
+     * 分配置换表
+     * @param tableBits 置换表桶数的位数
+     * @return 是否成功
+     */
+    bool init(int tableBits);
+    
+    /**
+     * 设置残局库，剩余卡牌数在残局库范围内的局面直接查表
+     * @param tablebase 残局库，需在搜索期间保持有效，传nullptr取消
+     */
+    void setTablebase(const EndgameTablebase* tablebase) { _tablebase = tablebase; }
+    
+    /**
+     * 从快照局面开始新的搜索，置换表中同一关卡的记录保留
+     * @param snapshot 局面快照
+     * @return 是否成功
+     */
+    bool reset(const HintSnapshot& snapshot);
+    
+    /**
+     * 切换到新的快照局面
+     * 新局面是当前根局面执行一步操作的结果，且该操作与已找到的通关序列或正在搜索的分支一致时，
+     * 沿用已有结果或搜索栈；否则等同于reset
+     * @param snapshot 局面快照
+     * @return 是否沿用了已有搜索
+     */
+    bool advance(const HintSnapshot& snapshot);
+    
+    /**
+     * 继续搜索
+     * @param nodeBudget 本次最多搜索的节点数
+     * @return 搜索状态（HintSearchStatus）
+     */
+    int run(uint64_t nodeBudget);
+    
+    /**
+     * 获取搜索状态
+     * @return 搜索状态（HintSearchStatus）
+     */
+    int getStatus() const { return _status; }
+    
+    /**
+     * 获取当前推荐的操作
+     * 已找到通关序列时为序列第一步；搜索未完成或无解时为目前走得最远的分支的第一步
+     * @param move 输出推荐操作（主牌区下标或MOVE_DRAW）
+     * @return 是否有推荐操作
+     */
+    bool getBestMove(int& move) const;
+    
+    /**
+     * 获取通关操作序列，仅在状态为HSS_WON时有效
+     * @return 操作序列
+     */
+    const std::vector<int32_t>& getWinningLine() const { return _winningLine; }
+    
+    /**
+     * 获取自reset以来累计搜索的节点数
+     * @return 节点数
+     */
+    uint64_t getNodeCount() const { return _nodes; }
+    
+    /**
+     * 判断两个操作是否等价（同为抽牌或打出数值相同的卡牌）
+     * @param deal 牌局定义
+     * @param a 操作a
+     * @param b 操作b
+     * @return 是否等价
+     */
+    static bool isEquivalentMove(const CompactDeal& deal, int a, int b);
+    
+    /**
+     * 去掉序列的第一步，并把其后对玩家所出卡牌的引用换成序列原本打出的同值卡牌
+     * @param line 操作序列，第一步需与played等价
+     * @param played 玩家实际执行的操作
+     */
+    static void dropFirstMove(std::vector<int32_t>& line, int played);
+    
+private:
+    /**
+     * 搜索栈中的一层
+     */
+    struct Frame
+    {
+        uint64_t key;       // 本层局面的状态键
+        uint32_t begin;     // 本层操作在_moves中的起始位置
+        uint32_t end;       // 本层操作在_moves中的结束位置
+        uint32_t next;      // 下一个待搜索的操作
+    };
+    
+    std::shared_ptr<const CompactDeal> _deal;   // 当前关卡的牌局定义
+    TranspositionTable _table;                  // 无解局面置换表
+    SolverKeys _keys;                           // 状态键
+    const EndgameTablebase* _tablebase;         // 残局库（可为空）
+    uint64_t _dealCount;                        // 已切换的关卡数，用于生成盐值
+    
+    CompactGameState _state;                    // 搜索状态
+    std::vector<uint64_t> _rootMask;            // 根局面主牌区位掩码
+    int _rootStackRemaining;                    // 根局面备用牌堆剩余数
+    int _rootTrayValue;                         // 根局面手牌数值
+    std::vector<Frame> _frames;                 // 搜索栈
+    std::vector<int32_t> _moves;                // 各层待搜索操作（按层连续存放）
+    std::vector<int32_t> _path;                 // 从根局面到当前节点的操作
+    std::vector<int32_t> _bestLine;             // 目前剩余主牌最少的分支
+    int _bestRemaining;                         // 该分支的主牌区剩余数
+    std::vector<int32_t> _winningLine;          // 通关操作序列
+    int _status;                                // 搜索状态
+    uint64_t _nodes;                            // 节点数
+    
+    /**
+     * 生成当前局面的操作并压入新的一层
+     * @param key 当前局面的状态键
+     */
+    void pushFrame(uint64_t key);
+    
+    /**
+     * 判断新快照是否由根局面执行一步操作得到
+     * @param snapshot 新快照
+     * @param move 输出该操作（主牌区下标或MOVE_DRAW）
+     * @return 是否为一步操作
+     */
+    bool findRootMove(const HintSnapshot& snapshot, int& move) const;
+};
+
+#endif // __HINT_SEARCH_H__
@@ -0,0 +1,36 @@
+/**
+ * HintSnapshot.cpp
+ * 局面快照实现
+ */
+
+#include "HintSnapshot.h"
+
+HintSnapshot* HintSnapshot::createFromGameModel(const GameModel* gameModel, const std::shared_ptr<const CompactDeal>& deal)
+{
+    if (!gameModel || !deal || !gameModel->getTrayTopCard()) {
+        return nullptr;
+    }
+    
+    // 备用牌堆在游戏中只减不增（回退会放回），剩余数不会超过牌局定义中的数量
+    int stackRemaining = static_cast<int>(gameModel->getStackCards().size());
+    if (stackRemaining >= deal->getStackCount()) {
+        return nullptr;
+    }
+    
+    HintSnapshot* snapshot = new HintSnapshot();
+    snapshot->deal = deal;
+    snapshot->playfieldMask.assign((deal->getPlayfieldCount() + 63) / 64, 0);
+    snapshot->stackRemaining = stackRemaining;
+    snapshot->trayValue = gameModel->getTrayTopCard()->getValue();
+    
+    for (auto card : gameModel->getPlayfieldCards()) {
+        int index = card->getCardId();
+        if (index < 0 || index >= deal->getPlayfieldCount() || deal->getPlayfieldValue(index) != card->getValue()) {
+            delete snapshot;
+            return nullptr;
+        }
+        snapshot->playfieldMask[index >> 6] |= (uint64_t)1 << (index & 63);
+    }
+    
+    return snapshot;
+}
@@ -0,0 +1,55 @@
+/**
+ * HintSnapshot.h
+ * 提示搜索使用的不可变局面快照
+ */
+
+#ifndef __HINT_SNAPSHOT_H__
+#define __HINT_SNAPSHOT_H__
+
+#include <stdint.h>
+#include <vector>
+#include <memory>
+#include "core/rules/CompactDeal.h"
+#include "models/GameModel.h"
+
+/**
+ * 局面快照
+ * 主线程每次操作后生成一份，移交给提示线程后不再修改。牌局定义在同一关卡的所有快照间共享，
+ * 快照本身只记录主牌区位掩码、备用牌堆剩余数和手牌数值，生成开销与主牌区卡牌数成正比
+ */
+struct HintSnapshot
+{
+    std::shared_ptr<const CompactDeal> deal;    // 牌局定义（共享）
+    std::vector<uint64_t> playfieldMask;        // 主牌区位掩码
+    int stackRemaining;                         // 备用牌堆剩余卡牌数
+    int trayValue;                              // 手牌区顶部卡牌数值
+    uint32_t version;                           // 快照版本号，由HintEngine提交时分配
+    
+    HintSnapshot()
+        : stackRemaining(0)
+        , trayValue(0)
+        , version(0)
+    {}
+    
+    /**
+     * 从游戏模型生成快照
+     * 主牌区卡牌ID即牌局定义中的下标，备用牌堆剩余数为模型中备用牌堆的卡牌数
+     * @param gameModel 游戏模型
+     * @param deal 由同一关卡配置生成的牌局定义
+     * @return 快照，模型与牌局定义不一致时返回nullptr
+     */
+    static HintSnapshot* createFromGameModel(const GameModel* gameModel, const std::shared_ptr<const CompactDeal>& deal);
+    
+    /**
+     * 判断两个快照是否为同一局面
+     * @param other 另一个快照
+     * @return 是否相同
+     */
+    bool isSamePosition(const HintSnapshot& other) const
+    {
+        return deal == other.deal && stackRemaining == other.stackRemaining
+            && trayValue == other.trayValue && playfieldMask == other.playfieldMask;
+    }
+};
+
+#endif // __HINT_SNAPSHOT_H__
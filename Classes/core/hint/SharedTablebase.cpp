@@ -0,0 +1,39 @@
+/**
+ * SharedTablebase.cpp
+ * 共享残局库实现
+ */
+
+#include "SharedTablebase.h"
+#include <atomic>
+#include <new>
+#include <thread>
+
+const int SharedTablebase::DEFAULT_MAX_CARDS;
+
+// 是否已经开始构建
+static std::atomic<bool> s_started(false);
+
+// 构建完成的残局库，不释放
+static std::atomic<const EndgameTablebase*> s_tablebase(nullptr);
+
+void SharedTablebase::buildAsync(int maxCards)
+{
+    if (s_started.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    
+    // 线程分离，程序退出时不等待构建完成
+    std::thread([maxCards]() {
+        EndgameTablebase* tablebase = new (std::nothrow) EndgameTablebase();
+        if (tablebase && tablebase->build(maxCards)) {
+            s_tablebase.store(tablebase, std::memory_order_release);
+        } else {
+            delete tablebase;
+        }
+    }).detach();
+}
+
+const EndgameTablebase* SharedTablebase::get()
+{
+    return s_tablebase.load(std::memory_order_acquire);
+}
@@ -0,0 +1,35 @@
+/**
+ * SharedTablebase.h
+ * 进程内共享的残局库，第一次请求时在后台线程构建
+ */
+
+#ifndef __SHARED_TABLEBASE_H__
+#define __SHARED_TABLEBASE_H__
+
+#include "core/solver/EndgameTablebase.h"
+
+/**
+ * 共享残局库
+ * 残局库由BuildTablebase的同一算法在运行时生成，不随包发布：N=4约110万个局面（1.1MB），
+ * 单核构建约0.1秒，在后台线程完成，不占用主线程。构建完成前get返回nullptr，提示搜索照常进行；
+ * 构建出的残局库保留到程序结束，多个提示引擎共用
+ */
+class SharedTablebase
+{
+public:
+    static const int DEFAULT_MAX_CARDS = 4;     // 默认的最大剩余卡牌数
+    
+    /**
+     * 开始在后台线程构建，重复调用时不做任何事
+     * @param maxCards 最大剩余卡牌数
+     */
+    static void buildAsync(int maxCards = DEFAULT_MAX_CARDS);
+    
+    /**
+     * 获取构建完成的残局库，任意线程可调用
+     * @return 残局库，尚未构建完成或构建失败时返回nullptr
+     */
+    static const EndgameTablebase* get();
+};
+
+#endif // __SHARED_TABLEBASE_H__
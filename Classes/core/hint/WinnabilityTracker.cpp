@@ -0,0 +1,91 @@
+/**
+ * WinnabilityTracker.cpp
+ * 可通关追踪器实现
+ */
+
+#include "WinnabilityTracker.h"
+
+WinnabilityTracker::WinnabilityTracker()
+    : _verdict(WV_UNKNOWN)
+    , _winningMove(-1)
+{
+}
+
+bool WinnabilityTracker::reset(const std::shared_ptr<const CompactDeal>& deal)
+{
+    if (!deal || !_state.reset(deal.get())) {
+        _deal.reset();
+        return false;
+    }
+    
+    _deal = deal;
+    _plies.clear();
+    _verdict = WV_UNKNOWN;
+    _winningMove = -1;
+    
+    return true;
+}
+
+bool WinnabilityTracker::applyMove(int move)
+{
+    if (!_deal) {
+        return false;
+    }
+    if (move == CompactGameState::MOVE_DRAW ? !_state.canDrawCardFromStack() : !_state.canMoveCardFromPlayfieldToTray(move)) {
+        return false;
+    }
+    
+    PlyRecord record;
+    record.move = move;
+    record.verdict = _verdict;
+    record.winningMove = _winningMove;
+    _plies.push_back(record);
+    _state.applyMove(move);
+    
+    // 无法通关的局面之后仍无法通关；沿通关序列走一步后仍可通关，下一步等提示引擎给出
+    bool followsWin = _verdict == WV_WINNABLE && _winningMove >= 0
+        && HintSearch::isEquivalentMove(*_deal, _winningMove, move);
+    if (_verdict != WV_LOST && !followsWin) {
+        _verdict = WV_UNKNOWN;
+    }
+    _winningMove = -1;
+    
+    return true;
+}
+
+bool WinnabilityTracker::undoMove()
+{
+    if (_plies.empty() || !_state.undo()) {
+        return false;
+    }
+    
+    const PlyRecord& record = _plies.back();
+    _verdict = record.verdict;
+    _winningMove = record.winningMove;
+    _plies.pop_back();
+    
+    return true;
+}
+
+void WinnabilityTracker::setVerdict(int verdict, int winningMove)
+{
+    if (!_deal || verdict == WV_UNKNOWN) {
+        return;
+    }
+    
+    _verdict = verdict;
+    _winningMove = verdict == WV_WINNABLE ? winningMove : -1;
+    if (verdict != WV_WINNABLE) {
+        return;
+    }
+    
+    // 之前未定的局面沿已执行的操作走到当前局面即可通关
+    for (size_t i = _plies.size(); i > 0; i--) {
+        PlyRecord& record = _plies[i - 1];
+        if (record.verdict == WV_WINNABLE) {
+            break;
+        }
+        record.verdict = WV_WINNABLE;
+        record.winningMove = record.move;
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * WinnabilityTracker.h
+ * 增量判断当前局面是否还能通关
+ */
+
+#ifndef __WINNABILITY_TRACKER_H__
+#define __WINNABILITY_TRACKER_H__
+
+#include <stdint.h>
+#include <vector>
+#include <memory>
+#include "HintSearch.h"
+
+/**
+ * 可通关结论
+ */
+enum WinnabilityVerdict
+{
+    WV_UNKNOWN = 0,     // 尚未得出结论
+    WV_WINNABLE,        // 还能通关
+    WV_LOST             // 已无法通关
+};
+
+/**
+ * 可通关追踪器
+ * 自己不搜索：结论来自提示引擎对同一局面的结果（HS_WINNING、HS_LOST），由调用方通过setVerdict记录。
+ * 追踪器只在主线程跟随对局执行操作和回退，让结论在各步之间尽量沿用：
+ * - 已无法通关的局面执行任何操作后仍无法通关；
+ * - 沿推荐的通关操作（或打出同值的另一张卡牌）走一步后仍可通关；
+ * - 当前局面证明可通关时，之前所有未定的局面也随之可通关；
+ * - 回退时直接恢复上一步记录的结论。
+ */
+class WinnabilityTracker
+{
+public:
+    WinnabilityTracker();
+    
+    /**
+     * 从牌局初始局面开始追踪
+     * @param deal 牌局定义
+     * @return 是否成功
+     */
+    bool reset(const std::shared_ptr<const CompactDeal>& deal);
+    
+    /**
+     * 跟随对局执行一步操作
+     * @param move 操作（主牌区下标或MOVE_DRAW）
+     * @return 操作是否合法
+     */
+    bool applyMove(int move);
+    
+    /**
+     * 跟随对局回退一步操作
+     * @return 是否回退成功
+     */
+    bool undoMove();
+    
+    /**
+     * 记录当前局面的结论，可通关时回填之前未定的局面
+     * @param verdict 结论（WinnabilityVerdict），WV_UNKNOWN时不做任何事
+     * @param winningMove 可通关时通关序列的第一步，没有时传-1
+     */
+    void setVerdict(int verdict, int winningMove);
+    
+    /**
+     * 获取当前结论
+     * @return 当前结论（WinnabilityVerdict）
+     */
+    int getVerdict() const { return _verdict; }
+    
+    /**
+     * 获取追踪的对局状态
+     * @return 对局状态
+     */
+    const CompactGameState& getState() const { return _state; }
+    
+private:
+    /**
+     * 已执行操作之前的局面记录
+     */
+    struct PlyRecord
+    {
+        int move;                           // 从该局面执行的操作
+        int verdict;                        // 该局面的结论
+        int winningMove;                    // 该局面通关序列的第一步，未知时为-1
+    };
+    
+    std::shared_ptr<const CompactDeal> _deal;   // 牌局定义
+    CompactGameState _state;                    // 对局状态
+    std::vector<PlyRecord> _plies;              // 各步之前的局面记录
+    int _verdict;                               // 当前结论
+    int _winningMove;                           // 当前局面通关序列的第一步，未知时为-1
+};
+
+#endif // __WINNABILITY_TRACKER_H__
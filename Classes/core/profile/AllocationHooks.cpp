@@ -0,0 +1,102 @@
+/**
+ * AllocationHooks.cpp
+ * 替换全局operator new/delete，把每次分配与释放报告给AllocationTracker
+ * 只在CARD_PROFILING打开时编译；不需要统计的程序不要链接此文件
+ */
+
+#include "AllocationTracker.h"
+
+#if CARD_PROFILING
+
+#include <new>
+#include <stdlib.h>
+
+/**
+ * 按标准要求分配：0字节按1字节处理，失败时调用new_handler重试
+ * @return 失败且没有new_handler时返回nullptr
+ */
+static void* trackedAllocate(std::size_t size)
+{
+    if (size == 0) {
+        size = 1;
+    }
+    
+    void* memory = malloc(size);
+    while (!memory) {
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            return nullptr;
+        }
+        handler();
+        memory = malloc(size);
+    }
+    
+    AllocationTracker::recordAllocation(size);
+    return memory;
+}
+
+static void trackedFree(void* memory)
+{
+    if (memory) {
+        AllocationTracker::recordFree();
+        free(memory);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    void* memory = trackedAllocate(size);
+    if (!memory) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return trackedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return trackedAllocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    trackedFree(memory);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void* memory, std::size_t) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    trackedFree(memory);
+}
+#endif
+
+#endif // CARD_PROFILING
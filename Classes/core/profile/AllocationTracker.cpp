@@ -0,0 +1,120 @@
+/**
+ * AllocationTracker.cpp
+ * 堆分配统计实现
+ * 这里的代码在分配钩子内执行，不能再分配内存
+ */
+
+#include "AllocationTracker.h"
+#include <atomic>
+
+static std::atomic<bool> s_enabled(false);
+static std::atomic<bool> s_hooked(false);
+static std::atomic<uint64_t> s_allocations[AS_COUNT];
+static std::atomic<uint64_t> s_frees[AS_COUNT];
+static std::atomic<uint64_t> s_bytes[AS_COUNT];
+static std::atomic<uint64_t> s_entries[AS_COUNT];
+
+// 当前线程的作用域，平凡类型，线程创建与退出过程中的分配也能安全读取
+static thread_local int t_scope = AS_OTHER;
+
+static const char* const SCOPE_NAMES[AS_COUNT] = {
+    "other",
+    "frame",
+    "move",
+    "load"
+};
+
+void AllocationTracker::setEnabled(bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool AllocationTracker::isEnabled()
+{
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+bool AllocationTracker::isHooked()
+{
+    return s_hooked.load(std::memory_order_relaxed);
+}
+
+int AllocationTracker::setThreadScope(int scope)
+{
+    int previous = t_scope;
+    if (scope >= 0 && scope < AS_COUNT) {
+        t_scope = scope;
+    }
+    return previous;
+}
+
+int AllocationTracker::getThreadScope()
+{
+    return t_scope;
+}
+
+void AllocationTracker::getCounts(int scope, AllocationCounts& counts)
+{
+    if (scope < 0 || scope >= AS_COUNT) {
+        counts.allocations = counts.frees = counts.bytes = counts.entries = 0;
+        return;
+    }
+    counts.allocations = s_allocations[scope].load(std::memory_order_relaxed);
+    counts.frees = s_frees[scope].load(std::memory_order_relaxed);
+    counts.bytes = s_bytes[scope].load(std::memory_order_relaxed);
+    counts.entries = s_entries[scope].load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::resetCounts()
+{
+    for (int scope = 0; scope < AS_COUNT; scope++) {
+        s_allocations[scope].store(0, std::memory_order_relaxed);
+        s_frees[scope].store(0, std::memory_order_relaxed);
+        s_bytes[scope].store(0, std::memory_order_relaxed);
+        s_entries[scope].store(0, std::memory_order_relaxed);
+    }
+}
+
+void AllocationTracker::recordAllocation(size_t bytes)
+{
+    if (!s_hooked.load(std::memory_order_relaxed)) {
+        s_hooked.store(true, std::memory_order_relaxed);
+    }
+    if (!s_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    int scope = t_scope;
+    s_allocations[scope].fetch_add(1, std::memory_order_relaxed);
+    s_bytes[scope].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void AllocationTracker::recordFree()
+{
+    if (!s_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    s_frees[t_scope].fetch_add(1, std::memory_order_relaxed);
+}
+
+const char* AllocationTracker::getScopeName(int scope)
+{
+    if (scope < 0 || scope >= AS_COUNT) {
+        return "unknown";
+    }
+    return SCOPE_NAMES[scope];
+}
+
+AllocationScopeGuard::AllocationScopeGuard(int scope)
+    : _previous(AllocationTracker::setThreadScope(scope))
+{
+    if (AllocationTracker::isEnabled() && scope >= 0 && scope < AS_COUNT) {
+        s_entries[scope].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+AllocationScopeGuard::~AllocationScopeGuard()
+{
+    AllocationTracker::setThreadScope(_previous);
+}
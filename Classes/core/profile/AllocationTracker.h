@@ -0,0 +1,118 @@
+/**
+ * AllocationTracker.h
+ * 堆分配统计：按当前作用域（帧、走子、加载）累计分配次数与字节数
+ */
+
+#ifndef __ALLOCATION_TRACKER_H__
+#define __ALLOCATION_TRACKER_H__
+
+#include "../CoreMacros.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * 分配归属的作用域，同一线程上以最内层为准
+ */
+enum AllocationScope
+{
+    AS_OTHER = 0,       // 未标记（含工作线程）
+    AS_FRAME,           // 帧循环中不属于其他作用域的部分
+    AS_MOVE,            // 一次走子（出牌、抽牌、回退）的处理
+    AS_LOAD,            // 关卡加载与初始化
+    AS_COUNT
+};
+
+/**
+ * 一个作用域的累计结果
+ */
+struct AllocationCounts
+{
+    uint64_t allocations;       // 分配次数
+    uint64_t frees;             // 释放次数
+    uint64_t bytes;             // 分配字节数
+    uint64_t entries;           // 进入该作用域的次数（如走子次数）
+};
+
+/**
+ * 分配统计器
+ * 全局operator new/delete的替换在AllocationHooks.cpp中，只在CARD_PROFILING打开时编译，
+ * 链接了该文件的程序每次分配与释放都会调用recordAllocation/recordFree；
+ * 统计默认关闭，setEnabled(true)后按调用线程当前的作用域原子累加
+ */
+class AllocationTracker
+{
+public:
+    /**
+     * 打开或关闭统计
+     */
+    static void setEnabled(bool enabled);
+    
+    /**
+     * 是否正在统计
+     */
+    static bool isEnabled();
+    
+    /**
+     * 分配钩子是否已链接进程序（至少经过钩子完成过一次分配）
+     */
+    static bool isHooked();
+    
+    /**
+     * 设置当前线程的作用域
+     * @param scope 作用域（AllocationScope）
+     * @return 之前的作用域
+     */
+    static int setThreadScope(int scope);
+    
+    /**
+     * 获取当前线程的作用域
+     */
+    static int getThreadScope();
+    
+    /**
+     * 获取作用域的累计结果
+     * @param scope 作用域
+     * @param counts 输出累计结果
+     */
+    static void getCounts(int scope, AllocationCounts& counts);
+    
+    /**
+     * 清零所有作用域的累计结果
+     */
+    static void resetCounts();
+    
+    /**
+     * 记录一次分配/释放，由分配钩子调用
+     */
+    static void recordAllocation(size_t bytes);
+    static void recordFree();
+    
+    /**
+     * 获取作用域名称
+     */
+    static const char* getScopeName(int scope);
+};
+
+/**
+ * 作用域标记，构造时切换当前线程的作用域并计入一次进入，析构时恢复
+ */
+class AllocationScopeGuard
+{
+public:
+    explicit AllocationScopeGuard(int scope);
+    ~AllocationScopeGuard();
+    
+private:
+    AllocationScopeGuard(const AllocationScopeGuard&);
+    AllocationScopeGuard& operator=(const AllocationScopeGuard&);
+    
+    int _previous;
+};
+
+#if CARD_PROFILING
+#define CORE_ALLOCATION_SCOPE(scope)    AllocationScopeGuard CORE_CONCAT(_allocationScope, __LINE__)(scope)
+#else
+#define CORE_ALLOCATION_SCOPE(scope)
+#endif
+
+#endif // __ALLOCATION_TRACKER_H__
@@ -0,0 +1,143 @@
+/**
+ * FrameProfiler.cpp
+ * 帧耗时统计实现
+ */
+
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+// 两组逐帧累加缓冲，s_currentSlot指向正在写入的一组
+static std::atomic<uint64_t> s_frameNanos[2][PS_COUNT];
+static std::atomic<uint32_t> s_frameCalls[2][PS_COUNT];
+static std::atomic<int> s_currentSlot(0);
+
+// 按帧的历史环，只在主线程读写
+static float s_historyMs[PS_COUNT][FrameProfiler::HISTORY_FRAMES];
+static uint16_t s_historyCalls[PS_COUNT][FrameProfiler::HISTORY_FRAMES];
+static int s_historyHead = 0;
+static int s_historySize = 0;
+static uint64_t s_frameCount = 0;
+
+static const char* const SECTION_NAMES[PS_COUNT] = {
+    "LevelLoad",
+    "ModelGen",
+    "CardView",
+    "Actions",
+    "Render",
+    "Frame"
+};
+
+/**
+ * 取有序数组上的分位数（最近秩）
+ */
+static float percentile(const float* sorted, int count, int percent)
+{
+    int rank = (count * percent + 99) / 100;
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+void FrameProfiler::addSample(int section, uint64_t nanos)
+{
+    if (section < 0 || section >= PS_COUNT) {
+        return;
+    }
+    
+    int slot = s_currentSlot.load(std::memory_order_relaxed);
+    s_frameNanos[slot][section].fetch_add(nanos, std::memory_order_relaxed);
+    s_frameCalls[slot][section].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FrameProfiler::endFrame(uint64_t frameNanos)
+{
+    addSample(PS_FRAME, frameNanos);
+    
+    // 切换写入组后取出上一组
+    int slot = s_currentSlot.load(std::memory_order_relaxed);
+    s_currentSlot.store(slot ^ 1, std::memory_order_relaxed);
+    
+    for (int section = 0; section < PS_COUNT; section++) {
+        uint64_t nanos = s_frameNanos[slot][section].exchange(0, std::memory_order_relaxed);
+        uint32_t calls = s_frameCalls[slot][section].exchange(0, std::memory_order_relaxed);
+        s_historyMs[section][s_historyHead] = static_cast<float>(nanos / 1.0e6);
+        s_historyCalls[section][s_historyHead] = static_cast<uint16_t>(std::min<uint32_t>(calls, 0xFFFF));
+    }
+    
+    s_historyHead = (s_historyHead + 1) % HISTORY_FRAMES;
+    if (s_historySize < HISTORY_FRAMES) {
+        s_historySize++;
+    }
+    s_frameCount++;
+}
+
+bool FrameProfiler::getStats(int section, ProfileStats& stats)
+{
+    stats.frameCount = 0;
+    stats.callCount = 0;
+    stats.p50 = stats.p95 = stats.p99 = stats.max = stats.last = 0.0f;
+    if (section < 0 || section >= PS_COUNT || s_historySize == 0) {
+        return false;
+    }
+    
+    // 从最新一帧往回收集有记录的帧
+    float samples[HISTORY_FRAMES];
+    int count = 0;
+    for (int i = 1; i <= s_historySize; i++) {
+        int index = (s_historyHead - i + HISTORY_FRAMES) % HISTORY_FRAMES;
+        if (s_historyCalls[section][index] == 0) {
+            continue;
+        }
+        if (count == 0) {
+            stats.last = s_historyMs[section][index];
+        }
+        samples[count++] = s_historyMs[section][index];
+        stats.callCount += s_historyCalls[section][index];
+    }
+    if (count == 0) {
+        return false;
+    }
+    
+    std::sort(samples, samples + count);
+    stats.frameCount = count;
+    stats.p50 = percentile(samples, count, 50);
+    stats.p95 = percentile(samples, count, 95);
+    stats.p99 = percentile(samples, count, 99);
+    stats.max = samples[count - 1];
+    return true;
+}
+
+void FrameProfiler::reset()
+{
+    for (int slot = 0; slot < 2; slot++) {
+        for (int section = 0; section < PS_COUNT; section++) {
+            s_frameNanos[slot][section].store(0, std::memory_order_relaxed);
+            s_frameCalls[slot][section].store(0, std::memory_order_relaxed);
+        }
+    }
+    s_historyHead = 0;
+    s_historySize = 0;
+    s_frameCount = 0;
+}
+
+uint64_t FrameProfiler::getFrameCount()
+{
+    return s_frameCount;
+}
+
+uint64_t FrameProfiler::nowNanos()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+const char* FrameProfiler::getSectionName(int section)
+{
+    if (section < 0 || section >= PS_COUNT) {
+        return "Unknown";
+    }
+    return SECTION_NAMES[section];
+}
@@ -0,0 +1,127 @@
+/**
+ * FrameProfiler.h
+ * 分子系统的帧耗时统计：作用域计时、无锁的逐帧累加与滚动分位数
+ */
+
+#ifndef __FRAME_PROFILER_H__
+#define __FRAME_PROFILER_H__
+
+#include "../CoreMacros.h"
+#include <stdint.h>
+
+/**
+ * 统计的子系统
+ */
+enum ProfileSection
+{
+    PS_LEVEL_LOAD = 0,      // 关卡配置解析（LevelConfigLoader）
+    PS_MODEL_GENERATE,      // 游戏模型生成（GameModelFromLevelGenerator）
+    PS_CARD_VIEW_INIT,      // 卡牌视图创建（CardView::init）
+    PS_ACTIONS,             // 动作更新（ActionManager::update）
+    PS_RENDER,              // 场景遍历与渲染提交
+    PS_FRAME,               // 整帧间隔
+    PS_COUNT
+};
+
+/**
+ * 一个子系统在最近若干帧上的统计结果，单位为毫秒
+ * 分位数只统计该子系统有耗时记录的帧，加载类子系统不会被大量空帧拉成0
+ */
+struct ProfileStats
+{
+    int frameCount;         // 有记录的帧数
+    int callCount;          // 这些帧内的调用次数
+    float p50;
+    float p95;
+    float p99;
+    float max;
+    float last;             // 最近一次有记录的帧的耗时
+};
+
+/**
+ * 帧耗时统计器
+ * 计时结果按子系统累加到当前帧的缓冲中，各线程只做原子加，不加锁；
+ * 缓冲分两组轮换，endFrame切换到另一组后把上一组取出并清零，写入按帧的历史环，
+ * 切换瞬间落在旧组里的少量样本会计入下一次取出的帧。
+ * endFrame与getStats只应在主线程（帧循环所在线程）调用
+ */
+class FrameProfiler
+{
+public:
+    static const int HISTORY_FRAMES = 240;      // 滚动统计的帧数（60帧/秒下为4秒）
+    
+    /**
+     * 累加一次计时，可在任意线程调用
+     * @param section 子系统（ProfileSection）
+     * @param nanos 耗时（纳秒）
+     */
+    static void addSample(int section, uint64_t nanos);
+    
+    /**
+     * 结束当前帧：把本帧各子系统的累计耗时写入历史
+     * @param frameNanos 本帧间隔（纳秒），记为PS_FRAME
+     */
+    static void endFrame(uint64_t frameNanos);
+    
+    /**
+     * 计算子系统在历史窗口内的统计结果
+     * @param section 子系统
+     * @param stats 输出统计结果
+     * @return 窗口内有记录时返回true
+     */
+    static bool getStats(int section, ProfileStats& stats);
+    
+    /**
+     * 清空当前帧缓冲与历史
+     */
+    static void reset();
+    
+    /**
+     * 获取已结束的帧数
+     */
+    static uint64_t getFrameCount();
+    
+    /**
+     * 获取单调时钟的当前时间（纳秒）
+     */
+    static uint64_t nowNanos();
+    
+    /**
+     * 获取子系统名称
+     */
+    static const char* getSectionName(int section);
+};
+
+/**
+ * 作用域计时器，析构时把经过的时间累加到指定子系统
+ * 一般通过CORE_PROFILE_SCOPE使用，关闭剖析时不产生任何代码
+ */
+class ProfileScope
+{
+public:
+    explicit ProfileScope(int section)
+        : _section(section)
+        , _start(FrameProfiler::nowNanos())
+    {
+    }
+    
+    ~ProfileScope()
+    {
+        FrameProfiler::addSample(_section, FrameProfiler::nowNanos() - _start);
+    }
+    
+private:
+    ProfileScope(const ProfileScope&);
+    ProfileScope& operator=(const ProfileScope&);
+    
+    int _section;
+    uint64_t _start;
+};
+
+#if CARD_PROFILING
+#define CORE_PROFILE_SCOPE(section)     ProfileScope CORE_CONCAT(_profileScope, __LINE__)(section)
+#else
+#define CORE_PROFILE_SCOPE(section)
+#endif
+
+#endif // __FRAME_PROFILER_H__
@@ -0,0 +1,331 @@
+/**
+ * MicroBenchmark.cpp
+ * 微基准测试实现
+ */
+
+#include "MicroBenchmark.h"
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <math.h>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+// 迭代次数上限，防止被测代码为空时无限倍增
+static const uint64_t MAX_ITERATIONS = 1ull << 32;
+
+// 双侧95%的t分布临界值，下标为自由度（1-30），更大的自由度使用正态近似
+static const double T_CRITICAL_95[31] = {
+    0.0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+
+static volatile const void* s_keepSink = nullptr;
+
+/**
+ * 执行一个样本
+ * @return 单次迭代的纳秒数
+ */
+static double measureSample(const MicroBenchmark::Body& body, const MicroBenchmark::Body& setup,
+                            uint64_t iterations, uint64_t& elapsed)
+{
+    if (setup) {
+        setup(iterations);
+    }
+    uint64_t start = FrameProfiler::nowNanos();
+    body(iterations);
+    elapsed = FrameProfiler::nowNanos() - start;
+    return static_cast<double>(elapsed) / iterations;
+}
+
+/**
+ * 求中位数，会重排输入
+ */
+static double s_median(std::vector<double>& values)
+{
+    std::sort(values.begin(), values.end());
+    size_t count = values.size();
+    return count % 2 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2.0;
+}
+
+/**
+ * 运行间极差相对中位数的比例
+ */
+static double s_relativeSpread(const BenchmarkResult& result)
+{
+    return result.medianNanos > 0.0 ? result.runSpreadNanos / result.medianNanos : 0.0;
+}
+
+/**
+ * 读取对象文本中某个键的数值
+ * @return 找不到时返回defaultValue
+ */
+static double findNumber(const std::string& object, const char* key, double defaultValue)
+{
+    std::string pattern = std::string("\"") + key + "\"";
+    size_t pos = object.find(pattern);
+    if (pos == std::string::npos) {
+        return defaultValue;
+    }
+    pos = object.find(':', pos + pattern.size());
+    if (pos == std::string::npos) {
+        return defaultValue;
+    }
+    return atof(object.c_str() + pos + 1);
+}
+
+/**
+ * 读取对象文本中某个键的字符串（基准名称不含转义字符）
+ */
+static std::string findString(const std::string& object, const char* key)
+{
+    std::string pattern = std::string("\"") + key + "\"";
+    size_t pos = object.find(pattern);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    size_t begin = object.find('"', object.find(':', pos + pattern.size()));
+    size_t end = begin == std::string::npos ? std::string::npos : object.find('"', begin + 1);
+    if (end == std::string::npos) {
+        return "";
+    }
+    return object.substr(begin + 1, end - begin - 1);
+}
+
+void MicroBenchmark::run(const std::string& name, const Body& body, const BenchmarkOptions& options,
+                         BenchmarkResult& result, const Body& setup)
+{
+    result = BenchmarkResult();
+    result.name = name;
+    
+    // 倍增迭代次数，最后一次即预热样本
+    uint64_t iterations = 1;
+    uint64_t elapsed = 0;
+    while (true) {
+        measureSample(body, setup, iterations, elapsed);
+        if (elapsed >= options.minSampleNanos || iterations >= MAX_ITERATIONS) {
+            break;
+        }
+        uint64_t scale = elapsed == 0 ? 10 : (options.minSampleNanos + elapsed - 1) / elapsed;
+        iterations *= std::min<uint64_t>(std::max<uint64_t>(scale, 2), 10);
+    }
+    
+    int count = std::max(options.samples, 2);
+    std::vector<double> samples(count);
+    for (int i = 0; i < count; i++) {
+        samples[i] = measureSample(body, setup, iterations, elapsed);
+    }
+    
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    double mean = sum / count;
+    double squares = 0.0;
+    for (double sample : samples) {
+        squares += (sample - mean) * (sample - mean);
+    }
+    double stddev = sqrt(squares / (count - 1));
+    double t = count - 1 <= 30 ? T_CRITICAL_95[count - 1] : 1.960;
+    double halfWidth = t * stddev / sqrt(static_cast<double>(count));
+    
+    result.iterations = iterations;
+    result.samples = count;
+    result.meanNanos = mean;
+    result.stddevNanos = stddev;
+    result.ciLowNanos = mean - halfWidth;
+    result.ciHighNanos = mean + halfWidth;
+    result.medianNanos = s_median(samples);
+    result.minNanos = samples[0];
+}
+
+void MicroBenchmark::writeJson(const std::string& suite, const std::vector<BenchmarkResult>& results,
+                               std::ostream& output)
+{
+    char line[512];
+    output << "{\n  \"suite\": \"" << suite << "\",\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        snprintf(line, sizeof(line),
+                 "    {\"name\": \"%s\", \"iterations\": %llu, \"samples\": %d, \"mean_ns\": %.3f, "
+                 "\"stddev_ns\": %.3f, \"ci95_low_ns\": %.3f, \"ci95_high_ns\": %.3f, \"median_ns\": %.3f, "
+                 "\"min_ns\": %.3f, \"runs\": %d, \"run_spread_ns\": %.3f}%s\n",
+                 r.name.c_str(), static_cast<unsigned long long>(r.iterations), r.samples, r.meanNanos,
+                 r.stddevNanos, r.ciLowNanos, r.ciHighNanos, r.medianNanos, r.minNanos, r.runs, r.runSpreadNanos,
+                 i + 1 < results.size() ? "," : "");
+        output << line;
+    }
+    output << "  ]\n}\n";
+}
+
+bool MicroBenchmark::writeJsonFile(const std::string& suite, const std::vector<BenchmarkResult>& results,
+                                   const std::string& filePath)
+{
+    std::ofstream output(filePath.c_str(), std::ios::binary);
+    if (!output) {
+        return false;
+    }
+    
+    writeJson(suite, results, output);
+    return output.good();
+}
+
+bool MicroBenchmark::parseJson(const std::string& text, std::vector<BenchmarkResult>& results)
+{
+    results.clear();
+    size_t pos = text.find("\"benchmarks\"");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    
+    // 每项结果是不含嵌套的对象
+    while ((pos = text.find('{', pos)) != std::string::npos) {
+        size_t end = text.find('}', pos);
+        if (end == std::string::npos) {
+            break;
+        }
+        std::string object = text.substr(pos, end - pos + 1);
+        pos = end + 1;
+        
+        BenchmarkResult result;
+        result.name = findString(object, "name");
+        if (result.name.empty()) {
+            continue;
+        }
+        result.iterations = static_cast<uint64_t>(findNumber(object, "iterations", 0.0));
+        result.samples = static_cast<int>(findNumber(object, "samples", 0.0));
+        result.meanNanos = findNumber(object, "mean_ns", 0.0);
+        result.stddevNanos = findNumber(object, "stddev_ns", 0.0);
+        result.ciLowNanos = findNumber(object, "ci95_low_ns", result.meanNanos);
+        result.ciHighNanos = findNumber(object, "ci95_high_ns", result.meanNanos);
+        result.medianNanos = findNumber(object, "median_ns", result.meanNanos);
+        result.minNanos = findNumber(object, "min_ns", result.meanNanos);
+        result.runs = std::max(static_cast<int>(findNumber(object, "runs", 1.0)), 1);
+        result.runSpreadNanos = findNumber(object, "run_spread_ns", 0.0);
+        results.push_back(result);
+    }
+    return !results.empty();
+}
+
+bool MicroBenchmark::loadJsonFile(const std::string& filePath, std::vector<BenchmarkResult>& results)
+{
+    std::ifstream input(filePath.c_str(), std::ios::binary);
+    if (!input) {
+        return false;
+    }
+    
+    std::stringstream buffer;
+    buffer << input.rdbuf();
+    return parseJson(buffer.str(), results);
+}
+
+void MicroBenchmark::merge(const std::vector<std::vector<BenchmarkResult>>& runs, std::vector<BenchmarkResult>& merged)
+{
+    merged.clear();
+    std::vector<std::string> names;
+    std::map<std::string, std::vector<const BenchmarkResult*>> byName;
+    for (const auto& run : runs) {
+        for (const auto& result : run) {
+            auto& entries = byName[result.name];
+            if (entries.empty()) {
+                names.push_back(result.name);
+            }
+            entries.push_back(&result);
+        }
+    }
+    
+    for (const auto& name : names) {
+        const auto& entries = byName[name];
+        BenchmarkResult result = *entries[0];
+        if (entries.size() > 1) {
+            // 均值与方差取平均，置信区间取各次的包络，中位数取各次中位数的中位数
+            std::vector<double> medians;
+            double meanSum = 0.0;
+            double varianceSum = 0.0;
+            double spread = 0.0;
+            result.samples = 0;
+            result.runs = 0;
+            for (const BenchmarkResult* entry : entries) {
+                medians.push_back(entry->medianNanos);
+                meanSum += entry->meanNanos;
+                varianceSum += entry->stddevNanos * entry->stddevNanos;
+                spread = std::max(spread, entry->runSpreadNanos);
+                result.samples += entry->samples;
+                result.runs += entry->runs;
+                result.ciLowNanos = std::min(result.ciLowNanos, entry->ciLowNanos);
+                result.ciHighNanos = std::max(result.ciHighNanos, entry->ciHighNanos);
+                result.minNanos = std::min(result.minNanos, entry->minNanos);
+            }
+            auto range = std::minmax_element(medians.begin(), medians.end());
+            result.runSpreadNanos = std::max(spread, *range.second - *range.first);
+            result.meanNanos = meanSum / entries.size();
+            result.stddevNanos = sqrt(varianceSum / entries.size());
+            result.medianNanos = s_median(medians);
+        }
+        merged.push_back(result);
+    }
+}
+
+int MicroBenchmark::compare(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current,
+                            double threshold, std::ostream& report)
+{
+    std::map<std::string, const BenchmarkResult*> baselineByName;
+    for (const auto& result : baseline) {
+        baselineByName[result.name] = &result;
+    }
+    
+    char line[256];
+    snprintf(line, sizeof(line), "%-32s %14s %14s %9s %9s  %s\n", "benchmark", "baseline ns", "current ns", "change",
+             "spread", "verdict");
+    report << line;
+    
+    int regressions = 0;
+    for (const auto& result : current) {
+        auto it = baselineByName.find(result.name);
+        if (it == baselineByName.end()) {
+            snprintf(line, sizeof(line), "%-32s %14s %14.1f %9s %9s  new\n", result.name.c_str(), "-",
+                     result.medianNanos, "-", "-");
+            report << line;
+            continue;
+        }
+        
+        const BenchmarkResult& base = *it->second;
+        double change = base.medianNanos > 0.0 ? result.medianNanos / base.medianNanos - 1.0 : 0.0;
+        
+        // 变化要超出两边观察到的运行间波动；没有多次运行时不知道波动有多大，不下结论
+        double spread = std::max(s_relativeSpread(base), s_relativeSpread(result));
+        bool measured = base.runs > 1 && result.runs > 1;
+        const char* verdict = "same";
+        if (fabs(change) > threshold) {
+            if (!measured) {
+                verdict = "unverified";
+            } else if (change > threshold + spread) {
+                verdict = "REGRESSION";
+                regressions++;
+            } else if (change < -(threshold + spread)) {
+                verdict = "improved";
+            } else {
+                verdict = "noisy";
+            }
+        }
+        snprintf(line, sizeof(line), "%-32s %14.1f %14.1f %+8.1f%% %8.1f%%  %s\n", result.name.c_str(),
+                 base.medianNanos, result.medianNanos, change * 100.0, spread * 100.0, verdict);
+        report << line;
+        baselineByName.erase(it);
+    }
+    
+    for (const auto& entry : baselineByName) {
+        snprintf(line, sizeof(line), "%-32s %14.1f %14s %9s %9s  missing\n", entry.first.c_str(),
+                 entry.second->medianNanos, "-", "-", "-");
+        report << line;
+    }
+    return regressions;
+}
+
+void MicroBenchmark::keep(const void* pointer)
+{
+    s_keepSink = pointer;
+}
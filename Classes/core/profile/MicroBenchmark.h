@@ -0,0 +1,138 @@
+/**
+ * MicroBenchmark.h
+ * 微基准测试：自动确定每个样本的迭代次数，给出均值与95%置信区间，合并多次进程运行的结果，
+ * 结果以JSON保存并可与基线比较
+ */
+
+#ifndef __MICRO_BENCHMARK_H__
+#define __MICRO_BENCHMARK_H__
+
+#include <stdint.h>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * 运行参数
+ */
+struct BenchmarkOptions
+{
+    int samples;                // 样本数（不含预热样本）
+    uint64_t minSampleNanos;    // 每个样本的最短耗时，迭代次数按此倍增
+    
+    BenchmarkOptions()
+        : samples(30)
+        , minSampleNanos(5000000)
+    {}
+};
+
+/**
+ * 一项基准的结果，时间均为单次迭代的纳秒数
+ */
+struct BenchmarkResult
+{
+    std::string name;           // 基准名称
+    uint64_t iterations;        // 每个样本的迭代次数
+    int samples;                // 样本数
+    double meanNanos;           // 均值
+    double stddevNanos;         // 样本标准差
+    double ciLowNanos;          // 均值95%置信区间下界
+    double ciHighNanos;         // 均值95%置信区间上界
+    double medianNanos;         // 中位数（合并多次运行时为各次中位数的中位数）
+    double minNanos;            // 最小值
+    int runs;                   // 合并的进程运行次数
+    double runSpreadNanos;      // 各次运行中位数的极差，只有一次运行时为0
+    
+    BenchmarkResult()
+        : iterations(0)
+        , samples(0)
+        , meanNanos(0.0)
+        , stddevNanos(0.0)
+        , ciLowNanos(0.0)
+        , ciHighNanos(0.0)
+        , medianNanos(0.0)
+        , minNanos(0.0)
+        , runs(1)
+        , runSpreadNanos(0.0)
+    {}
+};
+
+/**
+ * 微基准测试工具
+ * 被测代码写成 body(iterations)，在其中循环执行iterations次；
+ * 先倍增迭代次数直到单个样本不短于minSampleNanos，丢弃一个预热样本后采集samples个样本。
+ * 置信区间按t分布计算，只反映同一进程内的波动；不同进程之间（内存布局、CPU频率等）的差异往往更大，
+ * 因此比较时使用多次进程运行合并后的中位数，只有变化超过阈值加上两边的运行间极差才算退化或改进，
+ * 任一边只有一次运行时无法判断，超过阈值也只记为unverified
+ */
+class MicroBenchmark
+{
+public:
+    typedef std::function<void(uint64_t iterations)> Body;
+    
+    /**
+     * 运行一项基准
+     * @param name 基准名称
+     * @param body 被测代码
+     * @param options 运行参数
+     * @param result 输出结果
+     * @param setup 每个样本之前执行、不计时的准备代码（如为iterations次迭代各准备一份输入），可为空
+     */
+    static void run(const std::string& name, const Body& body, const BenchmarkOptions& options,
+                    BenchmarkResult& result, const Body& setup = Body());
+    
+    /**
+     * 写出JSON结果
+     * @param suite 基准集名称
+     * @param results 结果
+     * @param output 输出流
+     */
+    static void writeJson(const std::string& suite, const std::vector<BenchmarkResult>& results, std::ostream& output);
+    
+    /**
+     * 写出JSON结果文件
+     * @return 是否写入成功
+     */
+    static bool writeJsonFile(const std::string& suite, const std::vector<BenchmarkResult>& results,
+                              const std::string& filePath);
+    
+    /**
+     * 解析writeJson写出的结果
+     * @param text JSON文本
+     * @param results 输出结果
+     * @return 是否至少解析出一项结果
+     */
+    static bool parseJson(const std::string& text, std::vector<BenchmarkResult>& results);
+    
+    /**
+     * 读取并解析结果文件
+     * @return 是否至少解析出一项结果
+     */
+    static bool loadJsonFile(const std::string& filePath, std::vector<BenchmarkResult>& results);
+    
+    /**
+     * 按名称合并多次运行的结果，保持第一次出现的顺序
+     * @param runs 每次运行的结果
+     * @param merged 输出合并后的结果
+     */
+    static void merge(const std::vector<std::vector<BenchmarkResult>>& runs, std::vector<BenchmarkResult>& merged);
+    
+    /**
+     * 按名称比较两组结果并输出报告
+     * @param baseline 基线结果
+     * @param current 当前结果
+     * @param threshold 中位数相对变化的阈值（如0.05为5%），实际使用的阈值再加上两边的相对运行间极差
+     * @param report 报告输出流
+     * @return 退化的项数
+     */
+    static int compare(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current,
+                       double threshold, std::ostream& report);
+    
+    /**
+     * 阻止编译器把结果未被使用的计算优化掉
+     */
+    static void keep(const void* pointer);
+};
+
+#endif // __MICRO_BENCHMARK_H__
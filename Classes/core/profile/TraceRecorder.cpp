@@ -0,0 +1,207 @@
+/**
+ * TraceRecorder.cpp
+ * 追踪记录器实现
+ */
+
+#include "TraceRecorder.h"
+#include "FrameProfiler.h"
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <stdio.h>
+#include <vector>
+
+/**
+ * 一个线程的环形缓冲
+ * head只由所属线程写入；导出时在停止记录后读取
+ */
+struct ThreadTraceBuffer
+{
+    TraceEvent* events;
+    std::atomic<uint64_t> head;         // 累计写入的事件数
+    int threadId;
+    std::string threadName;
+};
+
+std::atomic<bool> TraceRecorder::_enabled(false);
+
+// 已登记的缓冲与线程名、驻留字符串，由s_registryMutex保护
+static std::mutex s_registryMutex;
+static std::vector<ThreadTraceBuffer*> s_buffers;
+static std::set<std::string> s_internedNames;
+static uint64_t s_startNanos = 0;
+
+// 当前线程的缓冲，第一次记录时登记；线程退出后缓冲仍保留，供导出使用
+static thread_local ThreadTraceBuffer* t_buffer = nullptr;
+
+static const char* const PHASE_CODES[] = { "B", "E", "i" };
+
+/**
+ * 获取当前线程的缓冲，未登记时分配并登记
+ */
+static ThreadTraceBuffer* getThreadBuffer()
+{
+    if (t_buffer) {
+        return t_buffer;
+    }
+    
+    ThreadTraceBuffer* buffer = new ThreadTraceBuffer();
+    buffer->events = new TraceEvent[TraceRecorder::BUFFER_CAPACITY];
+    buffer->head.store(0, std::memory_order_relaxed);
+    
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    buffer->threadId = static_cast<int>(s_buffers.size()) + 1;
+    s_buffers.push_back(buffer);
+    t_buffer = buffer;
+    return buffer;
+}
+
+/**
+ * 写入带转义的JSON字符串
+ */
+static void writeJsonString(std::ostream& output, const char* text)
+{
+    output << '"';
+    for (const char* p = text; *p; p++) {
+        char c = *p;
+        if (c == '"' || c == '\\') {
+            output << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+            output << escaped;
+        } else {
+            output << c;
+        }
+    }
+    output << '"';
+}
+
+void TraceRecorder::start()
+{
+    _enabled.store(false, std::memory_order_relaxed);
+    clear();
+    {
+        std::lock_guard<std::mutex> lock(s_registryMutex);
+        s_startNanos = FrameProfiler::nowNanos();
+    }
+    _enabled.store(true, std::memory_order_release);
+}
+
+void TraceRecorder::stop()
+{
+    _enabled.store(false, std::memory_order_release);
+}
+
+void TraceRecorder::record(int phase, const char* category, const char* name)
+{
+    if (!isEnabled()) {
+        return;
+    }
+    
+    ThreadTraceBuffer* buffer = getThreadBuffer();
+    uint64_t index = buffer->head.load(std::memory_order_relaxed);
+    TraceEvent& event = buffer->events[index & (BUFFER_CAPACITY - 1)];
+    event.timestamp = FrameProfiler::nowNanos();
+    event.category = category;
+    event.name = name;
+    event.phase = phase;
+    buffer->head.store(index + 1, std::memory_order_release);
+}
+
+void TraceRecorder::setThreadName(const std::string& name)
+{
+    ThreadTraceBuffer* buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    buffer->threadName = name;
+}
+
+const char* TraceRecorder::internName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    return s_internedNames.insert(name).first->c_str();
+}
+
+void TraceRecorder::clear()
+{
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    for (ThreadTraceBuffer* buffer : s_buffers) {
+        buffer->head.store(0, std::memory_order_relaxed);
+    }
+}
+
+int TraceRecorder::getEventCount()
+{
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    uint64_t count = 0;
+    for (ThreadTraceBuffer* buffer : s_buffers) {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        count += head < BUFFER_CAPACITY ? head : BUFFER_CAPACITY;
+    }
+    return static_cast<int>(count);
+}
+
+void TraceRecorder::writeChromeTrace(std::ostream& output)
+{
+    std::lock_guard<std::mutex> lock(s_registryMutex);
+    
+    output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    char line[160];
+    
+    for (ThreadTraceBuffer* buffer : s_buffers) {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        if (head == 0) {
+            continue;
+        }
+        
+        if (!buffer->threadName.empty()) {
+            snprintf(line, sizeof(line), "{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":",
+                     buffer->threadId);
+            output << (first ? "" : ",\n") << line;
+            writeJsonString(output, buffer->threadName.c_str());
+            output << "}}";
+            first = false;
+        }
+        
+        uint64_t count = head < BUFFER_CAPACITY ? head : BUFFER_CAPACITY;
+        int depth = 0;
+        for (uint64_t i = head - count; i < head; i++) {
+            const TraceEvent& event = buffer->events[i & (BUFFER_CAPACITY - 1)];
+            if (event.phase == TP_BEGIN) {
+                depth++;
+            } else if (event.phase == TP_END) {
+                // 开头的开始事件已被覆盖
+                if (depth == 0) {
+                    continue;
+                }
+                depth--;
+            }
+            
+            uint64_t nanos = event.timestamp > s_startNanos ? event.timestamp - s_startNanos : 0;
+            output << (first ? "" : ",\n") << "{\"name\":";
+            writeJsonString(output, event.name);
+            output << ",\"cat\":";
+            writeJsonString(output, event.category);
+            snprintf(line, sizeof(line), ",\"ph\":\"%s\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%d%s}",
+                     PHASE_CODES[event.phase], static_cast<unsigned long long>(nanos / 1000),
+                     static_cast<unsigned>(nanos % 1000), buffer->threadId,
+                     event.phase == TP_INSTANT ? ",\"s\":\"t\"" : "");
+            output << line;
+            first = false;
+        }
+    }
+    
+    output << "\n]}\n";
+}
+
+bool TraceRecorder::writeChromeTraceFile(const std::string& filePath)
+{
+    std::ofstream output(filePath.c_str(), std::ios::binary);
+    if (!output) {
+        return false;
+    }
+    
+    writeChromeTrace(output);
+    return output.good();
+}
@@ -0,0 +1,154 @@
+/**
+ * TraceRecorder.h
+ * 按线程环形缓冲记录开始/结束事件，导出为Chrome trace JSON（可用Perfetto打开）
+ */
+
+#ifndef __TRACE_RECORDER_H__
+#define __TRACE_RECORDER_H__
+
+#include "../CoreMacros.h"
+#include <atomic>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+/**
+ * 事件类型，对应Chrome trace的ph字段
+ */
+enum TracePhase
+{
+    TP_BEGIN = 0,       // "B"，与同线程上一个未结束的TP_BEGIN配对
+    TP_END,             // "E"
+    TP_INSTANT          // "i"，瞬时事件（如帧边界）
+};
+
+/**
+ * 一条追踪事件
+ * 名称与分类只保存指针，必须是字符串常量或internName返回的字符串
+ */
+struct TraceEvent
+{
+    uint64_t timestamp;     // 单调时钟纳秒
+    const char* category;
+    const char* name;
+    int phase;
+};
+
+/**
+ * 追踪记录器
+ * 每个线程第一次记录时分配自己的环形缓冲并登记，之后写入不加锁、不分配内存；
+ * 缓冲写满后覆盖最旧的事件，只保留最近的记录。
+ * 运行时开关关闭时记录宏只做一次原子读；CARD_PROFILING关闭时记录宏不产生任何代码。
+ * 导出与清空前应先stop，避免与仍在写入的线程交错
+ */
+class TraceRecorder
+{
+public:
+    static const int BUFFER_CAPACITY = 1 << 15;     // 每线程缓冲事件数，须为2的幂
+    
+    /**
+     * 开始记录：清空所有缓冲并以当前时间为时间零点
+     */
+    static void start();
+    
+    /**
+     * 停止记录，已记录的事件保留到下次start或clear
+     */
+    static void stop();
+    
+    /**
+     * 是否正在记录
+     */
+    static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+    
+    /**
+     * 记录一条事件，未开启记录时直接返回
+     * @param phase 事件类型（TracePhase）
+     * @param category 分类
+     * @param name 名称
+     */
+    static void record(int phase, const char* category, const char* name);
+    
+    /**
+     * 设置当前线程在追踪视图中显示的名称
+     * @param name 线程名称（复制保存）
+     */
+    static void setThreadName(const std::string& name);
+    
+    /**
+     * 把运行时生成的字符串（如纹理路径）转为可长期持有的指针，相同内容返回同一指针
+     * 需要加锁，只用于低频事件
+     */
+    static const char* internName(const std::string& name);
+    
+    /**
+     * 清空所有线程的缓冲
+     */
+    static void clear();
+    
+    /**
+     * 获取所有缓冲中现存的事件数
+     */
+    static int getEventCount();
+    
+    /**
+     * 导出为Chrome trace JSON，时间戳为相对start的微秒
+     * 环形缓冲覆盖造成的开头不成对的结束事件会被跳过
+     * @param output 输出流
+     */
+    static void writeChromeTrace(std::ostream& output);
+    
+    /**
+     * 导出为Chrome trace JSON文件
+     * @param filePath 文件路径
+     * @return 写入成功返回true
+     */
+    static bool writeChromeTraceFile(const std::string& filePath);
+    
+private:
+    static std::atomic<bool> _enabled;
+};
+
+/**
+ * 作用域追踪，构造时记录开始、析构时记录结束
+ * 构造时未开启记录则析构时也不记录，避免产生不成对的结束事件
+ */
+class TraceScope
+{
+public:
+    TraceScope(const char* category, const char* name)
+        : _category(category)
+        , _name(name)
+        , _active(TraceRecorder::isEnabled())
+    {
+        if (_active) {
+            TraceRecorder::record(TP_BEGIN, _category, _name);
+        }
+    }
+    
+    ~TraceScope()
+    {
+        if (_active) {
+            TraceRecorder::record(TP_END, _category, _name);
+        }
+    }
+    
+private:
+    TraceScope(const TraceScope&);
+    TraceScope& operator=(const TraceScope&);
+    
+    const char* _category;
+    const char* _name;
+    bool _active;
+};
+
+#if CARD_PROFILING
+#define CORE_TRACE_SCOPE(category, name)    TraceScope CORE_CONCAT(_traceScope, __LINE__)(category, name)
+#define CORE_TRACE_INSTANT(category, name)  \
+    do { if (TraceRecorder::isEnabled()) TraceRecorder::record(TP_INSTANT, category, name); } while (0)
+#else
+#define CORE_TRACE_SCOPE(category, name)
+#define CORE_TRACE_INSTANT(category, name)  do {} while (0)
+#endif
+
+#endif // __TRACE_RECORDER_H__
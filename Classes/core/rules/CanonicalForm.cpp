@@ -0,0 +1,71 @@
+/**
+ * CanonicalForm.cpp
+ * 规范形式实现
+ */
+
+#include "CanonicalForm.h"
+
+static const uint64_t FNV_OFFSET_BASIS = 1469598103934665603ULL;
+static const uint64_t FNV_PRIME = 1099511628211ULL;
+
+/**
+ * 按小端序追加16位整数
+ */
+static void appendUint16(std::vector<uint8_t>& form, int value)
+{
+    form.push_back(static_cast<uint8_t>(value & 0xFF));
+    form.push_back(static_cast<uint8_t>((value >> 8) & 0xFF));
+}
+
+void CanonicalForm::buildDealForm(const CompactDeal& deal, std::vector<uint8_t>& form)
+{
+    int counts[CardRules::NUM_CARD_VALUES] = { 0 };
+    for (auto face : deal.getPlayfieldFaces()) {
+        counts[face]++;
+    }
+    
+    form.clear();
+    form.reserve(CardRules::NUM_CARD_VALUES * 2 + 2 + deal.getStackCount());
+    for (int value = 0; value < CardRules::NUM_CARD_VALUES; value++) {
+        appendUint16(form, counts[value]);
+    }
+    
+    // 备用牌堆按抽出顺序的反序保存，与牌局定义一致
+    appendUint16(form, deal.getStackCount());
+    for (auto face : deal.getStackFaces()) {
+        form.push_back(face);
+    }
+}
+
+uint64_t CanonicalForm::hashDeal(const CompactDeal& deal)
+{
+    std::vector<uint8_t> form;
+    buildDealForm(deal, form);
+    return hashBytes(form.data(), form.size());
+}
+
+uint64_t CanonicalForm::hashState(const CompactGameState& state)
+{
+    uint8_t form[CardRules::NUM_CARD_VALUES * 2 + 3];
+    size_t size = 0;
+    for (int value = CardRules::MIN_CARD_VALUE; value <= CardRules::MAX_CARD_VALUE; value++) {
+        int count = state.getValueCount(value);
+        form[size++] = static_cast<uint8_t>(count & 0xFF);
+        form[size++] = static_cast<uint8_t>((count >> 8) & 0xFF);
+    }
+    form[size++] = static_cast<uint8_t>(state.getStackRemaining() & 0xFF);
+    form[size++] = static_cast<uint8_t>((state.getStackRemaining() >> 8) & 0xFF);
+    form[size++] = static_cast<uint8_t>(state.getTrayValue());
+    
+    return hashBytes(form, size);
+}
+
+uint64_t CanonicalForm::hashBytes(const uint8_t* data, size_t size)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
@@ -0,0 +1,54 @@
+/**
+ * CanonicalForm.h
+ * 与花色无关的牌局与状态规范形式
+ */
+
+#ifndef __CANONICAL_FORM_H__
+#define __CANONICAL_FORM_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "CompactGameState.h"
+
+/**
+ * 规范形式类
+ * 匹配规则只比较数值，主牌区卡牌都可以直接点击，因此花色、位置和主牌区顺序都不影响对局：
+ * - 牌局规范形式：主牌区各数值的数量 + 备用牌堆的数值序列
+ * - 状态规范形式：主牌区各数值的剩余数量 + 备用牌堆剩余数 + 手牌数值（在同一牌局内比较）
+ * 哈希按固定字节序计算FNV-1a，跨平台、跨进程稳定，可以写入关卡文件
+ */
+class CanonicalForm
+{
+public:
+    /**
+     * 生成牌局的规范形式字节串，两个牌局规范形式相同当且仅当只差花色、位置或主牌区顺序
+     * @param deal 牌局定义
+     * @param form 输出的字节串
+     */
+    static void buildDealForm(const CompactDeal& deal, std::vector<uint8_t>& form);
+    
+    /**
+     * 计算牌局的规范哈希
+     * @param deal 牌局定义
+     * @return 规范哈希
+     */
+    static uint64_t hashDeal(const CompactDeal& deal);
+    
+    /**
+     * 计算状态的规范哈希，主牌区中数值相同的卡牌互换后哈希不变
+     * @param state 对局状态
+     * @return 规范哈希
+     */
+    static uint64_t hashState(const CompactGameState& state);
+    
+    /**
+     * 计算字节串的FNV-1a哈希
+     * @param data 数据
+     * @param size 字节数
+     * @return 哈希
+     */
+    static uint64_t hashBytes(const uint8_t* data, size_t size);
+};
+
+#endif // __CANONICAL_FORM_H__
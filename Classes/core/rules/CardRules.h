@@ -0,0 +1,153 @@
+/**
+ * CardRules.h
+ * 卡牌匹配规则，供GameModel与所有无界面的规则实现共用
+ */
+
+#ifndef __CARD_RULES_H__
+#define __CARD_RULES_H__
+
+#include <stdint.h>
+
+/**
+ * 卡牌规则类，集中定义数值范围与匹配条件
+ */
+class CardRules
+{
+public:
+    static const int MIN_CARD_VALUE = 1;     // 最小卡牌数值（A）
+    static const int MAX_CARD_VALUE = 13;    // 最大卡牌数值（K）
+    static const int NUM_CARD_VALUES = 13;   // 卡牌数值个数
+    
+    /**
+     * 检查两个卡牌数值是否可以匹配（默认规则：数字相差1）
+     * @param value 要移动的卡牌数值
+     * @param targetValue 手牌区顶部卡牌数值
+     * @return 是否可以匹配
+     */
+    static bool canMatchValues(int value, int targetValue);
+};
+
+/**
+ * 规则策略
+ * 每个策略提供constexpr的matches(value, targetValue)，只在编译期用于生成匹配表（见RuleMatchTable）。
+ * 模型、求解器与模拟器以策略为模板参数，每个变体单独实例化，匹配检查内联为一次查表
+ */
+
+/**
+ * 默认规则：数字相差1
+ */
+struct AdjacentRule
+{
+    static constexpr bool matches(int value, int targetValue)
+    {
+        return value - targetValue == 1 || targetValue - value == 1;
+    }
+};
+
+/**
+ * 循环规则：数字相差1，K与A相连
+ */
+struct WrapRule
+{
+    static constexpr bool matches(int value, int targetValue)
+    {
+        return AdjacentRule::matches(value, targetValue)
+            || (value == CardRules::MIN_CARD_VALUE && targetValue == CardRules::MAX_CARD_VALUE)
+            || (value == CardRules::MAX_CARD_VALUE && targetValue == CardRules::MIN_CARD_VALUE);
+    }
+};
+
+/**
+ * 跨步规则：数字相差1或2
+ */
+struct TwoStepRule
+{
+    static constexpr bool matches(int value, int targetValue)
+    {
+        return AdjacentRule::matches(value, targetValue) || value - targetValue == 2 || targetValue - value == 2;
+    }
+};
+
+/**
+ * 万能牌规则：数字相差1，或任一方为万能牌数值（牌面中没有单独的小丑牌，用指定数值代替）
+ */
+template <int WILD_VALUE>
+struct WildcardRule
+{
+    static constexpr bool matches(int value, int targetValue)
+    {
+        return value == WILD_VALUE || targetValue == WILD_VALUE || AdjacentRule::matches(value, targetValue);
+    }
+};
+
+/**
+ * 小丑牌规则：K为万能牌
+ */
+typedef WildcardRule<CardRules::MAX_CARD_VALUE> JokerRule;
+
+/**
+ * 游戏使用的规则
+ */
+typedef AdjacentRule DefaultRule;
+
+/**
+ * 编译期匹配表
+ * 13x13的匹配关系按手牌数值打包为掩码：MATCH_MASKS[t]的第v-1位表示数值v能否打到数值t上，
+ * 下标0表示手牌区为空，任何卡牌都可以打出
+ */
+template <typename Rule>
+struct RuleMatchTable
+{
+    static constexpr uint16_t ALL_VALUES_MASK = (1u << CardRules::NUM_CARD_VALUES) - 1;
+    
+    /**
+     * 生成某个手牌数值的掩码，从value开始递归累加（C++11的constexpr函数只能有一条return语句）
+     */
+    static constexpr uint16_t buildMask(int targetValue, int value)
+    {
+        return value > CardRules::MAX_CARD_VALUE ? 0
+            : static_cast<uint16_t>((Rule::matches(value, targetValue) ? (1u << (value - 1)) : 0u)
+                                    | buildMask(targetValue, value + 1));
+    }
+    
+    static constexpr uint16_t MATCH_MASKS[CardRules::MAX_CARD_VALUE + 1] = {
+        ALL_VALUES_MASK,
+        buildMask(1, 1), buildMask(2, 1), buildMask(3, 1), buildMask(4, 1), buildMask(5, 1),
+        buildMask(6, 1), buildMask(7, 1), buildMask(8, 1), buildMask(9, 1), buildMask(10, 1),
+        buildMask(11, 1), buildMask(12, 1), buildMask(13, 1)
+    };
+    
+    /**
+     * 获取能打到手牌上的数值掩码
+     * @param targetValue 手牌区顶部卡牌数值（0表示为空）
+     * @return 数值掩码，第v-1位对应数值v
+     */
+    static uint16_t getMatchMask(int targetValue) { return MATCH_MASKS[targetValue]; }
+    
+    /**
+     * 检查两个卡牌数值是否可以匹配
+     * @param value 要移动的卡牌数值
+     * @param targetValue 手牌区顶部卡牌数值（0表示为空）
+     * @return 是否可以匹配
+     */
+    static bool canMatch(int value, int targetValue) { return (MATCH_MASKS[targetValue] >> (value - 1)) & 1; }
+};
+
+template <typename Rule>
+constexpr uint16_t RuleMatchTable<Rule>::MATCH_MASKS[CardRules::MAX_CARD_VALUE + 1];
+
+inline bool CardRules::canMatchValues(int value, int targetValue)
+{
+    return RuleMatchTable<DefaultRule>::canMatch(value, targetValue);
+}
+
+/**
+ * 为所有规则变体显式实例化模板类，放在模板实现所在的.cpp末尾
+ */
+#define CARD_RULES_INSTANTIATE(TEMPLATE)        \
+    template class TEMPLATE<AdjacentRule>;      \
+    template class TEMPLATE<WrapRule>;          \
+    template class TEMPLATE<TwoStepRule>;       \
+    template class TEMPLATE<JokerRule>;
+
+#endif // __CARD_RULES_H__
@@ -0,0 +1,63 @@
+/**
+ * CompactDeal.cpp
+ * 紧凑牌局定义实现
+ */
+
+#include "CompactDeal.h"
+#include <stddef.h>
+#include "configs/models/LevelConfig.h"
+#include "models/CardModel.h"
+
+CompactDeal::CompactDeal()
+{
+}
+
+bool CompactDeal::initWithLevelConfig(const LevelConfig* levelConfig)
+{
+    if (!levelConfig) {
+        return false;
+    }
+    
+    std::vector<uint8_t> playfieldFaces, playfieldSuits, stackFaces, stackSuits;
+    for (const auto& config : levelConfig->getPlayfieldCards()) {
+        playfieldFaces.push_back(static_cast<uint8_t>(config.cardFace));
+        playfieldSuits.push_back(static_cast<uint8_t>(config.cardSuit));
+    }
+    for (const auto& config : levelConfig->getStackCards()) {
+        stackFaces.push_back(static_cast<uint8_t>(config.cardFace));
+        stackSuits.push_back(static_cast<uint8_t>(config.cardSuit));
+    }
+    
+    return init(playfieldFaces, playfieldSuits, stackFaces, stackSuits);
+}
+
+bool CompactDeal::init(const std::vector<uint8_t>& playfieldFaces, const std::vector<uint8_t>& playfieldSuits,
+                       const std::vector<uint8_t>& stackFaces, const std::vector<uint8_t>& stackSuits)
+{
+    // 与GameModel::init保持一致：两个区域都不能为空
+    if (playfieldFaces.empty() || stackFaces.empty()) {
+        return false;
+    }
+    if (playfieldFaces.size() != playfieldSuits.size() || stackFaces.size() != stackSuits.size()) {
+        return false;
+    }
+    
+    // 检查面值与花色范围
+    for (size_t i = 0; i < playfieldFaces.size(); i++) {
+        if (playfieldFaces[i] >= CFT_NUM_CARD_FACE_TYPES || playfieldSuits[i] >= CST_NUM_CARD_SUIT_TYPES) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < stackFaces.size(); i++) {
+        if (stackFaces[i] >= CFT_NUM_CARD_FACE_TYPES || stackSuits[i] >= CST_NUM_CARD_SUIT_TYPES) {
+            return false;
+        }
+    }
+    
+    _playfieldFaces = playfieldFaces;
+    _playfieldSuits = playfieldSuits;
+    _stackFaces = stackFaces;
+    _stackSuits = stackSuits;
+    
+    return true;
+}
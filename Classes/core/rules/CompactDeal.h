@@ -0,0 +1,102 @@
+/**
+ * CompactDeal.h
+ * 紧凑的牌局定义，保存一局游戏初始时的所有卡牌
+ */
+
+#ifndef __COMPACT_DEAL_H__
+#define __COMPACT_DEAL_H__
+
+#include <stdint.h>
+#include <vector>
+
+class LevelConfig;
+
+/**
+ * 紧凑牌局类，只保存规则需要的面值与花色，不保存位置
+ * 主牌区下标与GameModelFromLevelGenerator生成的卡牌ID一致
+ * 备用牌堆最后一张最先被抽出（与GameModel一致）
+ */
+class CompactDeal
+{
+public:
+    /**
+     * 创建空牌局
+     */
+    CompactDeal();
+    
+    /**
+     * 从关卡配置初始化牌局
+     * @param levelConfig 关卡配置
+     * @return 是否初始化成功
+     */
+    bool initWithLevelConfig(const LevelConfig* levelConfig);
+    
+    /**
+     * 从卡牌面值与花色初始化牌局
+     * @param playfieldFaces 主牌区卡牌面值（CardFaceType）
+     * @param playfieldSuits 主牌区卡牌花色（CardSuitType）
+     * @param stackFaces 备用牌堆卡牌面值
+     * @param stackSuits 备用牌堆卡牌花色
+     * @return 是否初始化成功
+     */
+    bool init(const std::vector<uint8_t>& playfieldFaces, const std::vector<uint8_t>& playfieldSuits,
+              const std::vector<uint8_t>& stackFaces, const std::vector<uint8_t>& stackSuits);
+    
+    /**
+     * 获取主牌区卡牌数量
+     * @return 卡牌数量
+     */
+    int getPlayfieldCount() const { return static_cast<int>(_playfieldFaces.size()); }
+    
+    /**
+     * 获取备用牌堆卡牌数量（包含开局翻到手牌区的一张）
+     * @return 卡牌数量
+     */
+    int getStackCount() const { return static_cast<int>(_stackFaces.size()); }
+    
+    /**
+     * 获取主牌区卡牌数值（1-13）
+     * @param index 卡牌下标
+     * @return 卡牌数值
+     */
+    int getPlayfieldValue(int index) const { return _playfieldFaces[index] + 1; }
+    
+    /**
+     * 获取备用牌堆卡牌数值（1-13）
+     * @param index 卡牌下标
+     * @return 卡牌数值
+     */
+    int getStackValue(int index) const { return _stackFaces[index] + 1; }
+    
+    /**
+     * 获取主牌区卡牌面值列表
+     * @return 面值列表
+     */
+    const std::vector<uint8_t>& getPlayfieldFaces() const { return _playfieldFaces; }
+    
+    /**
+     * 获取主牌区卡牌花色列表
+     * @return 花色列表
+     */
+    const std::vector<uint8_t>& getPlayfieldSuits() const { return _playfieldSuits; }
+    
+    /**
+     * 获取备用牌堆卡牌面值列表
+     * @return 面值列表
+     */
+    const std::vector<uint8_t>& getStackFaces() const { return _stackFaces; }
+    
+    /**
+     * 获取备用牌堆卡牌花色列表
+     * @return 花色列表
+     */
+    const std::vector<uint8_t>& getStackSuits() const { return _stackSuits; }
+    
+private:
+    std::vector<uint8_t> _playfieldFaces;    // 主牌区卡牌面值
+    std::vector<uint8_t> _playfieldSuits;    // 主牌区卡牌花色
+    std::vector<uint8_t> _stackFaces;        // 备用牌堆卡牌面值
+    std::vector<uint8_t> _stackSuits;        // 备用牌堆卡牌花色
+};
+
+#endif // __COMPACT_DEAL_H__
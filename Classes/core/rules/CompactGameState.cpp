@@ -0,0 +1,167 @@
+/**
+ * CompactGameState.cpp
+ * 紧凑对局状态实现
+ */
+
+#include "CompactGameState.h"
+#include <string.h>
+
+template <typename Rule>
+const int BasicCompactGameState<Rule>::MOVE_DRAW;
+
+template <typename Rule>
+BasicCompactGameState<Rule>::BasicCompactGameState()
+    : _deal(nullptr)
+    , _presentValues(0)
+    , _playfieldRemaining(0)
+    , _stackRemaining(0)
+    , _trayValue(0)
+{
+    memset(_valueCounts, 0, sizeof(_valueCounts));
+}
+
+template <typename Rule>
+bool BasicCompactGameState<Rule>::reset(const CompactDeal* deal)
+{
+    if (!deal || deal->getStackCount() == 0) {
+        return false;
+    }
+    
+    _deal = deal;
+    
+    // assign和clear不会释放已有容量，复用时不产生堆分配
+    int playfieldCount = deal->getPlayfieldCount();
+    _playfieldMask.assign((playfieldCount + 63) / 64, 0);
+    _history.clear();
+    memset(_valueCounts, 0, sizeof(_valueCounts));
+    _presentValues = 0;
+    
+    for (int i = 0; i < playfieldCount; i++) {
+        _playfieldMask[i >> 6] |= (uint64_t)1 << (i & 63);
+        _valueCounts[deal->getPlayfieldValue(i) - 1]++;
+        _presentValues |= 1u << (deal->getPlayfieldValue(i) - 1);
+    }
+    _playfieldRemaining = playfieldCount;
+    
+    // 初始化手牌区顶部卡牌（与GameModel::init一致）
+    _stackRemaining = deal->getStackCount() - 1;
+    _trayValue = deal->getStackValue(_stackRemaining);
+    
+    return true;
+}
+
+template <typename Rule>
+bool BasicCompactGameState<Rule>::resetToPosition(const CompactDeal* deal, const std::vector<uint64_t>& playfieldMask,
+                                                   int stackRemaining, int trayValue)
+{
+    if (!deal || stackRemaining < 0 || stackRemaining >= deal->getStackCount()
+        || trayValue < 0 || trayValue > CardRules::MAX_CARD_VALUE
+        || playfieldMask.size() != static_cast<size_t>((deal->getPlayfieldCount() + 63) / 64)) {
+        return false;
+    }
+    
+    _deal = deal;
+    _playfieldMask = playfieldMask;
+    _history.clear();
+    memset(_valueCounts, 0, sizeof(_valueCounts));
+    _presentValues = 0;
+    
+    _playfieldRemaining = 0;
+    for (int i = 0; i < deal->getPlayfieldCount(); i++) {
+        if (isPlayfieldCardPresent(i)) {
+            _valueCounts[deal->getPlayfieldValue(i) - 1]++;
+            _presentValues |= 1u << (deal->getPlayfieldValue(i) - 1);
+            _playfieldRemaining++;
+        }
+    }
+    _stackRemaining = stackRemaining;
+    _trayValue = trayValue;
+    
+    return true;
+}
+
+template <typename Rule>
+bool BasicCompactGameState<Rule>::canMoveCardFromPlayfieldToTray(int index) const
+{
+    if (!_deal || index < 0 || index >= _deal->getPlayfieldCount() || !isPlayfieldCardPresent(index)) {
+        return false;
+    }
+    
+    return RuleMatchTable<Rule>::canMatch(_deal->getPlayfieldValue(index), _trayValue);
+}
+
+template <typename Rule>
+bool BasicCompactGameState<Rule>::drawCardFromStack()
+{
+    if (_stackRemaining == 0) {
+        return false;
+    }
+    
+    CompactMoveRecord record;
+    record.move = MOVE_DRAW;
+    record.prevTrayValue = static_cast<uint8_t>(_trayValue);
+    _history.push_back(record);
+    
+    _stackRemaining--;
+    _trayValue = _deal->getStackValue(_stackRemaining);
+    
+    return true;
+}
+
+template <typename Rule>
+bool BasicCompactGameState<Rule>::moveCardFromPlayfieldToTray(int index)
+{
+    if (!canMoveCardFromPlayfieldToTray(index)) {
+        return false;
+    }
+    
+    CompactMoveRecord record;
+    record.move = index;
+    record.prevTrayValue = static_cast<uint8_t>(_trayValue);
+    _history.push_back(record);
+    
+    int value = _deal->getPlayfieldValue(index);
+    _playfieldMask[index >> 6] &= ~((uint64_t)1 << (index & 63));
+    if (--_valueCounts[value - 1] == 0) {
+        _presentValues &= ~(1u << (value - 1));
+    }
+    _playfieldRemaining--;
+    _trayValue = value;
+    
+    return true;
+}
+
+template <typename Rule>
+bool BasicCompactGameState<Rule>::undo()
+{
+    if (_history.empty()) {
+        return false;
+    }
+    
+    CompactMoveRecord record = _history.back();
+    _history.pop_back();
+    
+    if (record.move == MOVE_DRAW) {
+        // 把手牌区顶部卡牌放回备用牌堆
+        _stackRemaining++;
+    } else {
+        // 把卡牌放回主牌区
+        int index = record.move;
+        _playfieldMask[index >> 6] |= (uint64_t)1 << (index & 63);
+        int value = _deal->getPlayfieldValue(index);
+        _valueCounts[value - 1]++;
+        _presentValues |= 1u << (value - 1);
+        _playfieldRemaining++;
+    }
+    _trayValue = record.prevTrayValue;
+    
+    return true;
+}
+
+template <typename Rule>
+bool BasicCompactGameState<Rule>::hasPlayableCard() const
+{
+    return getPlayableValueMask() != 0;
+}
+
+CARD_RULES_INSTANTIATE(BasicCompactGameState)
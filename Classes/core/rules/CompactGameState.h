@@ -0,0 +1,206 @@
+/**
+ * CompactGameState.h
+ * 紧凑的对局状态，按GameModel的规则执行抽牌、出牌与回退
+ */
+
+#ifndef __COMPACT_GAME_STATE_H__
+#define __COMPACT_GAME_STATE_H__
+
+#include <stdint.h>
+#include <vector>
+#include "CompactDeal.h"
+#include "CardRules.h"
+
+/**
+ * 紧凑操作记录，用于回退
+ */
+struct CompactMoveRecord
+{
+    int32_t move;             // 操作（主牌区下标或MOVE_DRAW）
+    uint8_t prevTrayValue;    // 操作前手牌区顶部卡牌数值
+    
+    CompactMoveRecord()
+        : move(0)
+        , prevTrayValue(0)
+    {}
+};
+
+/**
+ * 紧凑对局状态类
+ * 与GameModel使用相同的规则：
+ * - 抽牌：备用牌堆最后一张成为手牌区顶部卡牌
+ * - 出牌：主牌区卡牌与手牌区顶部卡牌按规则策略匹配时移动到手牌区（默认数值相差1）
+ * - 主牌区清空即胜利，主牌区与备用牌堆都为空即结束
+ * 只保存位掩码、计数和数值，reset会复用已分配的缓冲区，可被大量对局或线程复用。
+ * 规则策略是模板参数，实现在.cpp中为CARD_RULES_INSTANTIATE列出的变体显式实例化
+ */
+template <typename Rule>
+class BasicCompactGameState
+{
+public:
+    static const int MOVE_DRAW = -1;    // 抽牌操作
+    
+    /**
+     * 创建空状态
+     */
+    BasicCompactGameState();
+    
+    /**
+     * 重置为牌局的初始状态（备用牌堆最后一张翻到手牌区）
+     * @param deal 牌局定义，需在状态使用期间保持有效
+     * @return 是否重置成功
+     */
+    bool reset(const CompactDeal* deal);
+    
+    /**
+     * 重置为牌局中的任意局面，操作记录为空
+     * @param deal 牌局定义，需在状态使用期间保持有效
+     * @param playfieldMask 主牌区位掩码
+     * @param stackRemaining 备用牌堆剩余卡牌数
+     * @param trayValue 手牌区顶部卡牌数值
+     * @return 是否重置成功
+     */
+    bool resetToPosition(const CompactDeal* deal, const std::vector<uint64_t>& playfieldMask, int stackRemaining, int trayValue);
+    
+    /**
+     * 获取牌局定义
+     * @return 牌局定义
+     */
+    const CompactDeal* getDeal() const { return _deal; }
+    
+    /**
+     * 检查是否可以从备用牌堆抽牌
+     * @return 是否可以抽牌
+     */
+    bool canDrawCardFromStack() const { return _stackRemaining > 0; }
+    
+    /**
+     * 检查主牌区卡牌是否可以移动到手牌区
+     * @param index 主牌区卡牌下标
+     * @return 是否可以移动
+     */
+    bool canMoveCardFromPlayfieldToTray(int index) const;
+    
+    /**
+     * 从备用牌堆抽一张牌到手牌区
+     * @return 是否成功抽牌
+     */
+    bool drawCardFromStack();
+    
+    /**
+     * 把主牌区的牌移动到手牌区
+     * @param index 主牌区卡牌下标
+     * @return 是否成功移动
+     */
+    bool moveCardFromPlayfieldToTray(int index);
+    
+    /**
+     * 执行一个操作
+     * @param move 主牌区下标或MOVE_DRAW
+     * @return 是否成功执行
+     */
+    bool applyMove(int move) { return move == MOVE_DRAW ? drawCardFromStack() : moveCardFromPlayfieldToTray(move); }
+    
+    /**
+     * 撤销最后一次操作
+     * @return 是否成功撤销
+     */
+    bool undo();
+    
+    /**
+     * 检查是否可以撤销
+     * @return 是否可以撤销
+     */
+    bool canUndo() const { return !_history.empty(); }
+    
+    /**
+     * 检查游戏是否结束（主牌区和备用牌堆都为空）
+     * @return 游戏是否结束
+     */
+    bool isGameOver() const { return _playfieldRemaining == 0 && _stackRemaining == 0; }
+    
+    /**
+     * 检查是否赢得游戏（主牌区为空）
+     * @return 是否赢得游戏
+     */
+    bool isGameWon() const { return _playfieldRemaining == 0; }
+    
+    /**
+     * 检查当前是否存在可以出的主牌区卡牌
+     * @return 是否存在可出的牌
+     */
+    bool hasPlayableCard() const;
+    
+    /**
+     * 检查主牌区卡牌是否还在
+     * @param index 主牌区卡牌下标
+     * @return 是否还在主牌区
+     */
+    bool isPlayfieldCardPresent(int index) const { return (_playfieldMask[index >> 6] >> (index & 63)) & 1; }
+    
+    /**
+     * 获取手牌区顶部卡牌数值，为0表示手牌区为空
+     * @return 卡牌数值
+     */
+    int getTrayValue() const { return _trayValue; }
+    
+    /**
+     * 获取备用牌堆剩余卡牌数
+     * @return 剩余卡牌数
+     */
+    int getStackRemaining() const { return _stackRemaining; }
+    
+    /**
+     * 获取主牌区剩余卡牌数
+     * @return 剩余卡牌数
+     */
+    int getPlayfieldRemaining() const { return _playfieldRemaining; }
+    
+    /**
+     * 获取主牌区中某个数值的剩余卡牌数
+     * @param value 卡牌数值（1-13）
+     * @return 剩余卡牌数
+     */
+    int getValueCount(int value) const { return _valueCounts[value - 1]; }
+    
+    /**
+     * 获取主牌区仍有卡牌的数值掩码
+     * @return 数值掩码，第v-1位对应数值v
+     */
+    uint16_t getPresentValueMask() const { return _presentValues; }
+    
+    /**
+     * 获取当前能打出的数值掩码
+     * @return 数值掩码，第v-1位对应数值v
+     */
+    uint16_t getPlayableValueMask() const { return _presentValues & RuleMatchTable<Rule>::getMatchMask(_trayValue); }
+    
+    /**
+     * 获取主牌区位掩码，每个64位字保存64张卡牌是否还在
+     * @return 位掩码
+     */
+    const std::vector<uint64_t>& getPlayfieldMask() const { return _playfieldMask; }
+    
+    /**
+     * 获取操作记录
+     * @return 操作记录列表
+     */
+    const std::vector<CompactMoveRecord>& getHistory() const { return _history; }
+    
+private:
+    const CompactDeal* _deal;                       // 牌局定义
+    std::vector<uint64_t> _playfieldMask;           // 主牌区位掩码
+    std::vector<CompactMoveRecord> _history;        // 操作记录
+    uint16_t _valueCounts[CardRules::NUM_CARD_VALUES];  // 主牌区各数值剩余数量
+    uint16_t _presentValues;                        // 主牌区仍有卡牌的数值掩码
+    int _playfieldRemaining;                        // 主牌区剩余卡牌数
+    int _stackRemaining;                            // 备用牌堆剩余卡牌数
+    int _trayValue;                                 // 手牌区顶部卡牌数值
+};
+
+/**
+ * 游戏规则下的紧凑对局状态
+ */
+typedef BasicCompactGameState<DefaultRule> CompactGameState;
+
+#endif // __COMPACT_GAME_STATE_H__
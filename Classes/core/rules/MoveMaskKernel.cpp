@@ -0,0 +1,200 @@
+/**
+ * MoveMaskKernel.cpp
+ * 可打出卡牌掩码内核的标量实现与运行时指令集选择
+ */
+
+#include "MoveMaskKernel.h"
+#include "MoveMaskKernelLoop.h"
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/**
+ * 标量实现：只对在场的卡牌逐张查同一张查找表，作为没有SIMD时的回退与校验基准
+ */
+struct ScalarOps
+{
+    static inline uint64_t matchWord(const uint8_t* values, const uint8_t* table, uint64_t presence)
+    {
+        uint64_t bits = 0;
+        while (presence) {
+            int index = lowestBit(presence);
+            presence &= presence - 1;
+            bits |= static_cast<uint64_t>(table[values[index] & 0x0F] & 1) << index;
+        }
+        return bits;
+    }
+    
+    static inline int countBits(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(value);
+#else
+        int count = 0;
+        while (value) {
+            value &= value - 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+    
+    static inline int selectBit(uint64_t value, int rank)
+    {
+        for (int i = 0; i < rank; i++) {
+            value &= value - 1;
+        }
+        return lowestBit(value);
+    }
+    
+    static inline int lowestBit(uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(value);
+#else
+        int index = 0;
+        while (!((value >> index) & 1)) {
+            index++;
+        }
+        return index;
+#endif
+    }
+};
+
+static bool computeMoveMaskScalar(const uint8_t* values, const uint64_t* presence, int wordCount,
+                                  const uint8_t* table, uint64_t* moves)
+{
+    return computeMoveMaskLoop<ScalarOps>(values, presence, wordCount, table, moves);
+}
+
+static int runLockstepScalar(PlayoutLanes& lanes)
+{
+    return runLockstepLoop<ScalarOps>(lanes);
+}
+
+/**
+ * 检查CPU是否支持指定级别的指令集
+ */
+static bool isCpuSupported(int level)
+{
+    if (level == SL_SCALAR) {
+        return true;
+    }
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    if (level == SL_SSE4) {
+        return __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt");
+    }
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("popcnt");
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool sse42 = (info[2] & (1 << 20)) != 0 && (info[2] & (1 << 23)) != 0;
+    if (level == SL_SSE4) {
+        return sse42;
+    }
+    // AVX2还要求操作系统保存YMM寄存器（OSXSAVE且XCR0的第1、2位）
+    bool osxsave = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0;
+    if (!sse42 || !osxsave || maxLeaf < 7 || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0 && (info[1] & (1 << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * 获取指定级别的掩码实现，未编译时返回nullptr
+ */
+static MoveMaskFunction getMoveMaskFunction(int level)
+{
+    switch (level) {
+        case SL_AVX2:
+            return MOVE_MASK_AVX2;
+        case SL_SSE4:
+            return MOVE_MASK_SSE4;
+        default:
+            return computeMoveMaskScalar;
+    }
+}
+
+/**
+ * 获取指定级别的批量推进实现，未编译时返回nullptr
+ */
+static PlayoutLockstepFunction getLockstepFunction(int level)
+{
+    switch (level) {
+        case SL_AVX2:
+            return PLAYOUT_LOCKSTEP_AVX2;
+        case SL_SSE4:
+            return PLAYOUT_LOCKSTEP_SSE4;
+        default:
+            return runLockstepScalar;
+    }
+}
+
+/**
+ * 当前选用的级别，首次使用时取本机可用的最高级别
+ */
+static std::atomic<int>& currentLevel()
+{
+    static std::atomic<int> level(MoveMaskKernel::getSupportedLevel());
+    return level;
+}
+
+void MoveMaskKernel::buildLookupTable(uint16_t matchMask, uint8_t* table)
+{
+    for (int v = 0; v < LOOKUP_TABLE_SIZE; v++) {
+        table[v] = (v >= 1 && ((matchMask >> (v - 1)) & 1)) ? 0xFF : 0x00;
+    }
+}
+
+bool MoveMaskKernel::computeMoveMask(const uint8_t* values, const uint64_t* presence, int wordCount,
+                                     const uint8_t* table, uint64_t* moves)
+{
+    return getMoveMaskFunction(currentLevel().load(std::memory_order_relaxed))(values, presence, wordCount, table, moves);
+}
+
+int MoveMaskKernel::runLockstep(PlayoutLanes& lanes)
+{
+    return getLockstepFunction(currentLevel().load(std::memory_order_relaxed))(lanes);
+}
+
+int MoveMaskKernel::setLevel(int level)
+{
+    if (level < SL_SCALAR) {
+        level = SL_SCALAR;
+    }
+    int supported = getSupportedLevel();
+    if (level > supported) {
+        level = supported;
+    }
+    currentLevel().store(level, std::memory_order_relaxed);
+    return level;
+}
+
+int MoveMaskKernel::getLevel()
+{
+    return currentLevel().load(std::memory_order_relaxed);
+}
+
+int MoveMaskKernel::getSupportedLevel()
+{
+    for (int level = SL_COUNT - 1; level > SL_SCALAR; level--) {
+        if (getMoveMaskFunction(level) && getLockstepFunction(level) && isCpuSupported(level)) {
+            return level;
+        }
+    }
+    return SL_SCALAR;
+}
+
+const char* MoveMaskKernel::getLevelName(int level)
+{
+    static const char* NAMES[SL_COUNT] = { "scalar", "sse4", "avx2" };
+    return level >= 0 && level < SL_COUNT ? NAMES[level] : "unknown";
+}
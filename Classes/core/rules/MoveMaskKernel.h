@@ -0,0 +1,123 @@
+/**
+ * MoveMaskKernel.h
+ * 向量化的可打出卡牌掩码计算与批量对局推进（AVX2 / SSE4 / 标量）
+ */
+
+#ifndef __MOVE_MASK_KERNEL_H__
+#define __MOVE_MASK_KERNEL_H__
+
+#include <stdint.h>
+
+/**
+ * 指令集级别
+ */
+enum SimdLevel
+{
+    SL_SCALAR = 0,      // 逐张查表
+    SL_SSE4,            // 每次16张（pshufb），要求SSE4.2与popcnt
+    SL_AVX2,            // 每次32张（vpshufb），要求AVX2与BMI2
+    SL_COUNT
+};
+
+/**
+ * 一批同时推进的对局（按分量存放，每项为各局一份）
+ * 由PlayoutBatch准备，内核只读写其中的对局状态
+ */
+struct PlayoutLanes
+{
+    const uint8_t* values;                  // 主牌区数值，长度wordCount * 64，补齐部分为0
+    const uint8_t* stackValues;             // 备用牌堆数值
+    const uint8_t* lookupTables;            // 按手牌区数值索引的查找表，每张16字节
+    int wordCount;                          // 每局在场位掩码字数
+    int gameCount;                          // 对局数（不超过32）
+    uint64_t* presence;                     // 各局在场位，按局连续存放
+    uint64_t* moves;                        // 合法走子位图缓冲，wordCount个字
+    uint64_t* rng;                          // 各局随机数状态
+    int* playfieldRemaining;                // 各局主牌区剩余数
+    int* stackRemaining;                    // 各局备用牌堆剩余数
+    uint8_t* trayValue;                     // 各局手牌区顶部数值
+    uint64_t steps;                         // 累计步数（输出）
+};
+
+/**
+ * 计算合法走子位图的内核函数，参数含义同MoveMaskKernel::computeMoveMask
+ */
+typedef bool (*MoveMaskFunction)(const uint8_t* values, const uint64_t* presence, int wordCount,
+                                 const uint8_t* table, uint64_t* moves);
+
+/**
+ * 按步同时推进一批对局直到全部结束的内核函数，返回通关局数
+ */
+typedef int (*PlayoutLockstepFunction)(PlayoutLanes& lanes);
+
+/**
+ * 可打出卡牌掩码内核
+ * 主牌区数值按uint8_t连续存放（1-13，填充位置为0），配合按64张分组的在场位掩码；
+ * 当前能打出的数值掩码预先展开成16字节的查找表，用字节洗牌指令一次比对16/32张卡牌，
+ * 再与在场位相与得到合法走子位图。SIMD实现放在单独编译的源文件中，运行时按CPU支持选择；
+ * 批量推进的整个循环也随各指令集编译，计数与选位使用popcnt/pdep
+ */
+class MoveMaskKernel
+{
+public:
+    static const int VALUE_ALIGNMENT = 64;      // 数值数组长度需补齐到的倍数（即每个在场位字对应的卡牌数）
+    static const int LOOKUP_TABLE_SIZE = 16;    // 查找表字节数
+    static const int MAX_LANES = 32;            // 一批最多对局数
+    
+    /**
+     * 把能打出的数值掩码展开成查找表：数值v能打出时第v字节为0xFF，其余为0
+     * @param matchMask 能打出的数值掩码（第v-1位对应数值v）
+     * @param table 输出查找表，LOOKUP_TABLE_SIZE字节，需16字节对齐
+     */
+    static void buildLookupTable(uint16_t matchMask, uint8_t* table);
+    
+    /**
+     * 计算合法走子位图
+     * @param values 主牌区数值，长度为wordCount * VALUE_ALIGNMENT，填充位置必须为0
+     * @param presence 在场位掩码，wordCount个字
+     * @param wordCount 位掩码字数
+     * @param table buildLookupTable生成的查找表
+     * @param moves 输出合法走子位图，wordCount个字
+     * @return 存在合法走子时返回true
+     */
+    static bool computeMoveMask(const uint8_t* values, const uint64_t* presence, int wordCount,
+                                const uint8_t* table, uint64_t* moves);
+    
+    /**
+     * 按步同时推进一批对局：每轮对每个未结束的对局走一步，有可打出的卡牌时随机打出一张，
+     * 否则抽牌，都不行时该局结束
+     * @param lanes 对局状态
+     * @return 通关局数
+     */
+    static int runLockstep(PlayoutLanes& lanes);
+    
+    /**
+     * 指定使用的指令集级别，超过编译与CPU支持范围时降到可用的最高级别
+     * @param level 期望的级别
+     * @return 实际使用的级别
+     */
+    static int setLevel(int level);
+    
+    /**
+     * 获取当前使用的指令集级别
+     */
+    static int getLevel();
+    
+    /**
+     * 获取本机可用的最高指令集级别（同时检查编译支持与CPU支持）
+     */
+    static int getSupportedLevel();
+    
+    /**
+     * 获取指令集级别名称
+     */
+    static const char* getLevelName(int level);
+};
+
+// 各指令集的实现，未编译对应指令集时为nullptr
+extern const MoveMaskFunction MOVE_MASK_SSE4;
+extern const MoveMaskFunction MOVE_MASK_AVX2;
+extern const PlayoutLockstepFunction PLAYOUT_LOCKSTEP_SSE4;
+extern const PlayoutLockstepFunction PLAYOUT_LOCKSTEP_AVX2;
+
+#endif // __MOVE_MASK_KERNEL_H__
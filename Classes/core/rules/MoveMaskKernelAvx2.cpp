@@ -0,0 +1,65 @@
+/**
+ * MoveMaskKernelAvx2.cpp
+ * 可打出卡牌掩码的AVX2实现，需以-mavx2 -mbmi2 -mpopcnt（MSVC下/arch:AVX2）单独编译
+ */
+
+#include "MoveMaskKernel.h"
+
+#if defined(CARDCORE_HAS_AVX2_KERNEL)
+
+#include "MoveMaskKernelLoop.h"
+#include <immintrin.h>
+
+/**
+ * 查找表复制到两个128位通道，每次vpshufb处理32张卡牌；选位用pdep一步完成
+ */
+struct Avx2Ops
+{
+    static inline uint64_t matchWord(const uint8_t* values, const uint8_t* table, uint64_t presence)
+    {
+        const __m256i lut = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + 32));
+        uint64_t bits = static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_shuffle_epi8(lut, low))))
+            | static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_shuffle_epi8(lut, high)))) << 32;
+        return bits & presence;
+    }
+    
+    static inline int countBits(uint64_t value)
+    {
+        return static_cast<int>(_mm_popcnt_u64(value));
+    }
+    
+    static inline int selectBit(uint64_t value, int rank)
+    {
+        uint64_t bit = _pdep_u64((uint64_t)1 << rank, value);
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, bit);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(bit);
+#endif
+    }
+};
+
+static bool computeMoveMaskAvx2(const uint8_t* values, const uint64_t* presence, int wordCount,
+                                const uint8_t* table, uint64_t* moves)
+{
+    return computeMoveMaskLoop<Avx2Ops>(values, presence, wordCount, table, moves);
+}
+
+static int runLockstepAvx2(PlayoutLanes& lanes)
+{
+    return runLockstepLoop<Avx2Ops>(lanes);
+}
+
+const MoveMaskFunction MOVE_MASK_AVX2 = computeMoveMaskAvx2;
+const PlayoutLockstepFunction PLAYOUT_LOCKSTEP_AVX2 = runLockstepAvx2;
+
+#else
+
+const MoveMaskFunction MOVE_MASK_AVX2 = nullptr;
+const PlayoutLockstepFunction PLAYOUT_LOCKSTEP_AVX2 = nullptr;
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * MoveMaskKernelLoop.h
+ * 掩码内核的公共循环，由各指令集的源文件按各自的字操作实例化
+ */
+
+#ifndef __MOVE_MASK_KERNEL_LOOP_H__
+#define __MOVE_MASK_KERNEL_LOOP_H__
+
+#include "MoveMaskKernel.h"
+
+/**
+ * splitmix64，状态只有一个字，适合每局各持一份
+ */
+static inline uint64_t nextPlayoutRandom(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * 计算合法走子位图
+ * Ops需提供：
+ *   static uint64_t matchWord(const uint8_t* values, const uint8_t* table, uint64_t presence)
+ *       64张卡牌中在场且能打出的位
+ */
+template <typename Ops>
+static inline bool computeMoveMaskLoop(const uint8_t* values, const uint64_t* presence, int wordCount,
+                                       const uint8_t* table, uint64_t* moves)
+{
+    uint64_t any = 0;
+    for (int w = 0; w < wordCount; w++) {
+        moves[w] = Ops::matchWord(values + w * MoveMaskKernel::VALUE_ALIGNMENT, table, presence[w]);
+        any |= moves[w];
+    }
+    return any != 0;
+}
+
+/**
+ * 按步推进一批对局
+ * Ops除matchWord外还需提供：
+ *   static int countBits(uint64_t value)                  置位数
+ *   static int selectBit(uint64_t value, int rank)        第rank个置位的位置
+ */
+template <typename Ops>
+static int runLockstepLoop(PlayoutLanes& lanes)
+{
+    const int wordCount = lanes.wordCount;
+    const uint8_t* values = lanes.values;
+    uint64_t* moves = lanes.moves;
+    uint64_t steps = 0;
+    int wins = 0;
+    
+    uint32_t alive = 0;
+    for (int g = 0; g < lanes.gameCount; g++) {
+        if (lanes.playfieldRemaining[g] > 0) {
+            alive |= 1u << g;
+        } else {
+            wins++;
+        }
+    }
+    
+    while (alive) {
+        // 每轮按局序号各走一步，各局的依赖链互不相关，乱序执行可以重叠
+        uint32_t pending = alive;
+        while (pending) {
+            int g = Ops::selectBit(pending, 0);
+            pending &= pending - 1;
+            steps++;
+            
+            uint64_t* presence = lanes.presence + g * wordCount;
+            const uint8_t* table = lanes.lookupTables + lanes.trayValue[g] * MoveMaskKernel::LOOKUP_TABLE_SIZE;
+            int count = 0;
+            for (int w = 0; w < wordCount; w++) {
+                moves[w] = Ops::matchWord(values + w * MoveMaskKernel::VALUE_ALIGNMENT, table, presence[w]);
+                count += Ops::countBits(moves[w]);
+            }
+            
+            if (count > 0) {
+                // 在合法走子中均匀选择第pick个
+                int pick = static_cast<int>(((nextPlayoutRandom(lanes.rng[g]) >> 32) * static_cast<uint64_t>(count)) >> 32);
+                int w = 0;
+                int wordBits = Ops::countBits(moves[0]);
+                while (pick >= wordBits) {
+                    pick -= wordBits;
+                    wordBits = Ops::countBits(moves[++w]);
+                }
+                int bit = Ops::selectBit(moves[w], pick);
+                presence[w] &= ~((uint64_t)1 << bit);
+                lanes.trayValue[g] = values[(w << 6) + bit];
+                if (--lanes.playfieldRemaining[g] == 0) {
+                    wins++;
+                    alive &= ~(1u << g);
+                }
+            } else if (lanes.stackRemaining[g] > 0) {
+                lanes.trayValue[g] = lanes.stackValues[--lanes.stackRemaining[g]];
+            } else {
+                alive &= ~(1u << g);
+            }
+        }
+    }
+    
+    lanes.steps += steps;
+    return wins;
+}
+
+#endif // __MOVE_MASK_KERNEL_LOOP_H__
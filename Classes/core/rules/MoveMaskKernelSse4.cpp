@@ -0,0 +1,71 @@
+/**
+ * MoveMaskKernelSse4.cpp
+ * 可打出卡牌掩码的SSE4实现，需以-msse4.2 -mpopcnt（MSVC下x64默认支持）单独编译
+ */
+
+#include "MoveMaskKernel.h"
+
+#if defined(CARDCORE_HAS_SSE4_KERNEL)
+
+#include "MoveMaskKernelLoop.h"
+#include <nmmintrin.h>
+
+/**
+ * 每次用pshufb把16张卡牌的数值映射成0x00/0xFF，再用movemask收集成位
+ */
+struct Sse4Ops
+{
+    static inline uint64_t matchWord(const uint8_t* values, const uint8_t* table, uint64_t presence)
+    {
+        const __m128i lut = _mm_load_si128(reinterpret_cast<const __m128i*>(table));
+        __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+        __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + 16));
+        __m128i v2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + 32));
+        __m128i v3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + 48));
+        uint64_t bits = static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_shuffle_epi8(lut, v0))))
+            | static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_shuffle_epi8(lut, v1)))) << 16
+            | static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_shuffle_epi8(lut, v2)))) << 32
+            | static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_shuffle_epi8(lut, v3)))) << 48;
+        return bits & presence;
+    }
+    
+    static inline int countBits(uint64_t value)
+    {
+        return static_cast<int>(_mm_popcnt_u64(value));
+    }
+    
+    static inline int selectBit(uint64_t value, int rank)
+    {
+        for (int i = 0; i < rank; i++) {
+            value &= value - 1;
+        }
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<int>(index);
+#else
+        return __builtin_ctzll(value);
+#endif
+    }
+};
+
+static bool computeMoveMaskSse4(const uint8_t* values, const uint64_t* presence, int wordCount,
+                                const uint8_t* table, uint64_t* moves)
+{
+    return computeMoveMaskLoop<Sse4Ops>(values, presence, wordCount, table, moves);
+}
+
+static int runLockstepSse4(PlayoutLanes& lanes)
+{
+    return runLockstepLoop<Sse4Ops>(lanes);
+}
+
+const MoveMaskFunction MOVE_MASK_SSE4 = computeMoveMaskSse4;
+const PlayoutLockstepFunction PLAYOUT_LOCKSTEP_SSE4 = runLockstepSse4;
+
+#else
+
+const MoveMaskFunction MOVE_MASK_SSE4 = nullptr;
+const PlayoutLockstepFunction PLAYOUT_LOCKSTEP_SSE4 = nullptr;
+
+#endif
@@ -0,0 +1,107 @@
+/**
+ * PlayoutBatch.cpp
+ * 批量随机对局实现
+ */
+
+#include "PlayoutBatch.h"
+
+PlayoutBatch::PlayoutBatch()
+: _matchMasks(nullptr)
+, _wordCount(0)
+, _playfieldCount(0)
+, _stackCount(0)
+, _stepCount(0)
+{
+}
+
+bool PlayoutBatch::init(const CompactDeal* deal, const uint16_t* matchMasks)
+{
+    if (!deal || !matchMasks || deal->getStackCount() == 0) {
+        return false;
+    }
+    
+    _matchMasks = matchMasks;
+    for (int t = 0; t <= CardRules::MAX_CARD_VALUE; t++) {
+        MoveMaskKernel::buildLookupTable(matchMasks[t], _lookupTables + t * MoveMaskKernel::LOOKUP_TABLE_SIZE);
+    }
+    
+    _playfieldCount = deal->getPlayfieldCount();
+    _stackCount = deal->getStackCount();
+    _wordCount = (_playfieldCount + MoveMaskKernel::VALUE_ALIGNMENT - 1) / MoveMaskKernel::VALUE_ALIGNMENT;
+    if (_wordCount == 0) {
+        _wordCount = 1;
+    }
+    
+    _values.assign(_wordCount * MoveMaskKernel::VALUE_ALIGNMENT, 0);
+    _initialPresence.assign(_wordCount, 0);
+    for (int i = 0; i < _playfieldCount; i++) {
+        _values[i] = static_cast<uint8_t>(deal->getPlayfieldValue(i));
+        _initialPresence[i >> 6] |= (uint64_t)1 << (i & 63);
+    }
+    
+    _stackValues.resize(_stackCount);
+    for (int i = 0; i < _stackCount; i++) {
+        _stackValues[i] = static_cast<uint8_t>(deal->getStackValue(i));
+    }
+    
+    _presence.assign(MAX_BATCH_GAMES * _wordCount, 0);
+    _moves.assign(_wordCount, 0);
+    _stepCount = 0;
+    return true;
+}
+
+int PlayoutBatch::runBatch(uint64_t firstPlayout, int gameCount, uint64_t seed)
+{
+    if (!_matchMasks || gameCount <= 0) {
+        return 0;
+    }
+    if (gameCount > MAX_BATCH_GAMES) {
+        gameCount = MAX_BATCH_GAMES;
+    }
+    
+    // 开局：与CompactGameState::reset一致，备用牌堆最后一张翻到手牌区；
+    // 每局的随机数状态只由种子与对局序号决定
+    for (int g = 0; g < gameCount; g++) {
+        for (int w = 0; w < _wordCount; w++) {
+            _presence[g * _wordCount + w] = _initialPresence[w];
+        }
+        _playfieldRemaining[g] = _playfieldCount;
+        _stackRemaining[g] = _stackCount - 1;
+        _trayValue[g] = _stackValues[_stackCount - 1];
+        _rng[g] = seed ^ ((firstPlayout + g) * 0xD1B54A32D192ED03ull);
+    }
+    
+    PlayoutLanes lanes;
+    lanes.values = _values.data();
+    lanes.stackValues = _stackValues.data();
+    lanes.lookupTables = _lookupTables;
+    lanes.wordCount = _wordCount;
+    lanes.gameCount = gameCount;
+    lanes.presence = _presence.data();
+    lanes.moves = _moves.data();
+    lanes.rng = _rng;
+    lanes.playfieldRemaining = _playfieldRemaining;
+    lanes.stackRemaining = _stackRemaining;
+    lanes.trayValue = _trayValue;
+    lanes.steps = 0;
+    
+    int wins = MoveMaskKernel::runLockstep(lanes);
+    _stepCount += lanes.steps;
+    return wins;
+}
+
+int PlayoutBatch::runPlayouts(int playouts, int batchSize, uint64_t seed)
+{
+    if (batchSize < MIN_BATCH_GAMES) {
+        batchSize = MIN_BATCH_GAMES;
+    } else if (batchSize > MAX_BATCH_GAMES) {
+        batchSize = MAX_BATCH_GAMES;
+    }
+    
+    int wins = 0;
+    for (int first = 0; first < playouts; first += batchSize) {
+        int count = playouts - first < batchSize ? playouts - first : batchSize;
+        wins += runBatch(static_cast<uint64_t>(first), count, seed);
+    }
+    return wins;
+}
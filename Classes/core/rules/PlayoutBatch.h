@@ -0,0 +1,98 @@
+/**
+ * PlayoutBatch.h
+ * 同一牌局的多局随机对局按步同时推进，走子生成使用向量化掩码内核
+ */
+
+#ifndef __PLAYOUT_BATCH_H__
+#define __PLAYOUT_BATCH_H__
+
+#include <stdint.h>
+#include <vector>
+#include "CardRules.h"
+#include "CompactDeal.h"
+#include "MoveMaskKernel.h"
+
+/**
+ * 批量随机对局
+ * 主牌区数值只存一份（uint8_t，补齐到64的倍数），每局只保存在场位掩码、手牌区数值、
+ * 备用牌堆剩余数与随机数状态；每一步对所有未结束的对局各走一步，各局的依赖链相互独立，
+ * 可以交错执行。每局的随机序列只由种子与对局序号决定，结果与批大小、指令集级别无关
+ */
+class PlayoutBatch
+{
+public:
+    static const int MIN_BATCH_GAMES = 8;       // 批大小下限
+    static const int MAX_BATCH_GAMES = MoveMaskKernel::MAX_LANES;   // 批大小上限
+    
+    PlayoutBatch();
+    
+    /**
+     * 绑定牌局与匹配表
+     * @param deal 牌局定义，需在使用期间保持有效
+     * @param matchMasks 按手牌区数值索引的可打出数值掩码（14项，通常为RuleMatchTable<Rule>::MATCH_MASKS）
+     * @return 备用牌堆为空或参数无效时返回false
+     */
+    bool init(const CompactDeal* deal, const uint16_t* matchMasks);
+    
+    /**
+     * 运行一组对局直到全部结束
+     * @param firstPlayout 第一局的对局序号
+     * @param gameCount 对局数（1-MAX_BATCH_GAMES）
+     * @param seed 随机种子
+     * @return 通关局数
+     */
+    int runBatch(uint64_t firstPlayout, int gameCount, uint64_t seed);
+    
+    /**
+     * 按批运行指定局数
+     * @param playouts 总局数
+     * @param batchSize 批大小，限制在MIN_BATCH_GAMES-MAX_BATCH_GAMES之间
+     * @param seed 随机种子
+     * @return 通关局数
+     */
+    int runPlayouts(int playouts, int batchSize, uint64_t seed);
+    
+    /**
+     * 获取累计执行的步数（打出与抽牌）
+     */
+    uint64_t getStepCount() const { return _stepCount; }
+    
+    /**
+     * 按规则策略估计胜率
+     * @param deal 牌局定义
+     * @param playouts 模拟局数
+     * @param seed 随机种子
+     * @param batchSize 批大小
+     * @return 通关局数占比（0-1）
+     */
+    template <typename Rule>
+    static float estimateWinRate(const CompactDeal& deal, int playouts, uint64_t seed, int batchSize = MAX_BATCH_GAMES)
+    {
+        PlayoutBatch batch;
+        if (playouts <= 0 || !batch.init(&deal, RuleMatchTable<Rule>::MATCH_MASKS)) {
+            return 0.0f;
+        }
+        return static_cast<float>(batch.runPlayouts(playouts, batchSize, seed)) / playouts;
+    }
+    
+private:
+    const uint16_t* _matchMasks;                // 匹配表
+    alignas(16) uint8_t _lookupTables[(CardRules::MAX_CARD_VALUE + 1) * MoveMaskKernel::LOOKUP_TABLE_SIZE];  // 按手牌区数值索引的查找表
+    int _wordCount;                             // 每局在场位掩码字数
+    int _playfieldCount;                        // 主牌区卡牌数
+    int _stackCount;                            // 备用牌堆卡牌数
+    std::vector<uint8_t> _values;               // 主牌区数值，补齐部分为0
+    std::vector<uint8_t> _stackValues;          // 备用牌堆数值
+    std::vector<uint64_t> _initialPresence;     // 开局在场位
+    std::vector<uint64_t> _presence;            // 各局在场位，按局连续存放
+    std::vector<uint64_t> _moves;               // 合法走子位图缓冲
+    
+    uint64_t _rng[MAX_BATCH_GAMES];             // 各局随机数状态
+    int _playfieldRemaining[MAX_BATCH_GAMES];   // 各局主牌区剩余数
+    int _stackRemaining[MAX_BATCH_GAMES];       // 各局备用牌堆剩余数
+    uint8_t _trayValue[MAX_BATCH_GAMES];        // 各局手牌区顶部数值
+    
+    uint64_t _stepCount;                        // 累计步数
+};
+
+#endif // __PLAYOUT_BATCH_H__
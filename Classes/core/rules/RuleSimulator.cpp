@@ -0,0 +1,59 @@
+/**
+ * RuleSimulator.cpp
+ * 规则模拟器实现
+ */
+
+#include "RuleSimulator.h"
+#include <random>
+
+template <typename Rule>
+int RuleSimulator<Rule>::generatePlays(const State& state, std::vector<int32_t>& plays)
+{
+    plays.clear();
+    
+    uint32_t playable = state.getPlayableValueMask();
+    if (playable == 0) {
+        return 0;
+    }
+    
+    const std::vector<uint8_t>& faces = state.getDeal()->getPlayfieldFaces();
+    for (size_t i = 0; i < faces.size(); i++) {
+        if (((playable >> faces[i]) & 1) && state.isPlayfieldCardPresent(static_cast<int>(i))) {
+            plays.push_back(static_cast<int32_t>(i));
+        }
+    }
+    
+    return static_cast<int>(plays.size());
+}
+
+template <typename Rule>
+float RuleSimulator<Rule>::estimateWinRate(const CompactDeal& deal, int playouts, uint64_t seed)
+{
+    if (playouts <= 0) {
+        return 0.0f;
+    }
+    
+    std::mt19937_64 rng(seed);
+    State state;
+    std::vector<int32_t> plays;
+    int wins = 0;
+    
+    for (int p = 0; p < playouts; p++) {
+        state.reset(&deal);
+        while (!state.isGameWon()) {
+            if (generatePlays(state, plays) > 0) {
+                state.moveCardFromPlayfieldToTray(plays[rng() % plays.size()]);
+            } else if (!state.drawCardFromStack()) {
+                break;
+            }
+        }
+        
+        if (state.isGameWon()) {
+            wins++;
+        }
+    }
+    
+    return static_cast<float>(wins) / playouts;
+}
+
+CARD_RULES_INSTANTIATE(RuleSimulator)
@@ -0,0 +1,42 @@
+/**
+ * RuleSimulator.h
+ * 按规则策略实例化的走子生成与随机对局模拟
+ */
+
+#ifndef __RULE_SIMULATOR_H__
+#define __RULE_SIMULATOR_H__
+
+#include <stdint.h>
+#include <vector>
+#include "CompactGameState.h"
+
+/**
+ * 规则模拟器
+ * 每个规则策略单独实例化，匹配检查是对编译期匹配表的一次查表：先取出当前能打出的数值掩码，
+ * 再按卡牌数值逐张过滤，循环中没有运行期的规则分支
+ */
+template <typename Rule>
+class RuleSimulator
+{
+public:
+    typedef BasicCompactGameState<Rule> State;
+    
+    /**
+     * 生成当前局面所有可以打出的主牌区卡牌（不含抽牌）
+     * @param state 对局状态
+     * @param plays 输出主牌区下标，按下标升序
+     * @return 可打出的卡牌数
+     */
+    static int generatePlays(const State& state, std::vector<int32_t>& plays);
+    
+    /**
+     * 随机对局估计胜率：每步在可打出的卡牌中随机选择，没有可打出的卡牌时抽牌
+     * @param deal 牌局定义
+     * @param playouts 模拟局数
+     * @param seed 随机种子
+     * @return 通关局数占比（0-1）
+     */
+    static float estimateWinRate(const CompactDeal& deal, int playouts, uint64_t seed);
+};
+
+#endif // __RULE_SIMULATOR_H__
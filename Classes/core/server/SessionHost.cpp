@@ -0,0 +1,111 @@
+/**
+ * SessionHost.cpp
+ * 无界面会话服务实现
+ */
+
+#include "SessionHost.h"
+#include "core/CoreMacros.h"
+
+SessionHost::SessionHost()
+{
+}
+
+SessionHost::~SessionHost()
+{
+    stop();
+}
+
+bool SessionHost::registerDeal(uint32_t levelId, const CompactDeal& deal)
+{
+    // 分片运行时只读牌局表，启动后不允许修改
+    if (!_shards.empty() || deal.getStackCount() == 0) {
+        return false;
+    }
+    
+    _deals[levelId] = deal;
+    return true;
+}
+
+bool SessionHost::start(int shardCount)
+{
+    if (!_shards.empty()) {
+        return false;
+    }
+    
+    if (shardCount <= 0) {
+        shardCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (shardCount <= 0) {
+            shardCount = 1;
+        }
+    }
+    
+    for (int i = 0; i < shardCount; i++) {
+        SessionShard* shard = new SessionShard(&_deals);
+        shard->start();
+        _shards.push_back(shard);
+    }
+    
+    return true;
+}
+
+void SessionHost::stop()
+{
+    for (auto shard : _shards) {
+        shard->stop();
+        CORE_SAFE_DELETE(shard);
+    }
+    _shards.clear();
+}
+
+void SessionHost::processBatch(const SessionRequest* requests, size_t count, SessionResponse* responses)
+{
+    if (count == 0 || _shards.empty()) {
+        return;
+    }
+    
+    // 按分片拆分请求下标，保持每个会话内的原始顺序
+    std::vector<std::vector<uint32_t>> indicesByShard(_shards.size());
+    for (size_t i = 0; i < count; i++) {
+        indicesByShard[getShardIndex(requests[i].sessionId)].push_back(static_cast<uint32_t>(i));
+    }
+    
+    int activeShards = 0;
+    for (const auto& indices : indicesByShard) {
+        if (!indices.empty()) {
+            activeShards++;
+        }
+    }
+    
+    SessionBatchLatch latch(activeShards);
+    for (size_t s = 0; s < _shards.size(); s++) {
+        if (indicesByShard[s].empty()) {
+            continue;
+        }
+        
+        SessionShardJob job;
+        job.requests = requests;
+        job.responses = responses;
+        job.indices = indicesByShard[s].data();
+        job.count = indicesByShard[s].size();
+        job.latch = &latch;
+        _shards[s]->post(job);
+    }
+    
+    latch.wait();
+}
+
+size_t SessionHost::getSessionCount() const
+{
+    size_t total = 0;
+    for (auto shard : _shards) {
+        total += shard->getSessionCount();
+    }
+    return total;
+}
+
+size_t SessionHost::getShardIndex(uint32_t sessionId) const
+{
+    // 乘法散列打散连续的会话ID
+    uint32_t hash = sessionId * 2654435761u;
+    return static_cast<size_t>(hash >> 16) % _shards.size();
+}
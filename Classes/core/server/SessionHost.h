@@ -0,0 +1,85 @@
+/**
+ * SessionHost.h
+ * 无界面会话服务，按会话ID把大量对局分散到各CPU核心的分片中
+ */
+
+#ifndef __SESSION_HOST_H__
+#define __SESSION_HOST_H__
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include "SessionProtocol.h"
+#include "SessionShard.h"
+
+/**
+ * 会话服务类
+ * 使用方式：先registerDeal注册所有关卡，再start启动分片，之后可在任意线程调用processBatch
+ */
+class SessionHost
+{
+public:
+    /**
+     * 构造函数
+     */
+    SessionHost();
+    
+    /**
+     * 析构函数
+     */
+    ~SessionHost();
+    
+    /**
+     * 注册关卡牌局，必须在start之前调用
+     * @param levelId 关卡ID
+     * @param deal 牌局定义
+     * @return 是否注册成功
+     */
+    bool registerDeal(uint32_t levelId, const CompactDeal& deal);
+    
+    /**
+     * 启动分片工作线程
+     * @param shardCount 分片数量，为0时使用CPU核心数
+     * @return 是否启动成功
+     */
+    bool start(int shardCount);
+    
+    /**
+     * 停止所有分片
+     */
+    void stop();
+    
+    /**
+     * 处理一批请求，阻塞直到所有响应写入
+     * 同一会话的请求按在批次中的顺序处理
+     * @param requests 请求数组
+     * @param count 请求数量
+     * @param responses 响应数组，长度至少为count
+     */
+    void processBatch(const SessionRequest* requests, size_t count, SessionResponse* responses);
+    
+    /**
+     * 获取分片数量
+     * @return 分片数量
+     */
+    int getShardCount() const { return static_cast<int>(_shards.size()); }
+    
+    /**
+     * 获取所有分片的会话总数
+     * @return 会话总数
+     */
+    size_t getSessionCount() const;
+    
+private:
+    std::unordered_map<uint32_t, CompactDeal> _deals;   // 已注册的牌局
+    std::vector<SessionShard*> _shards;                 // 分片
+    
+    /**
+     * 计算会话所属分片
+     * @param sessionId 会话ID
+     * @return 分片下标
+     */
+    size_t getShardIndex(uint32_t sessionId) const;
+};
+
+#endif // __SESSION_HOST_H__
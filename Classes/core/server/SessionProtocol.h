@@ -0,0 +1,65 @@
+/**
+ * SessionProtocol.h
+ * 会话服务的请求与响应结构，进程内队列与本地套接字共用同一二进制布局
+ */
+
+#ifndef __SESSION_PROTOCOL_H__
+#define __SESSION_PROTOCOL_H__
+
+#include <stdint.h>
+
+/**
+ * 请求类型
+ */
+enum SessionRequestType
+{
+    SRT_NONE = 0,
+    SRT_CREATE,     // 创建会话（使用levelId对应的牌局）
+    SRT_DRAW,       // 从备用牌堆抽牌
+    SRT_PLAY,       // 主牌区卡牌移动到手牌区
+    SRT_UNDO,       // 撤销最后一次操作
+    SRT_CLOSE       // 关闭会话
+};
+
+/**
+ * 处理结果
+ */
+enum SessionResultCode
+{
+    SRC_OK = 0,
+    SRC_ILLEGAL_MOVE,       // 操作不符合规则
+    SRC_NO_SESSION,         // 会话不存在
+    SRC_SESSION_EXISTS,     // 会话已存在
+    SRC_UNKNOWN_LEVEL,      // 关卡未注册
+    SRC_NOTHING_TO_UNDO,    // 没有可撤销的操作
+    SRC_BAD_REQUEST         // 请求格式错误
+};
+
+/**
+ * 会话请求，固定16字节
+ */
+struct SessionRequest
+{
+    uint32_t sessionId;     // 会话ID
+    uint32_t levelId;       // 关卡ID（仅SRT_CREATE使用）
+    int32_t cardIndex;      // 主牌区卡牌下标（仅SRT_PLAY使用）
+    uint8_t type;           // 请求类型（SessionRequestType）
+    uint8_t reserved[3];    // 保留
+};
+
+/**
+ * 会话响应，固定16字节
+ */
+struct SessionResponse
+{
+    uint32_t sessionId;             // 会话ID
+    uint8_t result;                 // 处理结果（SessionResultCode）
+    uint8_t trayValue;              // 手牌区顶部卡牌数值
+    uint8_t gameWon;                // 是否已胜利
+    uint8_t gameOver;               // 是否已结束
+    uint16_t playfieldRemaining;    // 主牌区剩余卡牌数
+    uint16_t stackRemaining;        // 备用牌堆剩余卡牌数
+    uint32_t moveCount;             // 已执行的操作数
+};
+
+#endif // __SESSION_PROTOCOL_H__
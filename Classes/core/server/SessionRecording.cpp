@@ -0,0 +1,120 @@
+/**
+ * SessionRecording.cpp
+ * 对局录制工具实现
+ */
+
+#include "SessionRecording.h"
+#include "core/rules/CompactGameState.h"
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <stdlib.h>
+
+const int SessionRecording::MOVE_UNDO;
+
+bool SessionRecording::saveToFile(const std::string& filePath, const std::vector<RecordedSession>& sessions)
+{
+    std::ofstream file(filePath.c_str());
+    if (!file) {
+        return false;
+    }
+    
+    for (const auto& session : sessions) {
+        file << session.levelId << ":";
+        for (int32_t move : session.moves) {
+            if (move == CompactGameState::MOVE_DRAW) {
+                file << " d";
+            } else if (move == MOVE_UNDO) {
+                file << " u";
+            } else {
+                file << " p" << move;
+            }
+        }
+        file << "\n";
+    }
+    
+    return static_cast<bool>(file);
+}
+
+bool SessionRecording::loadFromFile(const std::string& filePath, std::vector<RecordedSession>& sessions)
+{
+    std::ifstream file(filePath.c_str());
+    if (!file) {
+        return false;
+    }
+    
+    std::string line;
+    while (std::getline(file, line)) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        
+        RecordedSession session;
+        session.levelId = static_cast<uint32_t>(strtoul(line.substr(0, colon).c_str(), nullptr, 10));
+        
+        std::istringstream tokens(line.substr(colon + 1));
+        std::string token;
+        while (tokens >> token) {
+            if (token == "d") {
+                session.moves.push_back(CompactGameState::MOVE_DRAW);
+            } else if (token == "u") {
+                session.moves.push_back(MOVE_UNDO);
+            } else if (token.size() > 1 && token[0] == 'p') {
+                session.moves.push_back(atoi(token.c_str() + 1));
+            } else {
+                return false;
+            }
+        }
+        
+        sessions.push_back(session);
+    }
+    
+    return true;
+}
+
+void SessionRecording::generateRandomSessions(const CompactDeal& deal, uint32_t levelId, int sessionCount,
+                                              int maxMoves, uint32_t seed, std::vector<RecordedSession>& sessions)
+{
+    std::mt19937 rng(seed);
+    CompactGameState state;
+    std::vector<int32_t> plays;
+    
+    for (int s = 0; s < sessionCount; s++) {
+        RecordedSession session;
+        session.levelId = levelId;
+        
+        if (!state.reset(&deal)) {
+            return;
+        }
+        
+        for (int m = 0; m < maxMoves && !state.isGameOver(); m++) {
+            // 收集当前可出的牌
+            plays.clear();
+            for (int i = 0; i < deal.getPlayfieldCount(); i++) {
+                if (state.canMoveCardFromPlayfieldToTray(i)) {
+                    plays.push_back(i);
+                }
+            }
+            
+            int roll = static_cast<int>(rng() % 100);
+            int32_t move;
+            if (roll < 5 && state.canUndo()) {
+                move = MOVE_UNDO;
+                state.undo();
+            } else if (!plays.empty() && (roll < 85 || !state.canDrawCardFromStack())) {
+                move = plays[rng() % plays.size()];
+                state.moveCardFromPlayfieldToTray(move);
+            } else if (state.canDrawCardFromStack()) {
+                move = CompactGameState::MOVE_DRAW;
+                state.drawCardFromStack();
+            } else {
+                break;
+            }
+            
+            session.moves.push_back(move);
+        }
+        
+        sessions.push_back(session);
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * SessionRecording.h
+ * 录制的对局操作序列，供压测工具回放
+ */
+
+#ifndef __SESSION_RECORDING_H__
+#define __SESSION_RECORDING_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "core/rules/CompactDeal.h"
+
+/**
+ * 一局录制的操作
+ */
+struct RecordedSession
+{
+    uint32_t levelId;               // 关卡ID
+    std::vector<int32_t> moves;     // 操作序列（主牌区下标、MOVE_DRAW或MOVE_UNDO）
+    
+    RecordedSession()
+        : levelId(0)
+    {}
+};
+
+/**
+ * 对局录制工具类
+ * 文本格式每行一局："<levelId>: p3 d u p5"，p为出牌，d为抽牌，u为撤销
+ */
+class SessionRecording
+{
+public:
+    static const int MOVE_UNDO = -2;    // 撤销操作
+    
+    /**
+     * 保存录制到文件
+     * @param filePath 文件路径
+     * @param sessions 录制的对局
+     * @return 是否保存成功
+     */
+    static bool saveToFile(const std::string& filePath, const std::vector<RecordedSession>& sessions);
+    
+    /**
+     * 从文件加载录制
+     * @param filePath 文件路径
+     * @param sessions 输出的对局
+     * @return 是否加载成功
+     */
+    static bool loadFromFile(const std::string& filePath, std::vector<RecordedSession>& sessions);
+    
+    /**
+     * 按固定种子的随机策略生成对局（出牌、抽牌、偶尔撤销），所有操作都合法
+     * @param deal 牌局定义
+     * @param levelId 关卡ID
+     * @param sessionCount 生成的对局数
+     * @param maxMoves 每局最多操作数
+     * @param seed 随机种子
+     * @param sessions 输出的对局
+     */
+    static void generateRandomSessions(const CompactDeal& deal, uint32_t levelId, int sessionCount,
+                                       int maxMoves, uint32_t seed, std::vector<RecordedSession>& sessions);
+};
+
+#endif // __SESSION_RECORDING_H__
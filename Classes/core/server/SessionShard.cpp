@@ -0,0 +1,177 @@
+/**
+ * SessionShard.cpp
+ * 会话分片实现
+ */
+
+#include "SessionShard.h"
+
+void SessionBatchLatch::countDown()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (--_count == 0) {
+        _cond.notify_all();
+    }
+}
+
+void SessionBatchLatch::wait()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_count > 0) {
+        _cond.wait(lock);
+    }
+}
+
+SessionShard::SessionShard(const std::unordered_map<uint32_t, CompactDeal>* deals)
+    : _deals(deals)
+    , _sessionCount(0)
+    , _running(false)
+{
+}
+
+SessionShard::~SessionShard()
+{
+    stop();
+}
+
+void SessionShard::start()
+{
+    if (_running) {
+        return;
+    }
+    
+    _running = true;
+    _worker = std::thread(&SessionShard::run, this);
+}
+
+void SessionShard::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running) {
+            return;
+        }
+        _running = false;
+    }
+    _cond.notify_all();
+    
+    if (_worker.joinable()) {
+        _worker.join();
+    }
+}
+
+void SessionShard::post(const SessionShardJob& job)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(job);
+    }
+    _cond.notify_one();
+}
+
+void SessionShard::run()
+{
+    std::deque<SessionShardJob> pending;
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (_running && _jobs.empty()) {
+                _cond.wait(lock);
+            }
+            if (_jobs.empty()) {
+                break;
+            }
+            // 一次取走所有任务，处理期间不持有锁
+            pending.swap(_jobs);
+        }
+        
+        for (const auto& job : pending) {
+            for (size_t i = 0; i < job.count; i++) {
+                uint32_t index = job.indices[i];
+                processRequest(job.requests[index], job.responses[index]);
+            }
+            job.latch->countDown();
+        }
+        pending.clear();
+    }
+}
+
+void SessionShard::processRequest(const SessionRequest& request, SessionResponse& response)
+{
+    response = SessionResponse();
+    response.sessionId = request.sessionId;
+    
+    auto it = _slotBySession.find(request.sessionId);
+    
+    if (request.type == SRT_CREATE) {
+        if (it != _slotBySession.end()) {
+            response.result = SRC_SESSION_EXISTS;
+            return;
+        }
+        
+        auto dealIt = _deals->find(request.levelId);
+        if (dealIt == _deals->end()) {
+            response.result = SRC_UNKNOWN_LEVEL;
+            return;
+        }
+        
+        // 优先复用已关闭会话的槽位，状态缓冲区也随之复用
+        uint32_t slot;
+        if (!_freeSlots.empty()) {
+            slot = _freeSlots.back();
+            _freeSlots.pop_back();
+        } else {
+            slot = static_cast<uint32_t>(_states.size());
+            _states.push_back(CompactGameState());
+        }
+        
+        _states[slot].reset(&dealIt->second);
+        _slotBySession[request.sessionId] = slot;
+        _sessionCount.store(_slotBySession.size(), std::memory_order_relaxed);
+        
+        response.result = SRC_OK;
+        fillResponse(_states[slot], response);
+        return;
+    }
+    
+    if (it == _slotBySession.end()) {
+        response.result = SRC_NO_SESSION;
+        return;
+    }
+    
+    CompactGameState& state = _states[it->second];
+    
+    switch (request.type) {
+        case SRT_DRAW:
+            response.result = state.drawCardFromStack() ? SRC_OK : SRC_ILLEGAL_MOVE;
+            break;
+        case SRT_PLAY:
+            response.result = state.moveCardFromPlayfieldToTray(request.cardIndex) ? SRC_OK : SRC_ILLEGAL_MOVE;
+            break;
+        case SRT_UNDO:
+            response.result = state.undo() ? SRC_OK : SRC_NOTHING_TO_UNDO;
+            break;
+        case SRT_CLOSE:
+            response.result = SRC_OK;
+            fillResponse(state, response);
+            _freeSlots.push_back(it->second);
+            _slotBySession.erase(it);
+            _sessionCount.store(_slotBySession.size(), std::memory_order_relaxed);
+            return;
+        default:
+            response.result = SRC_BAD_REQUEST;
+            break;
+    }
+    
+    fillResponse(state, response);
+}
+
+void SessionShard::fillResponse(const CompactGameState& state, SessionResponse& response)
+{
+    response.trayValue = static_cast<uint8_t>(state.getTrayValue());
+    response.gameWon = state.isGameWon() ? 1 : 0;
+    response.gameOver = state.isGameOver() ? 1 : 0;
+    response.playfieldRemaining = static_cast<uint16_t>(state.getPlayfieldRemaining());
+    response.stackRemaining = static_cast<uint16_t>(state.getStackRemaining());
+    response.moveCount = static_cast<uint32_t>(state.getHistory().size());
+}
@@ -0,0 +1,119 @@
+/**
+ * SessionShard.h
+ * 会话分片，一个工作线程独占一组会话并按批处理请求
+ */
+
+#ifndef __SESSION_SHARD_H__
+#define __SESSION_SHARD_H__
+
+#include <stdint.h>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include "SessionProtocol.h"
+#include "core/rules/CompactGameState.h"
+
+/**
+ * 批处理完成计数器，所有分片处理完后唤醒提交方
+ */
+class SessionBatchLatch
+{
+public:
+    explicit SessionBatchLatch(int count) : _count(count) {}
+    
+    void countDown();
+    void wait();
+    
+private:
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    int _count;
+};
+
+/**
+ * 分片任务，描述一批请求中属于本分片的部分
+ */
+struct SessionShardJob
+{
+    const SessionRequest* requests;     // 整批请求
+    SessionResponse* responses;         // 整批响应
+    const uint32_t* indices;            // 本分片负责的请求下标
+    size_t count;                       // 下标数量
+    SessionBatchLatch* latch;           // 完成计数器
+};
+
+/**
+ * 会话分片类
+ * 会话状态只被分片自己的工作线程访问，因此处理请求时不需要加锁
+ */
+class SessionShard
+{
+public:
+    /**
+     * 创建分片
+     * @param deals 已注册的牌局（按关卡ID），分片运行期间只读
+     */
+    explicit SessionShard(const std::unordered_map<uint32_t, CompactDeal>* deals);
+    
+    ~SessionShard();
+    
+    /**
+     * 启动工作线程
+     */
+    void start();
+    
+    /**
+     * 停止工作线程，未处理的任务会先处理完
+     */
+    void stop();
+    
+    /**
+     * 投递任务
+     * @param job 分片任务
+     */
+    void post(const SessionShardJob& job);
+    
+    /**
+     * 在调用线程上直接处理一个请求（分片未启动时使用）
+     * @param request 请求
+     * @param response 响应
+     */
+    void processRequest(const SessionRequest& request, SessionResponse& response);
+    
+    /**
+     * 获取当前会话数量
+     * @return 会话数量
+     */
+    size_t getSessionCount() const { return _sessionCount.load(std::memory_order_relaxed); }
+    
+private:
+    const std::unordered_map<uint32_t, CompactDeal>* _deals;   // 已注册的牌局
+    std::unordered_map<uint32_t, uint32_t> _slotBySession;      // 会话ID到槽位
+    std::vector<CompactGameState> _states;                      // 会话状态槽位
+    std::vector<uint32_t> _freeSlots;                           // 空闲槽位
+    std::atomic<size_t> _sessionCount;                          // 会话数量（供其他线程读取）
+    
+    std::thread _worker;                    // 工作线程
+    std::mutex _mutex;                      // 任务队列锁
+    std::condition_variable _cond;          // 任务通知
+    std::deque<SessionShardJob> _jobs;      // 任务队列
+    bool _running;                          // 是否运行中
+    
+    /**
+     * 工作线程主循环
+     */
+    void run();
+    
+    /**
+     * 用会话状态填充响应
+     * @param state 会话状态
+     * @param response 响应
+     */
+    static void fillResponse(const CompactGameState& state, SessionResponse& response);
+};
+
+#endif // __SESSION_SHARD_H__
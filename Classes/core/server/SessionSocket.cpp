@@ -0,0 +1,318 @@
+/**
+ * SessionSocket.cpp
+ * 会话服务本地套接字实现
+ */
+
+#include "SessionSocket.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+const uint32_t SessionSocketServer::MAX_BATCH_SIZE;
+
+// 每次read的块大小
+static const size_t READ_CHUNK_SIZE = 64 * 1024;
+
+// 对端已关闭时写入返回错误而不是触发SIGPIPE
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif
+
+static bool readFully(int fd, void* buffer, size_t size)
+{
+    char* p = static_cast<char*>(buffer);
+    while (size > 0) {
+        ssize_t n = ::read(fd, p, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+static bool writeFully(int fd, const void* buffer, size_t size)
+{
+    const char* p = static_cast<const char*>(buffer);
+    while (size > 0) {
+        ssize_t n = ::write(fd, p, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        p += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+static bool fillAddress(const std::string& socketPath, sockaddr_un& addr)
+{
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socketPath.empty() || socketPath.size() >= sizeof(addr.sun_path)) {
+        return false;
+    }
+    memcpy(addr.sun_path, socketPath.c_str(), socketPath.size());
+    return true;
+}
+
+SessionSocketServer::SessionSocketServer()
+    : _listenFd(-1)
+    , _host(nullptr)
+{
+}
+
+SessionSocketServer::~SessionSocketServer()
+{
+    stop();
+}
+
+bool SessionSocketServer::start(const std::string& socketPath, SessionHost* host)
+{
+    sockaddr_un addr;
+    if (_listenFd >= 0 || !host || !fillAddress(socketPath, addr)) {
+        return false;
+    }
+    
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    
+    // 清理上次异常退出残留的套接字文件
+    ::unlink(socketPath.c_str());
+    
+    if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(fd, 64) != 0) {
+        ::close(fd);
+        return false;
+    }
+    
+    _listenFd = fd;
+    _socketPath = socketPath;
+    _host = host;
+    return true;
+}
+
+bool SessionSocketServer::pollOnce(int timeoutMs)
+{
+    if (_listenFd < 0) {
+        return false;
+    }
+    
+    std::vector<pollfd> fds;
+    fds.reserve(_clients.size() + 1);
+    
+    pollfd listenPoll;
+    listenPoll.fd = _listenFd;
+    listenPoll.events = POLLIN;
+    listenPoll.revents = 0;
+    fds.push_back(listenPoll);
+    
+    // 有响应未写完时只等待可写，读到的新批次不会在客户端不收响应时无限堆积
+    for (const auto& client : _clients) {
+        pollfd clientPoll;
+        clientPoll.fd = client.fd;
+        clientPoll.events = client.output.empty() ? POLLIN : POLLOUT;
+        clientPoll.revents = 0;
+        fds.push_back(clientPoll);
+    }
+    
+    int ready = ::poll(fds.data(), fds.size(), timeoutMs);
+    if (ready <= 0) {
+        return ready == 0 || errno == EINTR;
+    }
+    
+    // 处理已就绪的客户端，断开的连接从列表中移除
+    std::vector<ClientConnection> alive;
+    alive.reserve(_clients.size() + 1);
+    for (size_t i = 1; i < fds.size(); i++) {
+        ClientConnection& client = _clients[i - 1];
+        bool keep = true;
+        if (fds[i].revents & POLLOUT) {
+            keep = flushClient(client);
+        } else if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+            keep = serveClient(client) && flushClient(client);
+        }
+        if (keep) {
+            alive.push_back(std::move(client));
+        } else {
+            ::close(client.fd);
+        }
+    }
+    
+    if (fds[0].revents & POLLIN) {
+        int clientFd = ::accept(_listenFd, nullptr, nullptr);
+        if (clientFd >= 0) {
+            int flags = ::fcntl(clientFd, F_GETFL, 0);
+            if (flags < 0 || ::fcntl(clientFd, F_SETFL, flags | O_NONBLOCK) != 0) {
+                ::close(clientFd);
+            } else {
+                ClientConnection client;
+                client.fd = clientFd;
+                client.outputOffset = 0;
+                alive.push_back(std::move(client));
+            }
+        }
+    }
+    
+    _clients.swap(alive);
+    return true;
+}
+
+bool SessionSocketServer::serveClient(ClientConnection& client)
+{
+    // 读到暂时没有数据为止，对端关闭时返回false
+    char chunk[READ_CHUNK_SIZE];
+    for (;;) {
+        ssize_t n = ::read(client.fd, chunk, sizeof(chunk));
+        if (n > 0) {
+            client.input.insert(client.input.end(), chunk, chunk + n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        return false;
+    }
+    
+    // 逐个处理已经完整的批次，剩余的不完整数据留到下次
+    size_t offset = 0;
+    while (client.input.size() - offset >= sizeof(uint32_t)) {
+        uint32_t count = 0;
+        memcpy(&count, &client.input[offset], sizeof(count));
+        if (count > MAX_BATCH_SIZE) {
+            return false;
+        }
+        size_t frameSize = sizeof(count) + count * sizeof(SessionRequest);
+        if (client.input.size() - offset < frameSize) {
+            break;
+        }
+        
+        _requests.resize(count);
+        _responses.resize(count);
+        if (count > 0) {
+            memcpy(_requests.data(), &client.input[offset + sizeof(count)], count * sizeof(SessionRequest));
+        }
+        _host->processBatch(_requests.data(), count, _responses.data());
+        offset += frameSize;
+        
+        const char* countBytes = reinterpret_cast<const char*>(&count);
+        const char* responseBytes = reinterpret_cast<const char*>(_responses.data());
+        client.output.insert(client.output.end(), countBytes, countBytes + sizeof(count));
+        client.output.insert(client.output.end(), responseBytes, responseBytes + count * sizeof(SessionResponse));
+    }
+    client.input.erase(client.input.begin(), client.input.begin() + offset);
+    return true;
+}
+
+bool SessionSocketServer::flushClient(ClientConnection& client)
+{
+    while (client.outputOffset < client.output.size()) {
+        ssize_t n = ::send(client.fd, &client.output[client.outputOffset], client.output.size() - client.outputOffset,
+                           SEND_FLAGS);
+        if (n > 0) {
+            client.outputOffset += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;
+        }
+        return false;
+    }
+    
+    client.output.clear();
+    client.outputOffset = 0;
+    return true;
+}
+
+void SessionSocketServer::stop()
+{
+    for (const auto& client : _clients) {
+        ::close(client.fd);
+    }
+    _clients.clear();
+    
+    if (_listenFd >= 0) {
+        ::close(_listenFd);
+        _listenFd = -1;
+        ::unlink(_socketPath.c_str());
+    }
+}
+
+SessionSocketClient::SessionSocketClient()
+    : _fd(-1)
+{
+}
+
+SessionSocketClient::~SessionSocketClient()
+{
+    close();
+}
+
+bool SessionSocketClient::connect(const std::string& socketPath)
+{
+    sockaddr_un addr;
+    if (_fd >= 0 || !fillAddress(socketPath, addr)) {
+        return false;
+    }
+    
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return false;
+    }
+    
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        return false;
+    }
+    
+    _fd = fd;
+    return true;
+}
+
+bool SessionSocketClient::processBatch(const SessionRequest* requests, size_t count, SessionResponse* responses)
+{
+    if (_fd < 0 || count > SessionSocketServer::MAX_BATCH_SIZE) {
+        return false;
+    }
+    
+    uint32_t sendCount = static_cast<uint32_t>(count);
+    if (!writeFully(_fd, &sendCount, sizeof(sendCount))
+        || (count > 0 && !writeFully(_fd, requests, count * sizeof(SessionRequest)))) {
+        return false;
+    }
+    
+    uint32_t recvCount = 0;
+    if (!readFully(_fd, &recvCount, sizeof(recvCount)) || recvCount != sendCount) {
+        return false;
+    }
+    
+    return count == 0 || readFully(_fd, responses, count * sizeof(SessionResponse));
+}
+
+void SessionSocketClient::close()
+{
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * SessionSocket.h
+ * 会话服务的本地套接字（Unix domain socket）前端与客户端
+ * 帧格式：uint32数量 + 数量个SessionRequest/SessionResponse，使用本机字节序
+ */
+
+#ifndef __SESSION_SOCKET_H__
+#define __SESSION_SOCKET_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "SessionHost.h"
+
+/**
+ * 本地套接字服务端，把每个收到的批次交给SessionHost处理并回写响应
+ * 客户端连接为非阻塞，每个连接各自缓存未凑齐的请求与未写完的响应，只处理完整的批次，
+ * 慢速或中途停顿的客户端不会阻塞其他连接；有响应未写完的连接暂停读取
+ */
+class SessionSocketServer
+{
+public:
+    static const uint32_t MAX_BATCH_SIZE = 65536;   // 单批最大请求数
+    
+    /**
+     * 构造函数
+     */
+    SessionSocketServer();
+    
+    /**
+     * 析构函数
+     */
+    ~SessionSocketServer();
+    
+    /**
+     * 在指定路径上监听
+     * @param socketPath 套接字文件路径
+     * @param host 会话服务
+     * @return 是否监听成功
+     */
+    bool start(const std::string& socketPath, SessionHost* host);
+    
+    /**
+     * 等待并处理一轮连接与请求
+     * @param timeoutMs 等待超时（毫秒）
+     * @return 服务是否仍在运行
+     */
+    bool pollOnce(int timeoutMs);
+    
+    /**
+     * 关闭所有连接并删除套接字文件
+     */
+    void stop();
+    
+private:
+    int _listenFd;                              // 监听套接字
+    std::string _socketPath;                    // 套接字文件路径
+    SessionHost* _host;                         // 会话服务
+    /**
+     * 一个客户端连接
+     */
+    struct ClientConnection
+    {
+        int fd;
+        std::vector<char> input;                // 尚未组成完整批次的请求数据
+        std::vector<char> output;               // 尚未写出的响应数据
+        size_t outputOffset;                    // output中已写出的字节数
+    };
+    
+    std::vector<ClientConnection> _clients;     // 客户端连接
+    std::vector<SessionRequest> _requests;      // 请求缓冲区（复用）
+    std::vector<SessionResponse> _responses;    // 响应缓冲区（复用）
+    
+    /**
+     * 读取客户端当前可读的数据，处理其中全部完整的批次
+     * @param client 客户端连接
+     * @return 连接是否仍然有效（对端关闭、出错或批次过大时返回false）
+     */
+    bool serveClient(ClientConnection& client);
+    
+    /**
+     * 尽量写出客户端的待发响应，写不下时留到下次可写
+     * @param client 客户端连接
+     * @return 连接是否仍然有效
+     */
+    bool flushClient(ClientConnection& client);
+};
+
+/**
+ * 本地套接字客户端
+ */
+class SessionSocketClient
+{
+public:
+    /**
+     * 构造函数
+     */
+    SessionSocketClient();
+    
+    /**
+     * 析构函数
+     */
+    ~SessionSocketClient();
+    
+    /**
+     * 连接服务端
+     * @param socketPath 套接字文件路径
+     * @return 是否连接成功
+     */
+    bool connect(const std::string& socketPath);
+    
+    /**
+     * 发送一批请求并等待响应
+     * @param requests 请求数组
+     * @param count 请求数量
+     * @param responses 响应数组，长度至少为count
+     * @return 是否成功
+     */
+    bool processBatch(const SessionRequest* requests, size_t count, SessionResponse* responses);
+    
+    /**
+     * 断开连接
+     */
+    void close();
+    
+private:
+    int _fd;    // 连接
+};
+
+#endif // __SESSION_SOCKET_H__
@@ -0,0 +1,319 @@
+/**
+ * BeamSolver.cpp
+ * 束搜索求解器实现
+ */
+
+#include "BeamSolver.h"
+#include "core/rules/CanonicalForm.h"
+#include "core/rules/CompactGameState.h"
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <unordered_set>
+
+static const uint32_t NO_LINK = 0xFFFFFFFF;
+static const int8_t LINK_MOVE_DRAW = 0;     // 链接中的操作：0为抽牌，1-13为打出的数值
+
+/**
+ * 规范状态节点
+ */
+struct BeamNode
+{
+    uint16_t counts[CardRules::NUM_CARD_VALUES];    // 主牌区各数值剩余数量
+    uint16_t playfieldRemaining;                     // 主牌区剩余卡牌数
+    uint16_t stackRemaining;                         // 备用牌堆剩余数
+    uint8_t trayValue;                               // 手牌数值
+    int8_t move;                                     // 到达该节点的操作
+    uint32_t parentLink;                             // 父节点的链接
+    int32_t score;                                   // 排序分数，越大越好
+};
+
+/**
+ * 路径链接
+ */
+struct BeamLink
+{
+    uint32_t parent;    // 父链接
+    int8_t move;        // 操作
+};
+
+/**
+ * 计算节点排序分数：优先剩余主牌少，其次手牌可接的数值多
+ */
+static int32_t scoreNode(const BeamNode& node)
+{
+    int mobility = 0;
+    if (node.trayValue > CardRules::MIN_CARD_VALUE && node.counts[node.trayValue - 2] > 0) {
+        mobility++;
+    }
+    if (node.trayValue < CardRules::MAX_CARD_VALUE && node.counts[node.trayValue] > 0) {
+        mobility++;
+    }
+    return -static_cast<int32_t>(node.playfieldRemaining) * 4 + mobility;
+}
+
+/**
+ * 计算节点的规范哈希（不含路径信息）
+ */
+static uint64_t hashNode(const BeamNode& node)
+{
+    uint8_t form[sizeof(node.counts) + 3];
+    memcpy(form, node.counts, sizeof(node.counts));
+    form[sizeof(node.counts)] = static_cast<uint8_t>(node.stackRemaining & 0xFF);
+    form[sizeof(node.counts) + 1] = static_cast<uint8_t>(node.stackRemaining >> 8);
+    form[sizeof(node.counts) + 2] = node.trayValue;
+    return CanonicalForm::hashBytes(form, sizeof(form));
+}
+
+/**
+ * 从节点出发随机对局：有可接的数值时随机打出一张，否则抽牌
+ */
+static bool randomPlayout(BeamNode node, const CompactDeal& deal, std::mt19937_64& rng)
+{
+    while (node.playfieldRemaining > 0) {
+        int candidates[2];
+        int candidateCount = 0;
+        if (node.trayValue > CardRules::MIN_CARD_VALUE && node.counts[node.trayValue - 2] > 0) {
+            candidates[candidateCount++] = node.trayValue - 1;
+        }
+        if (node.trayValue < CardRules::MAX_CARD_VALUE && node.counts[node.trayValue] > 0) {
+            candidates[candidateCount++] = node.trayValue + 1;
+        }
+        
+        if (candidateCount > 0) {
+            int value = candidates[candidateCount == 1 ? 0 : rng() & 1];
+            node.counts[value - 1]--;
+            node.playfieldRemaining--;
+            node.trayValue = static_cast<uint8_t>(value);
+        } else if (node.stackRemaining > 0) {
+            node.stackRemaining--;
+            node.trayValue = static_cast<uint8_t>(deal.getStackValue(node.stackRemaining));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * 回收不再被束或最好节点引用的链接，保持父链接在子链接之前的顺序
+ */
+static void collectLinks(std::vector<BeamLink>& links, std::vector<BeamNode>& beam, uint32_t& bestLink)
+{
+    std::vector<uint32_t> remap(links.size(), NO_LINK);
+    
+    // 标记：从每个根向上走，遇到已标记的链接即停止
+    auto mark = [&links, &remap](uint32_t link) {
+        while (link != NO_LINK && remap[link] == NO_LINK) {
+            remap[link] = 0;
+            link = links[link].parent;
+        }
+    };
+    for (const auto& node : beam) {
+        mark(node.parentLink);
+    }
+    mark(bestLink);
+    
+    // 压缩：父链接下标总是小于子链接，顺序遍历即可完成重映射
+    uint32_t next = 0;
+    for (size_t i = 0; i < links.size(); i++) {
+        if (remap[i] == NO_LINK) {
+            continue;
+        }
+        BeamLink link = links[i];
+        link.parent = link.parent == NO_LINK ? NO_LINK : remap[link.parent];
+        remap[i] = next;
+        links[next++] = link;
+    }
+    links.resize(next);
+    
+    for (auto& node : beam) {
+        node.parentLink = node.parentLink == NO_LINK ? NO_LINK : remap[node.parentLink];
+    }
+    bestLink = bestLink == NO_LINK ? NO_LINK : remap[bestLink];
+}
+
+/**
+ * 把链接上的数值操作还原为主牌区下标，并在CompactGameState上重放校验
+ */
+static bool buildLine(const CompactDeal& deal, const std::vector<BeamLink>& links, uint32_t leaf,
+                      std::vector<int32_t>& line, int& playfieldRemaining)
+{
+    std::vector<int8_t> moves;
+    for (uint32_t link = leaf; link != NO_LINK; link = links[link].parent) {
+        moves.push_back(links[link].move);
+    }
+    std::reverse(moves.begin(), moves.end());
+    
+    // 每个数值的主牌区下标，打出该数值时依次取用
+    std::vector<int32_t> indicesByValue[CardRules::NUM_CARD_VALUES];
+    for (int i = deal.getPlayfieldCount() - 1; i >= 0; i--) {
+        indicesByValue[deal.getPlayfieldValue(i) - 1].push_back(i);
+    }
+    
+    CompactGameState state;
+    state.reset(&deal);
+    line.clear();
+    for (auto move : moves) {
+        int32_t index = CompactGameState::MOVE_DRAW;
+        if (move != LINK_MOVE_DRAW) {
+            std::vector<int32_t>& indices = indicesByValue[move - 1];
+            if (indices.empty()) {
+                return false;
+            }
+            index = indices.back();
+            indices.pop_back();
+        }
+        if (!state.applyMove(index)) {
+            return false;
+        }
+        line.push_back(index);
+    }
+    
+    playfieldRemaining = state.getPlayfieldRemaining();
+    return true;
+}
+
+bool BeamSolver::search(const CompactDeal& deal, const AnytimeSearchOptions& options, AnytimeSearchResult& result)
+{
+    result = AnytimeSearchResult();
+    if (deal.getStackCount() == 0 || deal.getPlayfieldCount() > 0xFFFF || deal.getStackCount() > 0xFFFF
+        || options.initialBeamWidth <= 0) {
+        return false;
+    }
+    
+    auto startTime = std::chrono::steady_clock::now();
+    auto elapsedSeconds = [&startTime]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    };
+    
+    BeamNode root;
+    memset(&root, 0, sizeof(root));
+    for (auto face : deal.getPlayfieldFaces()) {
+        root.counts[face]++;
+    }
+    root.playfieldRemaining = static_cast<uint16_t>(deal.getPlayfieldCount());
+    root.stackRemaining = static_cast<uint16_t>(deal.getStackCount() - 1);
+    root.trayValue = static_cast<uint8_t>(deal.getStackValue(root.stackRemaining));
+    root.parentLink = NO_LINK;
+    root.score = scoreNode(root);
+    
+    std::vector<BeamLink> links;
+    std::vector<BeamNode> beam;
+    std::vector<BeamNode> children;
+    std::unordered_set<uint64_t> seen;
+    
+    BeamNode best = root;
+    uint32_t bestLink = NO_LINK;
+    bool won = false;
+    bool outOfBudget = false;
+    int width = options.initialBeamWidth;
+    
+    while (!won && !outOfBudget) {
+        result.beamWidth = width;
+        beam.assign(1, root);
+        
+        while (!beam.empty() && !won && !outOfBudget) {
+            // 生成下一层
+            children.clear();
+            seen.clear();
+            for (const auto& node : beam) {
+                for (int delta = -1; delta <= 1; delta += 2) {
+                    int value = node.trayValue + delta;
+                    if (value < CardRules::MIN_CARD_VALUE || value > CardRules::MAX_CARD_VALUE || node.counts[value - 1] == 0) {
+                        continue;
+                    }
+                    BeamNode child = node;
+                    child.counts[value - 1]--;
+                    child.playfieldRemaining--;
+                    child.trayValue = static_cast<uint8_t>(value);
+                    child.move = static_cast<int8_t>(value);
+                    children.push_back(child);
+                }
+                if (node.stackRemaining > 0) {
+                    BeamNode child = node;
+                    child.stackRemaining--;
+                    child.trayValue = static_cast<uint8_t>(deal.getStackValue(child.stackRemaining));
+                    child.move = LINK_MOVE_DRAW;
+                    children.push_back(child);
+                }
+            }
+            result.nodes += children.size();
+            
+            // 按规范状态去重
+            size_t unique = 0;
+            for (size_t i = 0; i < children.size(); i++) {
+                if (seen.insert(hashNode(children[i])).second) {
+                    children[i].score = scoreNode(children[i]);
+                    children[unique++] = children[i];
+                }
+            }
+            children.resize(unique);
+            
+            if (children.size() > static_cast<size_t>(width)) {
+                std::nth_element(children.begin(), children.begin() + width, children.end(),
+                                 [](const BeamNode& a, const BeamNode& b) { return a.score > b.score; });
+                children.resize(width);
+            }
+            
+            // 为保留的节点建立链接
+            for (auto& child : children) {
+                BeamLink link;
+                link.parent = child.parentLink;
+                link.move = child.move;
+                links.push_back(link);
+                child.parentLink = static_cast<uint32_t>(links.size() - 1);
+                
+                if (child.playfieldRemaining < best.playfieldRemaining) {
+                    best = child;
+                    bestLink = child.parentLink;
+                    won = child.playfieldRemaining == 0;
+                }
+            }
+            beam.swap(children);
+            
+            if (links.size() > options.maxLinkCount / 2) {
+                collectLinks(links, beam, bestLink);
+                if (links.size() > options.maxLinkCount / 2) {
+                    outOfBudget = true;
+                }
+            }
+            if ((options.nodeBudget > 0 && result.nodes >= options.nodeBudget)
+                || (options.timeLimitSeconds > 0 && elapsedSeconds() >= options.timeLimitSeconds)) {
+                outOfBudget = true;
+            }
+        }
+        
+        if (!won && !outOfBudget) {
+            if (width >= options.maxBeamWidth) {
+                break;
+            }
+            width = std::min(width * 2, options.maxBeamWidth);
+            beam.clear();
+            collectLinks(links, beam, bestLink);
+        }
+    }
+    
+    if (!buildLine(deal, links, bestLink, result.line, result.playfieldRemaining)) {
+        return false;
+    }
+    
+    if (won) {
+        result.status = ASS_WON;
+        result.confidence = 1.0f;
+    } else {
+        result.status = outOfBudget ? ASS_BUDGET : ASS_EXHAUSTED;
+        std::mt19937_64 rng(options.seed);
+        int wins = 0;
+        for (int i = 0; i < options.confidencePlayouts; i++) {
+            if (randomPlayout(best, deal, rng)) {
+                wins++;
+            }
+        }
+        result.confidence = options.confidencePlayouts > 0 ? static_cast<float>(wins) / options.confidencePlayouts : 0.0f;
+    }
+    result.seconds = elapsedSeconds();
+    
+    return true;
+}
@@ -0,0 +1,92 @@
+/**
+ * BeamSolver.h
+ * 随时可中断的束搜索求解器，用于精确搜索无法完成的超大关卡
+ */
+
+#ifndef __BEAM_SOLVER_H__
+#define __BEAM_SOLVER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "core/rules/CompactDeal.h"
+
+/**
+ * 束搜索参数
+ */
+struct AnytimeSearchOptions
+{
+    int initialBeamWidth;       // 初始束宽
+    int maxBeamWidth;           // 最大束宽，每轮未通关时束宽翻倍直到该值
+    uint64_t nodeBudget;        // 节点预算，为0表示不限
+    double timeLimitSeconds;    // 时间上限（秒），为0表示不限
+    size_t maxLinkCount;        // 路径链表的最大条目数（每条8字节），决定内存上限
+    int confidencePlayouts;     // 估计置信度的随机对局数
+    uint64_t seed;              // 随机种子
+    
+    AnytimeSearchOptions()
+        : initialBeamWidth(64)
+        , maxBeamWidth(1 << 16)
+        , nodeBudget(0)
+        , timeLimitSeconds(1.0)
+        , maxLinkCount(static_cast<size_t>(1) << 22)
+        , confidencePlayouts(64)
+        , seed(1)
+    {}
+};
+
+/**
+ * 束搜索结论
+ */
+enum AnytimeSearchStatus
+{
+    ASS_WON = 0,        // 找到通关线
+    ASS_EXHAUSTED,      // 最大束宽下所有分支都走到死局
+    ASS_BUDGET          // 节点、时间或内存预算用完
+};
+
+/**
+ * 束搜索结果
+ */
+struct AnytimeSearchResult
+{
+    int status;                 // 结论（AnytimeSearchStatus）
+    std::vector<int32_t> line;  // 目前最好的操作序列（主牌区下标或MOVE_DRAW）
+    int playfieldRemaining;     // 执行该序列后主牌区剩余卡牌数
+    float confidence;           // 可解置信度（0-1），通关线为1
+    uint64_t nodes;             // 生成的节点数
+    int beamWidth;              // 最后一轮的束宽
+    double seconds;             // 耗时
+    
+    AnytimeSearchResult()
+        : status(ASS_BUDGET)
+        , playfieldRemaining(0)
+        , confidence(0.0f)
+        , nodes(0)
+        , beamWidth(0)
+        , seconds(0.0)
+    {}
+};
+
+/**
+ * 束搜索求解器类
+ * 节点只保存规范状态（各数值剩余数量、备用牌堆剩余数、手牌数值），大小与牌局规模无关；
+ * 每层按剩余主牌数和手牌可接数量排序保留束宽个状态，并按规范哈希去重。
+ * 路径以父链接形式保存在链表中，超过一半上限时回收不再被引用的链接，
+ * 因此内存只取决于束宽和链表上限。未通关时束宽翻倍重新搜索，随时保留最好的线路，
+ * 置信度为从最好线路末端出发的随机对局通关比例
+ */
+class BeamSolver
+{
+public:
+    /**
+     * 搜索牌局
+     * @param deal 牌局定义
+     * @param options 搜索参数
+     * @param result 输出的结果
+     * @return 是否执行了搜索
+     */
+    static bool search(const CompactDeal& deal, const AnytimeSearchOptions& options, AnytimeSearchResult& result);
+};
+
+#endif // __BEAM_SOLVER_H__
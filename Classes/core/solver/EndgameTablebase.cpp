@@ -0,0 +1,391 @@
+/**
+ * EndgameTablebase.cpp
+ * 残局库实现
+ */
+
+#include "EndgameTablebase.h"
+#include <string.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const char EndgameTablebase::TABLEBASE_MAGIC[4] = { 'C', 'L', 'T', 'B' };
+const uint16_t EndgameTablebase::TABLEBASE_VERSION;
+const int EndgameTablebase::MAX_SUPPORTED_CARDS;
+
+static const size_t HEADER_SIZE = 16;
+static const int NUM_VALUES = CardRules::NUM_CARD_VALUES;
+static const uint8_t MOVE_NIBBLE_DRAW = 0;
+static const uint8_t MOVE_NIBBLE_NONE = 0x0F;
+static const int MAX_BINOMIAL = NUM_VALUES + EndgameTablebase::MAX_SUPPORTED_CARDS;
+
+/**
+ * 组合数表，函数内静态对象的初始化是线程安全的
+ */
+struct BinomialTable
+{
+    uint64_t values[MAX_BINOMIAL + 1][MAX_BINOMIAL + 1];
+    
+    BinomialTable()
+    {
+        memset(values, 0, sizeof(values));
+        for (int n = 0; n <= MAX_BINOMIAL; n++) {
+            values[n][0] = 1;
+            for (int k = 1; k <= n; k++) {
+                values[n][k] = values[n - 1][k - 1] + values[n - 1][k];
+            }
+        }
+    }
+};
+
+static uint64_t binomial(int n, int k)
+{
+    static const BinomialTable table;
+    return k < 0 || k > n ? 0 : table.values[n][k];
+}
+
+/**
+ * 13的幂
+ */
+static uint64_t powerOfValues(int exponent)
+{
+    uint64_t result = 1;
+    for (int i = 0; i < exponent; i++) {
+        result *= NUM_VALUES;
+    }
+    return result;
+}
+
+/**
+ * 数值多重集的排名（可重复组合的组合数系统）
+ */
+static uint64_t rankMultiset(const int* counts)
+{
+    uint64_t rank = 0;
+    int position = 0;
+    for (int value = 0; value < NUM_VALUES; value++) {
+        for (int i = 0; i < counts[value]; i++) {
+            position++;
+            rank += binomial(value + position - 1, position);
+        }
+    }
+    return rank;
+}
+
+/**
+ * 按小端序读取整数
+ */
+static uint64_t readLittleEndian(const uint8_t* data, int size)
+{
+    uint64_t value = 0;
+    for (int i = size - 1; i >= 0; i--) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+/**
+ * 枚举所有大小为k的数值直方图
+ */
+template <typename Visitor>
+static void forEachHistogram(int* counts, int value, int remaining, Visitor& visitor)
+{
+    if (value == NUM_VALUES - 1) {
+        counts[value] = remaining;
+        visitor(counts);
+        return;
+    }
+    for (int count = 0; count <= remaining; count++) {
+        counts[value] = count;
+        forEachHistogram(counts, value + 1, remaining - count, visitor);
+    }
+}
+
+EndgameTablebase::EndgameTablebase()
+    : _entries(nullptr)
+    , _mapping(nullptr)
+    , _mappingSize(0)
+    , _entryCount(0)
+    , _maxCards(0)
+{
+    memset(_blockOffsets, 0, sizeof(_blockOffsets));
+}
+
+EndgameTablebase::~EndgameTablebase()
+{
+    unload();
+}
+
+uint64_t EndgameTablebase::layoutBlocks(int maxCards)
+{
+    uint64_t offset = 0;
+    for (int playfieldCount = 0; playfieldCount <= maxCards; playfieldCount++) {
+        for (int stackCount = 0; playfieldCount + stackCount <= maxCards; stackCount++) {
+            _blockOffsets[playfieldCount][stackCount] = offset;
+            offset += binomial(playfieldCount + NUM_VALUES - 1, playfieldCount) * powerOfValues(stackCount) * NUM_VALUES;
+        }
+    }
+    return offset;
+}
+
+uint64_t EndgameTablebase::indexOf(const int* counts, int playfieldCount, const uint8_t* stackFaces, int stackCount,
+                                   int trayValue) const
+{
+    uint64_t stackRank = 0;
+    for (int i = stackCount - 1; i >= 0; i--) {
+        stackRank = stackRank * NUM_VALUES + stackFaces[i];
+    }
+    
+    return _blockOffsets[playfieldCount][stackCount]
+        + (rankMultiset(counts) * powerOfValues(stackCount) + stackRank) * NUM_VALUES + (trayValue - 1);
+}
+
+bool EndgameTablebase::build(int maxCards)
+{
+    if (maxCards < 1 || maxCards > MAX_SUPPORTED_CARDS) {
+        return false;
+    }
+    
+    unload();
+    _maxCards = maxCards;
+    _entryCount = layoutBlocks(maxCards);
+    _buffer.assign(static_cast<size_t>(_entryCount), 0);
+    uint8_t* entries = _buffer.data();
+    _entries = entries;
+    
+    // 每个操作使剩余卡牌减少1，按剩余卡牌总数从小到大计算即可保证子局面已就绪
+    for (int total = 0; total <= maxCards; total++) {
+        for (int playfieldCount = 0; playfieldCount <= total; playfieldCount++) {
+            int stackCount = total - playfieldCount;
+            uint64_t stackVariants = powerOfValues(stackCount);
+            uint64_t lowerVariants = stackCount > 0 ? powerOfValues(stackCount - 1) : 1;
+            
+            auto visitor = [&](int* counts) {
+                uint8_t stackFaces[MAX_SUPPORTED_CARDS];
+                for (uint64_t stackRank = 0; stackRank < stackVariants; stackRank++) {
+                    uint64_t digits = stackRank;
+                    for (int i = 0; i < stackCount; i++) {
+                        stackFaces[i] = static_cast<uint8_t>(digits % NUM_VALUES);
+                        digits /= NUM_VALUES;
+                    }
+                    
+                    for (int trayValue = CardRules::MIN_CARD_VALUE; trayValue <= CardRules::MAX_CARD_VALUE; trayValue++) {
+                        uint64_t index = indexOf(counts, playfieldCount, stackFaces, stackCount, trayValue);
+                        if (playfieldCount == 0) {
+                            entries[index] = static_cast<uint8_t>((1 << 4) | MOVE_NIBBLE_NONE);
+                            continue;
+                        }
+                        
+                        int bestDraws = 0xFF;
+                        uint8_t bestMove = MOVE_NIBBLE_NONE;
+                        for (int delta = -1; delta <= 1; delta += 2) {
+                            int value = trayValue + delta;
+                            if (value < CardRules::MIN_CARD_VALUE || value > CardRules::MAX_CARD_VALUE || counts[value - 1] == 0) {
+                                continue;
+                            }
+                            counts[value - 1]--;
+                            uint8_t child = entries[indexOf(counts, playfieldCount - 1, stackFaces, stackCount, value)];
+                            counts[value - 1]++;
+                            if ((child >> 4) != 0 && (child >> 4) - 1 < bestDraws) {
+                                bestDraws = (child >> 4) - 1;
+                                bestMove = static_cast<uint8_t>(value);
+                            }
+                        }
+                        if (stackCount > 0) {
+                            // 抽牌：最后一个面值成为手牌，其余面值的排名为去掉最高位后的值
+                            uint64_t childIndex = _blockOffsets[playfieldCount][stackCount - 1]
+                                + (rankMultiset(counts) * lowerVariants + stackRank % lowerVariants) * NUM_VALUES
+                                + stackFaces[stackCount - 1];
+                            uint8_t child = entries[childIndex];
+                            if ((child >> 4) != 0 && (child >> 4) < bestDraws) {
+                                bestDraws = child >> 4;
+                                bestMove = MOVE_NIBBLE_DRAW;
+                            }
+                        }
+                        
+                        entries[index] = bestMove == MOVE_NIBBLE_NONE
+                            ? MOVE_NIBBLE_NONE : static_cast<uint8_t>(((bestDraws + 1) << 4) | bestMove);
+                    }
+                }
+            };
+            
+            int counts[NUM_VALUES];
+            forEachHistogram(counts, 0, playfieldCount, visitor);
+        }
+    }
+    
+    return true;
+}
+
+bool EndgameTablebase::saveToFile(const std::string& filePath) const
+{
+    if (!_entries) {
+        return false;
+    }
+    
+    FILE* file = fopen(filePath.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    
+    uint8_t header[HEADER_SIZE];
+    memcpy(header, TABLEBASE_MAGIC, 4);
+    header[4] = static_cast<uint8_t>(TABLEBASE_VERSION & 0xFF);
+    header[5] = static_cast<uint8_t>(TABLEBASE_VERSION >> 8);
+    header[6] = static_cast<uint8_t>(_maxCards & 0xFF);
+    header[7] = static_cast<uint8_t>(_maxCards >> 8);
+    for (int i = 0; i < 8; i++) {
+        header[8 + i] = static_cast<uint8_t>(_entryCount >> (i * 8));
+    }
+    
+    bool result = fwrite(header, 1, HEADER_SIZE, file) == HEADER_SIZE
+        && fwrite(_entries, 1, static_cast<size_t>(_entryCount), file) == _entryCount;
+    fclose(file);
+    return result;
+}
+
+bool EndgameTablebase::loadFromFile(const std::string& filePath)
+{
+    unload();
+    
+#ifndef _WIN32
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || static_cast<size_t>(fileStat.st_size) < HEADER_SIZE) {
+        close(fd);
+        return false;
+    }
+    
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    _mapping = mapping;
+    _mappingSize = fileSize;
+    const uint8_t* data = static_cast<const uint8_t*>(mapping);
+#else
+    FILE* file = fopen(filePath.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    fseek(file, 0, SEEK_END);
+    long fileLength = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (fileLength < static_cast<long>(HEADER_SIZE)) {
+        fclose(file);
+        return false;
+    }
+    
+    size_t fileSize = static_cast<size_t>(fileLength);
+    _buffer.resize(fileSize);
+    bool readOk = fread(_buffer.data(), 1, fileSize, file) == fileSize;
+    fclose(file);
+    if (!readOk) {
+        unload();
+        return false;
+    }
+    const uint8_t* data = _buffer.data();
+#endif
+    
+    int maxCards = static_cast<int>(readLittleEndian(data + 6, 2));
+    uint64_t entryCount = readLittleEndian(data + 8, 8);
+    if (memcmp(data, TABLEBASE_MAGIC, 4) != 0 || readLittleEndian(data + 4, 2) != TABLEBASE_VERSION
+        || maxCards < 1 || maxCards > MAX_SUPPORTED_CARDS
+        || layoutBlocks(maxCards) != entryCount || fileSize != HEADER_SIZE + entryCount) {
+        unload();
+        return false;
+    }
+    
+    _maxCards = maxCards;
+    _entryCount = entryCount;
+    _entries = data + HEADER_SIZE;
+    return true;
+}
+
+void EndgameTablebase::unload()
+{
+#ifndef _WIN32
+    if (_mapping) {
+        munmap(_mapping, _mappingSize);
+    }
+#endif
+    _mapping = nullptr;
+    _mappingSize = 0;
+    _buffer.clear();
+    _buffer.shrink_to_fit();
+    _entries = nullptr;
+    _entryCount = 0;
+    _maxCards = 0;
+}
+
+bool EndgameTablebase::probe(const CompactGameState& state, EndgameProbe& probe) const
+{
+    probe = EndgameProbe();
+    if (!covers(state) || state.getTrayValue() == 0) {
+        return false;
+    }
+    
+    int counts[NUM_VALUES];
+    for (int value = CardRules::MIN_CARD_VALUE; value <= CardRules::MAX_CARD_VALUE; value++) {
+        counts[value - 1] = state.getValueCount(value);
+    }
+    
+    const CompactDeal* deal = state.getDeal();
+    uint8_t entry = _entries[indexOf(counts, state.getPlayfieldRemaining(), deal->getStackFaces().data(),
+                                     state.getStackRemaining(), state.getTrayValue())];
+    
+    probe.winnable = (entry >> 4) != 0;
+    probe.drawsToWin = probe.winnable ? (entry >> 4) - 1 : -1;
+    
+    uint8_t move = entry & 0x0F;
+    if (move == MOVE_NIBBLE_DRAW) {
+        probe.hasMove = true;
+        probe.bestMove = CompactGameState::MOVE_DRAW;
+    } else if (move != MOVE_NIBBLE_NONE) {
+        // 数值相同的卡牌可以互换，取任意一张还在主牌区的
+        const std::vector<uint8_t>& faces = deal->getPlayfieldFaces();
+        for (size_t i = 0; i < faces.size(); i++) {
+            if (faces[i] + 1 == move && state.isPlayfieldCardPresent(static_cast<int>(i))) {
+                probe.hasMove = true;
+                probe.bestMove = static_cast<int>(i);
+                break;
+            }
+        }
+    }
+    
+    return true;
+}
+
+bool EndgameTablebase::playOut(CompactGameState& state, std::vector<int32_t>& line) const
+{
+    EndgameProbe result;
+    while (!state.isGameWon()) {
+        if (!probe(state, result) || !result.winnable || !result.hasMove || !state.applyMove(result.bestMove)) {
+            return false;
+        }
+        line.push_back(result.bestMove);
+    }
+    return true;
+}
+
+uint64_t EndgameTablebase::countWinnable() const
+{
+    uint64_t count = 0;
+    for (uint64_t i = 0; i < _entryCount; i++) {
+        if ((_entries[i] >> 4) != 0) {
+            count++;
+        }
+    }
+    return count;
+}
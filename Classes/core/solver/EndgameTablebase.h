@@ -0,0 +1,158 @@
+/**
+ * EndgameTablebase.h
+ * 残局库：剩余卡牌不超过N张的所有局面的胜负与最佳操作
+ */
+
+#ifndef __ENDGAME_TABLEBASE_H__
+#define __ENDGAME_TABLEBASE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include "core/rules/CompactGameState.h"
+
+/**
+ * 残局库查询结果
+ */
+struct EndgameProbe
+{
+    bool winnable;      // 是否还能通关
+    bool hasMove;       // 是否有最佳操作（已通关或无解时没有）
+    int bestMove;       // 最佳操作（主牌区下标或MOVE_DRAW），沿最佳操作通关的抽牌次数最少
+    int drawsToWin;     // 通关还需的最少抽牌次数
+    
+    EndgameProbe()
+        : winnable(false)
+        , hasMove(false)
+        , bestMove(0)
+        , drawsToWin(-1)
+    {}
+};
+
+/**
+ * 残局库类
+ * 局面由主牌区数值直方图、备用牌堆剩余数值序列和手牌数值组成（与花色、位置无关），
+ * 剩余卡牌总数（主牌区 + 备用牌堆）不超过maxCards。每个操作使剩余卡牌减少1，
+ * 因此从0张开始逐层倒推即可得到所有局面的结论。每个局面1字节：
+ * 低4位为最佳操作（0抽牌，1-13打出该数值，15无），高4位为 最少抽牌次数+1（0表示无解）。
+ * 文件格式（小端）：
+ *   "CLTB" 版本(u16) 最大卡牌数(u16) 局面数(u64) 局面数据
+ * 在POSIX平台上文件以内存映射方式加载，多个进程共享同一份物理内存
+ */
+class EndgameTablebase
+{
+public:
+    static const char TABLEBASE_MAGIC[4];           // 文件标识
+    static const uint16_t TABLEBASE_VERSION = 1;    // 格式版本
+    static const int MAX_SUPPORTED_CARDS = 7;       // 支持的最大剩余卡牌数
+    
+    /**
+     * 构造函数
+     */
+    EndgameTablebase();
+    
+    /**
+     * 析构函数
+     */
+    ~EndgameTablebase();
+    
+    /**
+     * 在内存中构建残局库
+     * @param maxCards 最大剩余卡牌数（1-MAX_SUPPORTED_CARDS）
+     * @return 是否构建成功
+     */
+    bool build(int maxCards);
+    
+    /**
+     * 保存到文件
+     * @param filePath 文件路径
+     * @return 是否保存成功
+     */
+    bool saveToFile(const std::string& filePath) const;
+    
+    /**
+     * 从文件加载（POSIX平台为只读内存映射）
+     * @param filePath 文件路径
+     * @return 是否加载成功
+     */
+    bool loadFromFile(const std::string& filePath);
+    
+    /**
+     * 释放残局库
+     */
+    void unload();
+    
+    /**
+     * 查询局面
+     * @param state 对局状态
+     * @param probe 输出的查询结果
+     * @return 局面是否在残局库范围内
+     */
+    bool probe(const CompactGameState& state, EndgameProbe& probe) const;
+    
+    /**
+     * 沿最佳操作把对局走到通关
+     * @param state 对局状态，会被修改
+     * @param line 追加执行的操作
+     * @return 是否通关
+     */
+    bool playOut(CompactGameState& state, std::vector<int32_t>& line) const;
+    
+    /**
+     * 检查状态是否在残局库范围内
+     * @param state 对局状态
+     * @return 是否在范围内
+     */
+    bool covers(const CompactGameState& state) const
+    {
+        return _entries && state.getPlayfieldRemaining() + state.getStackRemaining() <= _maxCards;
+    }
+    
+    /**
+     * 获取最大剩余卡牌数
+     * @return 最大剩余卡牌数，未加载时为0
+     */
+    int getMaxCards() const { return _maxCards; }
+    
+    /**
+     * 获取局面数
+     * @return 局面数
+     */
+    uint64_t getEntryCount() const { return _entryCount; }
+    
+    /**
+     * 统计可通关的局面数
+     * @return 可通关的局面数
+     */
+    uint64_t countWinnable() const;
+    
+private:
+    const uint8_t* _entries;            // 局面数据（指向_buffer或映射内存）
+    std::vector<uint8_t> _buffer;       // 构建或读入的数据
+    void* _mapping;                     // 内存映射地址
+    size_t _mappingSize;                // 内存映射长度
+    uint64_t _entryCount;               // 局面数
+    int _maxCards;                      // 最大剩余卡牌数
+    uint64_t _blockOffsets[MAX_SUPPORTED_CARDS + 1][MAX_SUPPORTED_CARDS + 1];  // 各(主牌数, 牌堆数)分块的起点
+    
+    /**
+     * 按最大卡牌数计算分块起点
+     * @param maxCards 最大剩余卡牌数
+     * @return 局面总数
+     */
+    uint64_t layoutBlocks(int maxCards);
+    
+    /**
+     * 计算局面下标
+     * @param counts 主牌区各数值数量
+     * @param playfieldCount 主牌区卡牌数
+     * @param stackFaces 备用牌堆面值（0-12），最后一个最先抽出
+     * @param stackCount 备用牌堆卡牌数
+     * @param trayValue 手牌数值（1-13）
+     * @return 局面下标
+     */
+    uint64_t indexOf(const int* counts, int playfieldCount, const uint8_t* stackFaces, int stackCount, int trayValue) const;
+};
+
+#endif // __ENDGAME_TABLEBASE_H__
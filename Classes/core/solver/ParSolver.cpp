@@ -0,0 +1,244 @@
+/**
+ * ParSolver.cpp
+ * 标准杆求解器实现
+ */
+
+#include "ParSolver.h"
+#include "BeamSolver.h"
+
+// 与上限无关的死局在置换表中的深度
+static const int DEAD_STATE_DEPTH = 0xFFFF;
+
+/**
+ * 统计操作序列中的抽牌次数
+ */
+static int countDraws(const std::vector<int32_t>& line)
+{
+    int draws = 0;
+    for (auto move : line) {
+        if (move == CompactGameState::MOVE_DRAW) {
+            draws++;
+        }
+    }
+    return draws;
+}
+
+ParSolver::ParSolver()
+    : _tablebase(nullptr)
+    , _solveCount(0)
+    , _bound(0)
+    , _nextBound(0)
+    , _initialStack(0)
+    , _cutoff(false)
+    , _nodes(0)
+    , _nodeLimit(0)
+    , _aborted(false)
+{
+}
+
+bool ParSolver::init(int tableBits)
+{
+    return _table.init(tableBits);
+}
+
+bool ParSolver::solve(const CompactDeal& deal, ParResult& result, uint64_t nodeLimit)
+{
+    result = ParResult();
+    if (_table.getBucketCount() <= 1 || !_state.reset(&deal)) {
+        return false;
+    }
+    
+    // 束搜索给出上界，找不到时上界为备用牌堆能抽的全部次数
+    AnytimeSearchOptions beamOptions;
+    beamOptions.maxBeamWidth = 1024;
+    beamOptions.timeLimitSeconds = 0.0;
+    beamOptions.confidencePlayouts = 0;
+    AnytimeSearchResult beamResult;
+    if (BeamSolver::search(deal, beamOptions, beamResult) && beamResult.status == ASS_WON) {
+        result.incumbentDraws = countDraws(beamResult.line);
+    }
+    
+    _solveCount++;
+    uint64_t salt = _solveCount * 0xD1B54A32D192ED03ULL;
+    _keys.init(&deal, salt ^ (salt >> 31));
+    _table.newGeneration();
+    
+    _initialStack = _state.getStackRemaining();
+    _nodes = 0;
+    _nodeLimit = nodeLimit;
+    _aborted = false;
+    
+    int upperBound = result.incumbentDraws >= 0 ? result.incumbentDraws - 1 : _initialStack;
+    uint64_t rootKey = _keys.computeKey(_state);
+    _bound = estimateDraws(_state);
+    
+    bool found = false;
+    while (_bound <= upperBound) {
+        result.iterations++;
+        _nextBound = DEAD_STATE_DEPTH;
+        _cutoff = false;
+        _moves.clear();
+        _state.reset(&deal);
+        
+        found = search(rootKey);
+        if (found || _aborted || !_cutoff) {
+            break;
+        }
+        _bound = _nextBound;
+    }
+    result.nodes = _nodes;
+    
+    if (found) {
+        result.status = PS_OPTIMAL;
+        result.line.clear();
+        for (const auto& record : _state.getHistory()) {
+            result.line.push_back(record.move);
+        }
+        result.parDraws = countDraws(result.line);
+    } else if (_aborted) {
+        result.status = PS_NODE_LIMIT;
+    } else if (result.incumbentDraws >= 0) {
+        // 更小的上限都没有通关线，束搜索的线路就是最优的
+        result.status = PS_OPTIMAL;
+        result.line = beamResult.line;
+        result.parDraws = result.incumbentDraws;
+    } else {
+        result.status = PS_UNSOLVABLE;
+    }
+    
+    if (result.status == PS_OPTIMAL) {
+        result.parMoves = deal.getPlayfieldCount() + result.parDraws;
+    }
+    return true;
+}
+
+int ParSolver::estimateDraws(const CompactGameState& state)
+{
+    if (state.isGameWon()) {
+        return 0;
+    }
+    
+    int segments = 0;
+    int componentStarts = 0;
+    bool inComponent = false;
+    for (int value = CardRules::MIN_CARD_VALUE; value <= CardRules::MAX_CARD_VALUE + 1; value++) {
+        int count = value <= CardRules::MAX_CARD_VALUE ? state.getValueCount(value) : 0;
+        if (count == 0) {
+            if (inComponent) {
+                segments += componentStarts > 1 ? componentStarts : 1;
+                componentStarts = 0;
+                inComponent = false;
+            }
+            continue;
+        }
+        
+        inComponent = true;
+        int lower = value > CardRules::MIN_CARD_VALUE ? state.getValueCount(value - 1) : 0;
+        int upper = value < CardRules::MAX_CARD_VALUE ? state.getValueCount(value + 1) : 0;
+        if (count > lower + upper) {
+            componentStarts += count - lower - upper;
+        }
+    }
+    
+    return state.hasPlayableCard() ? segments - 1 : segments;
+}
+
+bool ParSolver::search(uint64_t key)
+{
+    if (++_nodes > _nodeLimit && _nodeLimit > 0) {
+        _aborted = true;
+        return false;
+    }
+    
+    if (_state.isGameWon()) {
+        return true;
+    }
+    
+    int draws = _initialStack - _state.getStackRemaining();
+    
+    // 残局库给出精确的剩余抽牌数，能在上限内通关时沿最佳操作走完
+    EndgameProbe probe;
+    if (_tablebase && _tablebase->probe(_state, probe)) {
+        if (!probe.winnable) {
+            return false;
+        }
+        if (draws + probe.drawsToWin > _bound) {
+            _cutoff = true;
+            if (draws + probe.drawsToWin < _nextBound) {
+                _nextBound = draws + probe.drawsToWin;
+            }
+            return false;
+        }
+        std::vector<int32_t> tail;
+        return _tablebase->playOut(_state, tail);
+    }
+    
+    int estimate = estimateDraws(_state);
+    
+    // 剩余的牌不够抽：与上限无关的死局
+    if (estimate > _state.getStackRemaining()) {
+        return false;
+    }
+    
+    if (draws + estimate > _bound) {
+        _cutoff = true;
+        if (draws + estimate < _nextBound) {
+            _nextBound = draws + estimate;
+        }
+        return false;
+    }
+    
+    int failedBound = 0;
+    if (_table.probe(key, &failedBound) == TTR_LOSS && failedBound >= _bound) {
+        // 更新到已记录的失败上限之外的剪枝信息
+        if (failedBound != DEAD_STATE_DEPTH) {
+            _cutoff = true;
+            if (failedBound + 1 < _nextBound) {
+                _nextBound = failedBound + 1;
+            }
+        }
+        return false;
+    }
+    
+    // 生成操作：每个可出的数值取一张，出牌先于抽牌
+    size_t begin = _moves.size();
+    const std::vector<uint8_t>& faces = _state.getDeal()->getPlayfieldFaces();
+    uint32_t pendingValues = _state.getPlayableValueMask();
+    for (size_t i = 0; i < faces.size() && pendingValues != 0; i++) {
+        uint32_t bit = 1u << faces[i];
+        if ((pendingValues & bit) && _state.isPlayfieldCardPresent(static_cast<int>(i))) {
+            _moves.push_back(static_cast<int>(i));
+            pendingValues &= ~bit;
+        }
+    }
+    if (_state.canDrawCardFromStack()) {
+        _moves.push_back(CompactGameState::MOVE_DRAW);
+    }
+    size_t end = _moves.size();
+    
+    bool parentCutoff = _cutoff;
+    _cutoff = false;
+    for (size_t i = begin; i < end; i++) {
+        int move = _moves[i];
+        int prevTrayValue = _state.getTrayValue();
+        _state.applyMove(move);
+        
+        if (search(_keys.updateKey(key, move, prevTrayValue, _state))) {
+            _moves.resize(begin);
+            return true;
+        }
+        _state.undo();
+        
+        if (_aborted) {
+            break;
+        }
+    }
+    _moves.resize(begin);
+    
+    if (!_aborted) {
+        // 子树没有被上限剪枝时，结论对任何上限都成立
+        _table.store(key, TTR_LOSS, _cutoff ? _bound : DEAD_STATE_DEPTH);
+    }
+    _cutoff = _cutoff || parentCutoff;
+    return false;
+}
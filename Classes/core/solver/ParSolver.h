@@ -0,0 +1,119 @@
+/**
+ * ParSolver.h
+ * 最优标准杆求解器：用IDA*计算通关所需的最少抽牌次数
+ */
+
+#ifndef __PAR_SOLVER_H__
+#define __PAR_SOLVER_H__
+
+#include <stdint.h>
+#include <vector>
+#include "TranspositionTable.h"
+#include "SolverKeys.h"
+#include "EndgameTablebase.h"
+
+/**
+ * 标准杆求解结论
+ */
+enum ParStatus
+{
+    PS_OPTIMAL = 0,     // 得到最优标准杆
+    PS_UNSOLVABLE,      // 关卡无解
+    PS_NODE_LIMIT       // 达到节点上限，结论未知
+};
+
+/**
+ * 标准杆求解结果
+ */
+struct ParResult
+{
+    int status;                     // 结论（ParStatus）
+    int parDraws;                   // 最少抽牌次数（不含开局翻出的手牌）
+    int parMoves;                   // 最少操作数（主牌区卡牌数 + 最少抽牌次数）
+    std::vector<int32_t> line;      // 达到标准杆的操作序列
+    int incumbentDraws;             // 束搜索给出的上界，-1表示束搜索未通关
+    int iterations;                 // IDA*迭代次数
+    uint64_t nodes;                 // 搜索的节点数
+    
+    ParResult()
+        : status(PS_NODE_LIMIT)
+        , parDraws(-1)
+        , parMoves(-1)
+        , incumbentDraws(-1)
+        , iterations(0)
+        , nodes(0)
+    {}
+};
+
+/**
+ * 标准杆求解器类
+ * 出牌代价为0，抽牌代价为1，最少抽牌次数即最少操作数减去主牌区卡牌数。
+ * 先用束搜索得到一条通关线作为上界，再以下界为起点逐步放宽上限做IDA*，
+ * 估价超过上限或不可能优于上界的状态直接剪枝。置换表记录状态在多大的上限下失败，
+ * 与上限无关的死局记录为最大深度，后续迭代直接跳过
+ */
+class ParSolver
+{
+public:
+    /**
+     * 构造函数
+     */
+    ParSolver();
+    
+    /**
+     * 分配置换表
+     * @param tableBits 置换表桶数量的二进制位数
+     * @return 是否分配成功
+     */
+    bool init(int tableBits);
+    
+    /**
+     * 设置残局库，剩余卡牌在残局库范围内时以查表得到的精确抽牌数代替估价
+     * @param tablebase 残局库，可为nullptr，需在求解期间保持有效
+     */
+    void setTablebase(const EndgameTablebase* tablebase) { _tablebase = tablebase; }
+    
+    /**
+     * 计算牌局的标准杆
+     * @param deal 牌局定义
+     * @param result 输出的结果
+     * @param nodeLimit 节点上限，为0表示不限
+     * @return 是否执行了求解
+     */
+    bool solve(const CompactDeal& deal, ParResult& result, uint64_t nodeLimit = 0);
+    
+    /**
+     * 估计通关还需的最少抽牌次数（可采纳下界）
+     * 一段连续出牌每步数值相差1，不能跨过主牌区已没有的数值，因此只能留在一个数值连续段内；
+     * 段内某数值的卡牌除了每段出牌的第一张，都要紧跟在相邻数值之后打出，
+     * 所以从数值v开始的出牌段至少有 c[v] - c[v-1] - c[v+1] 段，每个连续段至少一段。
+     * 当前可以直接出牌时第一段不需要抽牌
+     * @param state 对局状态
+     * @return 最少抽牌次数
+     */
+    static int estimateDraws(const CompactGameState& state);
+    
+private:
+    TranspositionTable _table;      // 置换表（深度记录失败时的上限）
+    SolverKeys _keys;               // 状态键
+    const EndgameTablebase* _tablebase;     // 残局库
+    CompactGameState _state;        // 搜索状态
+    std::vector<int32_t> _moves;    // 各层待搜索操作
+    uint64_t _solveCount;           // 已执行的求解次数，用于生成盐值
+    int _bound;                     // 当前迭代的抽牌上限
+    int _nextBound;                 // 超过上限的最小估价，作为下一次迭代的上限
+    int _initialStack;              // 开局后备用牌堆剩余数
+    bool _cutoff;                   // 当前子树是否因上限被剪枝
+    uint64_t _nodes;                // 节点数
+    uint64_t _nodeLimit;            // 节点上限
+    bool _aborted;                  // 是否因节点上限中止
+    
+    /**
+     * 在当前上限下深度优先搜索
+     * @param key 当前状态键
+     * @return 是否找到通关线
+     */
+    bool search(uint64_t key);
+};
+
+#endif // __PAR_SOLVER_H__
@@ -0,0 +1,400 @@
+/**
+ * ParallelSolver.cpp
+ * 并行求解器实现
+ */
+
+#include "ParallelSolver.h"
+
+// 只在距任务根较近的层拆分，保证任务足够大
+static const int SPLIT_MAX_TASK_DEPTH = 6;
+// 剩余卡牌数少于此值的子树直接在本线程搜索
+static const int SPLIT_MIN_REMAINING = 10;
+// 节点数按此粒度汇总到全局计数
+static const uint64_t NODE_FLUSH_INTERVAL = 1024;
+// 空闲线程先让出这么多次再等待条件变量，新任务常在很短时间内拆出
+static const int IDLE_SPIN_COUNT = 64;
+
+ParallelSolver::ParallelSolver()
+    : _tablebase(nullptr)
+    , _solveCount(0)
+    , _generation(0)
+    , _busyWorkers(0)
+    , _running(false)
+    , _deal(nullptr)
+    , _nodeLimit(0)
+    , _pendingTasks(0)
+    , _idleWorkers(0)
+    , _totalNodes(0)
+    , _stopSearch(false)
+    , _wakeSequence(0)
+    , _solved(false)
+{
+}
+
+ParallelSolver::~ParallelSolver()
+{
+    stop();
+}
+
+bool ParallelSolver::start(int threadCount, int tableBits)
+{
+    if (_running || !_table.init(tableBits)) {
+        return false;
+    }
+    
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) {
+            threadCount = 1;
+        }
+    }
+    
+    _running = true;
+    for (int i = 0; i < threadCount; i++) {
+        _workerStates.push_back(new SolverWorker());
+    }
+    // 调用线程使用下标0的上下文
+    for (int i = 1; i < threadCount; i++) {
+        _threads.push_back(std::thread(&ParallelSolver::workerLoop, this, i));
+    }
+    
+    return true;
+}
+
+void ParallelSolver::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running) {
+            return;
+        }
+        _running = false;
+    }
+    _startCond.notify_all();
+    
+    for (auto& thread : _threads) {
+        thread.join();
+    }
+    _threads.clear();
+    
+    for (auto worker : _workerStates) {
+        delete worker;
+    }
+    _workerStates.clear();
+}
+
+bool ParallelSolver::solve(const CompactDeal* deal, SolveResult& result, uint64_t nodeLimit)
+{
+    result = SolveResult();
+    if (!_running || !deal) {
+        return false;
+    }
+    
+    _solveCount++;
+    uint64_t salt = _solveCount * 0x9E3779B97F4A7C15ULL;
+    _keys.init(deal, salt ^ (salt >> 29));
+    _table.newGeneration();
+    
+    for (auto worker : _workerStates) {
+        worker->nodes = 0;
+        worker->tableProbes = 0;
+        worker->tableHits = 0;
+        worker->splits = 0;
+        worker->steals = 0;
+    }
+    
+    _deal = deal;
+    _nodeLimit = nodeLimit;
+    _totalNodes.store(0, std::memory_order_relaxed);
+    _stopSearch.store(false, std::memory_order_relaxed);
+    _idleWorkers.store(0, std::memory_order_relaxed);
+    _solved = false;
+    _solution.clear();
+    
+    // 根任务：空前缀
+    _workerStates[0]->tasks.push_back(SolverTask());
+    _pendingTasks.store(1, std::memory_order_relaxed);
+    
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _busyWorkers = static_cast<int>(_threads.size());
+        _generation++;
+    }
+    _startCond.notify_all();
+    
+    runSolve(0);
+    
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_busyWorkers > 0) {
+        _doneCond.wait(lock);
+    }
+    
+    // 提前结束时队列中可能还有未执行的任务
+    for (auto worker : _workerStates) {
+        worker->tasks.clear();
+        result.nodes += worker->nodes;
+        result.tableProbes += worker->tableProbes;
+        result.tableHits += worker->tableHits;
+        result.splits += worker->splits;
+        result.steals += worker->steals;
+    }
+    
+    if (_solved) {
+        result.status = SS_SOLVED;
+        result.solution = _solution;
+    } else {
+        // 未找到解法时只有节点上限会提前停止搜索
+        result.status = _stopSearch.load(std::memory_order_relaxed) ? SS_NODE_LIMIT : SS_UNSOLVABLE;
+    }
+    _deal = nullptr;
+    
+    return true;
+}
+
+void ParallelSolver::workerLoop(int index)
+{
+    uint64_t seenGeneration = 0;
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (_running && _generation == seenGeneration) {
+                _startCond.wait(lock);
+            }
+            if (!_running) {
+                return;
+            }
+            seenGeneration = _generation;
+        }
+        
+        runSolve(index);
+        
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_busyWorkers == 0) {
+            _doneCond.notify_one();
+        }
+    }
+}
+
+void ParallelSolver::runSolve(int index)
+{
+    SolverWorker& worker = *_workerStates[index];
+    SolverTask task;
+    int idleSpins = 0;
+    
+    while (!_stopSearch.load(std::memory_order_relaxed)
+           && _pendingTasks.load(std::memory_order_acquire) > 0) {
+        // 在查找任务之前读取序号，查找失败后若序号未变，说明期间没有新任务入队
+        uint64_t sequence = _wakeSequence.load(std::memory_order_acquire);
+        if (popTask(worker, task) || stealTask(index, task)) {
+            if (worker.idle) {
+                worker.idle = false;
+                _idleWorkers.fetch_sub(1, std::memory_order_relaxed);
+            }
+            idleSpins = 0;
+            runTask(worker, task);
+            if (_pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                wakeIdleWorkers();
+            }
+            continue;
+        }
+        
+        if (!worker.idle) {
+            worker.idle = true;
+            _idleWorkers.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (++idleSpins < IDLE_SPIN_COUNT) {
+            std::this_thread::yield();
+            continue;
+        }
+        
+        // 收尾阶段或分支很窄时不再空转占满核心
+        std::unique_lock<std::mutex> lock(_idleMutex);
+        while (_wakeSequence.load(std::memory_order_relaxed) == sequence
+               && !_stopSearch.load(std::memory_order_relaxed)
+               && _pendingTasks.load(std::memory_order_acquire) > 0) {
+            _idleCond.wait(lock);
+        }
+        idleSpins = 0;
+    }
+    
+    if (worker.idle) {
+        worker.idle = false;
+        _idleWorkers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool ParallelSolver::popTask(SolverWorker& worker, SolverTask& task)
+{
+    std::lock_guard<std::mutex> lock(worker.taskMutex);
+    if (worker.tasks.empty()) {
+        return false;
+    }
+    
+    task.prefix.swap(worker.tasks.back().prefix);
+    worker.tasks.pop_back();
+    return true;
+}
+
+bool ParallelSolver::stealTask(int index, SolverTask& task)
+{
+    int count = static_cast<int>(_workerStates.size());
+    for (int offset = 1; offset < count; offset++) {
+        SolverWorker& victim = *_workerStates[(index + offset) % count];
+        std::lock_guard<std::mutex> lock(victim.taskMutex);
+        if (victim.tasks.empty()) {
+            continue;
+        }
+        
+        // 队列头部的任务离根最近，子树最大
+        task.prefix.swap(victim.tasks.front().prefix);
+        victim.tasks.pop_front();
+        _workerStates[index]->steals++;
+        return true;
+    }
+    
+    return false;
+}
+
+void ParallelSolver::runTask(SolverWorker& worker, const SolverTask& task)
+{
+    worker.state.reset(_deal);
+    worker.path.clear();
+    worker.moves.clear();
+    
+    for (auto move : task.prefix) {
+        worker.state.applyMove(move);
+        worker.path.push_back(move);
+    }
+    
+    bool complete = false;
+    search(worker, _keys.computeKey(worker.state), 0, complete);
+}
+
+bool ParallelSolver::search(SolverWorker& worker, uint64_t key, int taskDepth, bool& complete)
+{
+    complete = false;
+    if (_stopSearch.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    
+    CompactGameState& state = worker.state;
+    if (++worker.nodes % NODE_FLUSH_INTERVAL == 0) {
+        uint64_t total = _totalNodes.fetch_add(NODE_FLUSH_INTERVAL, std::memory_order_relaxed) + NODE_FLUSH_INTERVAL;
+        if (_nodeLimit > 0 && total >= _nodeLimit) {
+            _stopSearch.store(true, std::memory_order_relaxed);
+            wakeIdleWorkers();
+            return false;
+        }
+    }
+    
+    complete = true;
+    if (state.isGameWon()) {
+        publishSolution(worker);
+        return true;
+    }
+    
+    if (_tablebase && _tablebase->covers(state)) {
+        EndgameProbe probe;
+        if (_tablebase->probe(state, probe) && probe.winnable && _tablebase->playOut(state, worker.path)) {
+            publishSolution(worker);
+            return true;
+        }
+        return false;
+    }
+    
+    worker.tableProbes++;
+    if (_table.probe(key) == TTR_LOSS) {
+        worker.tableHits++;
+        return false;
+    }
+    
+    // 生成操作：先出牌后抽牌。数值相同的卡牌打出后得到同一个规范状态，每个数值只取一张
+    size_t begin = worker.moves.size();
+    const std::vector<uint8_t>& faces = _deal->getPlayfieldFaces();
+    uint32_t pendingValues = state.getPlayableValueMask();
+    for (size_t i = 0; i < faces.size() && pendingValues != 0; i++) {
+        uint32_t bit = 1u << faces[i];
+        if ((pendingValues & bit) && state.isPlayfieldCardPresent(static_cast<int>(i))) {
+            worker.moves.push_back(static_cast<int>(i));
+            pendingValues &= ~bit;
+        }
+    }
+    if (state.canDrawCardFromStack()) {
+        worker.moves.push_back(CompactGameState::MOVE_DRAW);
+    }
+    
+    size_t end = worker.moves.size();
+    int depth = state.getPlayfieldRemaining() + state.getStackRemaining();
+    if (end - begin > 1 && taskDepth < SPLIT_MAX_TASK_DEPTH && depth >= SPLIT_MIN_REMAINING
+        && _idleWorkers.load(std::memory_order_relaxed) > 0) {
+        splitTasks(worker, begin + 1, end);
+        complete = false;
+        end = begin + 1;
+    }
+    
+    for (size_t i = begin; i < end; i++) {
+        int move = worker.moves[i];
+        int prevTrayValue = state.getTrayValue();
+        state.applyMove(move);
+        worker.path.push_back(move);
+        
+        bool childComplete = false;
+        if (search(worker, _keys.updateKey(key, move, prevTrayValue, state), taskDepth + 1, childComplete)) {
+            worker.moves.resize(begin);
+            return true;
+        }
+        complete = complete && childComplete;
+        
+        state.undo();
+        worker.path.pop_back();
+    }
+    worker.moves.resize(begin);
+    
+    // 本节点或子树中拆出的分支由其他任务负责，结论不完整，祖先同样不能记为无解
+    complete = complete && !_stopSearch.load(std::memory_order_relaxed);
+    if (complete) {
+        _table.store(key, TTR_LOSS, depth);
+    }
+    return false;
+}
+
+void ParallelSolver::splitTasks(SolverWorker& worker, size_t begin, size_t end)
+{
+    // 先增加计数再入队，保证计数不会在子任务入队前归零
+    _pendingTasks.fetch_add(static_cast<int64_t>(end - begin), std::memory_order_acq_rel);
+    
+    {
+        std::lock_guard<std::mutex> lock(worker.taskMutex);
+        for (size_t i = begin; i < end; i++) {
+            worker.tasks.push_back(SolverTask());
+            worker.tasks.back().prefix = worker.path;
+            worker.tasks.back().prefix.push_back(worker.moves[i]);
+        }
+    }
+    worker.splits += end - begin;
+    
+    // 只有存在空闲线程时才会拆分，它们可能已经在等待
+    wakeIdleWorkers();
+}
+
+void ParallelSolver::wakeIdleWorkers()
+{
+    // 在锁内递增，等待方检查序号与进入等待之间不会漏掉通知
+    {
+        std::lock_guard<std::mutex> lock(_idleMutex);
+        _wakeSequence.fetch_add(1, std::memory_order_release);
+    }
+    _idleCond.notify_all();
+}
+
+void ParallelSolver::publishSolution(const SolverWorker& worker)
+{
+    std::lock_guard<std::mutex> lock(_solutionMutex);
+    if (!_solved) {
+        _solved = true;
+        _solution = worker.path;
+    }
+    _stopSearch.store(true, std::memory_order_relaxed);
+    wakeIdleWorkers();
+}
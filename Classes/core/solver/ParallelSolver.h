@@ -0,0 +1,240 @@
+/**
+ * ParallelSolver.h
+ * 多线程穷举求解器，工作窃取线程池共享一张无锁置换表
+ */
+
+#ifndef __PARALLEL_SOLVER_H__
+#define __PARALLEL_SOLVER_H__
+
+#include <stdint.h>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include "TranspositionTable.h"
+#include "SolverKeys.h"
+#include "EndgameTablebase.h"
+
+/**
+ * 求解结论
+ */
+enum SolveStatus
+{
+    SS_SOLVED = 0,      // 找到通关解法
+    SS_UNSOLVABLE,      // 穷举后确认无解
+    SS_NODE_LIMIT       // 达到节点上限，结论未知
+};
+
+/**
+ * 求解结果与统计
+ */
+struct SolveResult
+{
+    int status;                     // 求解结论（SolveStatus）
+    std::vector<int32_t> solution;  // 通关操作序列（主牌区下标或MOVE_DRAW）
+    uint64_t nodes;                 // 搜索的节点数
+    uint64_t tableProbes;           // 置换表查询次数
+    uint64_t tableHits;             // 置换表命中次数
+    uint64_t splits;                // 拆分出的任务数
+    uint64_t steals;                // 被其他线程窃取的任务数
+    
+    SolveResult()
+        : status(SS_NODE_LIMIT)
+        , nodes(0)
+        , tableProbes(0)
+        , tableHits(0)
+        , splits(0)
+        , steals(0)
+    {}
+};
+
+/**
+ * 搜索任务：从初始状态出发的操作前缀
+ */
+struct SolverTask
+{
+    std::vector<int32_t> prefix;    // 操作前缀
+};
+
+/**
+ * 单个线程的搜索上下文
+ */
+struct SolverWorker
+{
+    CompactGameState state;         // 搜索状态
+    std::vector<int32_t> path;      // 从初始状态到当前节点的操作
+    std::vector<int32_t> moves;     // 各层待搜索操作（按层连续存放）
+    std::mutex taskMutex;           // 任务队列锁
+    std::deque<SolverTask> tasks;   // 任务队列，自己从尾部取，其他线程从头部窃取
+    bool idle;                      // 是否已计入空闲线程数
+    uint64_t nodes;                 // 节点数
+    uint64_t tableProbes;           // 置换表查询次数
+    uint64_t tableHits;             // 置换表命中次数
+    uint64_t splits;                // 拆分出的任务数
+    uint64_t steals;                // 窃取到的任务数
+    
+    SolverWorker()
+        : idle(false)
+        , nodes(0)
+        , tableProbes(0)
+        , tableHits(0)
+        , splits(0)
+        , steals(0)
+    {}
+};
+
+/**
+ * 并行求解器类
+ * 调用线程与工作线程一起深度优先搜索；有线程空闲时，忙碌线程在靠近任务根的节点把
+ * 其余分支拆成任务放入自己的队列，空闲线程从其他队列头部窃取，短暂重试后在条件变量上等待新任务。
+ * 完整搜索过的无解状态按剩余卡牌数作为深度写入共享置换表（拆出过分支的节点及其祖先不写）。
+ * 状态按规范形式去重，数值相同的卡牌每层只尝试一张
+ */
+class ParallelSolver
+{
+public:
+    /**
+     * 构造函数
+     */
+    ParallelSolver();
+    
+    /**
+     * 析构函数
+     */
+    ~ParallelSolver();
+    
+    /**
+     * 分配置换表并启动工作线程
+     * @param threadCount 线程数（包含调用线程），为0时使用CPU核心数
+     * @param tableBits 置换表桶数量的二进制位数
+     * @return 是否启动成功
+     */
+    bool start(int threadCount, int tableBits);
+    
+    /**
+     * 停止工作线程
+     */
+    void stop();
+    
+    /**
+     * 求解牌局，阻塞直到得出结论或达到节点上限
+     * @param deal 牌局定义
+     * @param result 输出的结果
+     * @param nodeLimit 节点上限，为0表示不限
+     * @return 是否执行了求解
+     */
+    bool solve(const CompactDeal* deal, SolveResult& result, uint64_t nodeLimit = 0);
+    
+    /**
+     * 设置残局库，剩余卡牌在残局库范围内时直接查表，不再搜索
+     * @param tablebase 残局库，可为nullptr，需在求解期间保持有效
+     */
+    void setTablebase(const EndgameTablebase* tablebase) { _tablebase = tablebase; }
+    
+    /**
+     * 清空置换表，用于基准测试之间的隔离
+     */
+    void clearTable() { _table.clear(); }
+    
+    /**
+     * 获取线程数（包含调用线程）
+     * @return 线程数
+     */
+    int getThreadCount() const { return static_cast<int>(_workerStates.size()); }
+    
+private:
+    std::vector<std::thread> _threads;          // 工作线程
+    std::vector<SolverWorker*> _workerStates;   // 各线程的搜索上下文（0为调用线程）
+    TranspositionTable _table;                  // 共享置换表
+    SolverKeys _keys;                           // 当前牌局的状态键
+    const EndgameTablebase* _tablebase;         // 残局库
+    uint64_t _solveCount;                       // 已执行的求解次数，用于生成盐值
+    
+    std::mutex _mutex;                      // 求解同步锁
+    std::condition_variable _startCond;     // 求解开始通知
+    std::condition_variable _doneCond;      // 求解完成通知
+    uint64_t _generation;                   // 求解序号
+    int _busyWorkers;                       // 尚未退出当前求解的工作线程数
+    bool _running;                          // 是否运行中
+    
+    const CompactDeal* _deal;               // 当前牌局
+    uint64_t _nodeLimit;                    // 节点上限
+    std::atomic<int64_t> _pendingTasks;     // 已创建但未完成的任务数
+    std::atomic<int> _idleWorkers;          // 空闲线程数
+    std::atomic<uint64_t> _totalNodes;      // 已汇总的节点数
+    std::atomic<bool> _stopSearch;          // 是否停止搜索
+    std::mutex _idleMutex;                  // 空闲线程等待锁
+    std::condition_variable _idleCond;      // 新任务、求解结束或停止搜索的通知
+    std::atomic<uint64_t> _wakeSequence;    // 通知序号，在_idleMutex下递增
+    std::mutex _solutionMutex;              // 解法写入锁
+    bool _solved;                           // 是否找到解法
+    std::vector<int32_t> _solution;         // 找到的解法
+    
+    /**
+     * 工作线程主循环
+     * @param index 线程下标
+     */
+    void workerLoop(int index);
+    
+    /**
+     * 领取并执行任务直到求解结束
+     * @param index 线程下标
+     */
+    void runSolve(int index);
+    
+    /**
+     * 从自己的队列尾部取任务
+     * @param worker 搜索上下文
+     * @param task 输出的任务
+     * @return 是否取到任务
+     */
+    bool popTask(SolverWorker& worker, SolverTask& task);
+    
+    /**
+     * 从其他线程的队列头部窃取任务
+     * @param index 线程下标
+     * @param task 输出的任务
+     * @return 是否窃取到任务
+     */
+    bool stealTask(int index, SolverTask& task);
+    
+    /**
+     * 执行任务：重放前缀后深度优先搜索
+     * @param worker 搜索上下文
+     * @param task 任务
+     */
+    void runTask(SolverWorker& worker, const SolverTask& task);
+    
+    /**
+     * 深度优先搜索当前状态
+     * @param worker 搜索上下文
+     * @param key 当前状态键
+     * @param taskDepth 距任务根的层数
+     * @param complete 输出子树是否被完整搜索（没有拆出分支且没有提前停止），不完整时结论不能写入置换表
+     * @return 是否找到解法
+     */
+    bool search(SolverWorker& worker, uint64_t key, int taskDepth, bool& complete);
+    
+    /**
+     * 把当前节点的部分分支拆成任务
+     * @param worker 搜索上下文
+     * @param begin 第一个拆出的操作在moves中的位置
+     * @param end 最后一个拆出的操作之后的位置
+     */
+    void splitTasks(SolverWorker& worker, size_t begin, size_t end);
+    
+    /**
+     * 唤醒在条件变量上等待的空闲线程
+     */
+    void wakeIdleWorkers();
+    
+    /**
+     * 记录解法并通知所有线程停止
+     * @param worker 找到解法的搜索上下文
+     */
+    void publishSolution(const SolverWorker& worker);
+};
+
+#endif // __PARALLEL_SOLVER_H__
@@ -0,0 +1,108 @@
+/**
+ * RuleSolver.cpp
+ * 规则求解器实现
+ */
+
+#include "RuleSolver.h"
+
+template <typename Rule>
+RuleSolver<Rule>::RuleSolver()
+    : _solveCount(0)
+    , _nodes(0)
+    , _nodeLimit(0)
+    , _stopped(false)
+{
+}
+
+template <typename Rule>
+bool RuleSolver<Rule>::init(int tableBits)
+{
+    return _table.init(tableBits);
+}
+
+template <typename Rule>
+bool RuleSolver<Rule>::solve(const CompactDeal* deal, SolveResult& result, uint64_t nodeLimit)
+{
+    result = SolveResult();
+    if (!deal || !_state.reset(deal)) {
+        return false;
+    }
+    
+    _solveCount++;
+    uint64_t salt = _solveCount * 0x9E3779B97F4A7C15ULL;
+    _keys.init(deal, salt ^ (salt >> 29));
+    _table.newGeneration();
+    
+    _path.clear();
+    _moves.clear();
+    _nodes = 0;
+    _nodeLimit = nodeLimit;
+    _stopped = false;
+    
+    if (search(_keys.computeKey(_state))) {
+        result.status = SS_SOLVED;
+        result.solution = _path;
+    } else {
+        result.status = _stopped ? SS_NODE_LIMIT : SS_UNSOLVABLE;
+    }
+    result.nodes = _nodes;
+    
+    return true;
+}
+
+template <typename Rule>
+bool RuleSolver<Rule>::search(uint64_t key)
+{
+    if (++_nodes >= _nodeLimit && _nodeLimit > 0) {
+        _stopped = true;
+        return false;
+    }
+    
+    if (_state.isGameWon()) {
+        return true;
+    }
+    if (_table.probe(key) == TTR_LOSS) {
+        return false;
+    }
+    
+    // 先出牌后抽牌，数值相同的卡牌打出后得到同一个规范状态，每个数值只取一张
+    size_t begin = _moves.size();
+    const std::vector<uint8_t>& faces = _state.getDeal()->getPlayfieldFaces();
+    uint32_t pendingValues = _state.getPlayableValueMask();
+    for (size_t i = 0; i < faces.size() && pendingValues != 0; i++) {
+        uint32_t bit = 1u << faces[i];
+        if ((pendingValues & bit) && _state.isPlayfieldCardPresent(static_cast<int>(i))) {
+            _moves.push_back(static_cast<int>(i));
+            pendingValues &= ~bit;
+        }
+    }
+    if (_state.canDrawCardFromStack()) {
+        _moves.push_back(State::MOVE_DRAW);
+    }
+    
+    size_t end = _moves.size();
+    for (size_t i = begin; i < end; i++) {
+        int move = _moves[i];
+        int prevTrayValue = _state.getTrayValue();
+        _state.applyMove(move);
+        _path.push_back(move);
+        
+        if (search(_keys.updateKey(key, move, prevTrayValue, _state))) {
+            _moves.resize(begin);
+            return true;
+        }
+        
+        _state.undo();
+        _path.pop_back();
+        if (_stopped) {
+            _moves.resize(begin);
+            return false;
+        }
+    }
+    _moves.resize(begin);
+    
+    _table.store(key, TTR_LOSS, _state.getPlayfieldRemaining() + _state.getStackRemaining());
+    return false;
+}
+
+CARD_RULES_INSTANTIATE(RuleSolver)
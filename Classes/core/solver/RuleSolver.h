@@ -0,0 +1,64 @@
+/**
+ * RuleSolver.h
+ * 按规则策略实例化的单线程穷举求解器
+ */
+
+#ifndef __RULE_SOLVER_H__
+#define __RULE_SOLVER_H__
+
+#include <stdint.h>
+#include <vector>
+#include "core/rules/CompactGameState.h"
+#include "TranspositionTable.h"
+#include "SolverKeys.h"
+#include "ParallelSolver.h"
+
+/**
+ * 规则求解器
+ * 与ParallelSolver相同的深度优先穷举（每个数值只展开一张卡牌、置换表记录无解局面），
+ * 匹配规则是模板参数，用于评估规则变体下关卡的可解性。残局库按默认规则构建，这里不使用
+ */
+template <typename Rule>
+class RuleSolver
+{
+public:
+    typedef BasicCompactGameState<Rule> State;
+    
+    RuleSolver();
+    
+    /**
+     * 分配置换表
+     * @param tableBits 置换表桶数的位数
+     * @return 是否成功
+     */
+    bool init(int tableBits);
+    
+    /**
+     * 求解牌局
+     * @param deal 牌局定义
+     * @param result 输出结果（status为SolveStatus，只统计nodes）
+     * @param nodeLimit 节点上限，0表示不限
+     * @return 是否执行了求解
+     */
+    bool solve(const CompactDeal* deal, SolveResult& result, uint64_t nodeLimit);
+    
+private:
+    TranspositionTable _table;      // 无解局面置换表
+    SolverKeys _keys;               // 状态键
+    State _state;                   // 搜索状态
+    std::vector<int32_t> _path;     // 当前操作序列
+    std::vector<int32_t> _moves;    // 各层待搜索操作（按层连续存放）
+    uint64_t _solveCount;           // 已求解次数，用于生成盐值
+    uint64_t _nodes;                // 本次求解的节点数
+    uint64_t _nodeLimit;            // 节点上限
+    bool _stopped;                  // 是否达到节点上限
+    
+    /**
+     * 递归搜索
+     * @param key 当前局面的状态键
+     * @return 是否找到通关序列
+     */
+    bool search(uint64_t key);
+};
+
+#endif // __RULE_SOLVER_H__
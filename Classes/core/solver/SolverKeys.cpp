@@ -0,0 +1,50 @@
+/**
+ * SolverKeys.cpp
+ * 求解器状态键实现
+ */
+
+#include "SolverKeys.h"
+
+/**
+ * splitmix64，生成与平台无关的固定键序列
+ */
+static uint64_t nextKey(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void SolverKeys::init(const CompactDeal* deal, uint64_t salt)
+{
+    uint64_t seed = 0x5EED5EED5EED5EEDULL;
+    
+    int maxCount = 0;
+    int counts[CardRules::NUM_CARD_VALUES] = { 0 };
+    for (auto face : deal->getPlayfieldFaces()) {
+        counts[face]++;
+        maxCount = counts[face] > maxCount ? counts[face] : maxCount;
+    }
+    
+    _countStride = maxCount + 1;
+    _countKeys.resize(CardRules::NUM_CARD_VALUES * _countStride);
+    for (int value = 0; value < CardRules::NUM_CARD_VALUES; value++) {
+        // 数量为0的键取0，空主牌区只由其他分量决定
+        _countKeys[value * _countStride] = 0;
+        for (int count = 1; count < _countStride; count++) {
+            _countKeys[value * _countStride + count] = nextKey(seed);
+        }
+    }
+    
+    _stackKeys.resize(deal->getStackCount() + 1);
+    for (auto& key : _stackKeys) {
+        key = nextKey(seed);
+    }
+    
+    for (int value = 0; value <= CardRules::MAX_CARD_VALUE; value++) {
+        _trayKeys[value] = nextKey(seed);
+    }
+    
+    _salt = salt;
+}
@@ -0,0 +1,82 @@
+/**
+ * SolverKeys.h
+ * 求解器使用的Zobrist状态键
+ */
+
+#ifndef __SOLVER_KEYS_H__
+#define __SOLVER_KEYS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "core/rules/CompactGameState.h"
+
+/**
+ * 状态键类
+ * 状态键按规范形式计算（见CanonicalForm）：主牌区各数值剩余数量的键 ^ 备用牌堆剩余数键 ^
+ * 手牌数值键 ^ 盐值，数值相同的卡牌互换得到同一个键。每次出牌或抽牌只需异或少量键即可增量更新。
+ * 盐值区分不同的求解，使置换表不必在两次求解之间清空
+ */
+class SolverKeys
+{
+public:
+    /**
+     * 按牌局规模生成键
+     * @param deal 牌局定义
+     * @param salt 盐值
+     */
+    void init(const CompactDeal* deal, uint64_t salt);
+    
+    /**
+     * 完整计算状态键
+     * @param state 对局状态（任意规则策略的BasicCompactGameState）
+     * @return 状态键
+     */
+    template <typename State>
+    uint64_t computeKey(const State& state) const
+    {
+        uint64_t key = _salt ^ _stackKeys[state.getStackRemaining()] ^ _trayKeys[state.getTrayValue()];
+        for (int value = CardRules::MIN_CARD_VALUE; value <= CardRules::MAX_CARD_VALUE; value++) {
+            key ^= getCountKeys(value)[state.getValueCount(value)];
+        }
+        return key;
+    }
+    
+    /**
+     * 计算执行操作后的状态键，需在操作执行之后调用
+     * @param key 操作前的状态键
+     * @param move 操作（主牌区下标或MOVE_DRAW）
+     * @param prevTrayValue 操作前手牌数值
+     * @param state 操作后的对局状态（任意规则策略的BasicCompactGameState）
+     * @return 操作后的状态键
+     */
+    template <typename State>
+    uint64_t updateKey(uint64_t key, int move, int prevTrayValue, const State& state) const
+    {
+        key ^= _trayKeys[prevTrayValue] ^ _trayKeys[state.getTrayValue()];
+        if (move == State::MOVE_DRAW) {
+            int remaining = state.getStackRemaining();
+            return key ^ _stackKeys[remaining + 1] ^ _stackKeys[remaining];
+        }
+        // 出牌后手牌数值即为打出的卡牌数值
+        const uint64_t* countKeys = getCountKeys(state.getTrayValue());
+        int count = state.getValueCount(state.getTrayValue());
+        return key ^ countKeys[count + 1] ^ countKeys[count];
+    }
+    
+private:
+    std::vector<uint64_t> _countKeys;       // 各数值各剩余数量的键
+    int _countStride;                       // 每个数值占用的键数（最大数量 + 1）
+    std::vector<uint64_t> _stackKeys;       // 备用牌堆各剩余数的键
+    uint64_t _trayKeys[CardRules::MAX_CARD_VALUE + 1];   // 手牌各数值的键（0为空）
+    uint64_t _salt;                         // 盐值
+    
+    /**
+     * 获取某个数值的数量键
+     * @param value 卡牌数值（1-13）
+     * @return 按剩余数量索引的键数组
+     */
+    const uint64_t* getCountKeys(int value) const { return _countKeys.data() + (value - 1) * _countStride; }
+};
+
+#endif // __SOLVER_KEYS_H__
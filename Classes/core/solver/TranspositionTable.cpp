@@ -0,0 +1,107 @@
+/**
+ * TranspositionTable.cpp
+ * 无锁置换表实现
+ */
+
+#include "TranspositionTable.h"
+
+// 数据字布局：低2位结论，随后16位深度，再8位代
+static const int DATA_DEPTH_SHIFT = 2;
+static const int DATA_GENERATION_SHIFT = 18;
+static const int WORDS_PER_BUCKET = 4;
+
+static inline uint64_t packData(TranspositionResult result, int depth, uint8_t generation)
+{
+    if (depth > 0xFFFF) {
+        depth = 0xFFFF;
+    }
+    return static_cast<uint64_t>(result)
+        | (static_cast<uint64_t>(depth) << DATA_DEPTH_SHIFT)
+        | (static_cast<uint64_t>(generation) << DATA_GENERATION_SHIFT);
+}
+
+static inline int dataDepth(uint64_t data)
+{
+    return static_cast<int>((data >> DATA_DEPTH_SHIFT) & 0xFFFF);
+}
+
+static inline uint8_t dataGeneration(uint64_t data)
+{
+    return static_cast<uint8_t>(data >> DATA_GENERATION_SHIFT);
+}
+
+TranspositionTable::TranspositionTable()
+    : _words(nullptr)
+    , _bucketMask(0)
+    , _generation(0)
+{
+}
+
+TranspositionTable::~TranspositionTable()
+{
+    delete[] _words;
+}
+
+bool TranspositionTable::init(int sizeBits)
+{
+    if (sizeBits < 1 || sizeBits > 32) {
+        return false;
+    }
+    
+    delete[] _words;
+    size_t bucketCount = static_cast<size_t>(1) << sizeBits;
+    _words = new std::atomic<uint64_t>[bucketCount * WORDS_PER_BUCKET];
+    _bucketMask = bucketCount - 1;
+    clear();
+    
+    return true;
+}
+
+void TranspositionTable::clear()
+{
+    if (!_words) {
+        return;
+    }
+    
+    size_t wordCount = getBucketCount() * WORDS_PER_BUCKET;
+    for (size_t i = 0; i < wordCount; i++) {
+        _words[i].store(0, std::memory_order_relaxed);
+    }
+    _generation = 0;
+}
+
+TranspositionResult TranspositionTable::probe(uint64_t key, int* depth) const
+{
+    const std::atomic<uint64_t>* bucket = _words + (key & _bucketMask) * WORDS_PER_BUCKET;
+    
+    for (int slot = 0; slot < WORDS_PER_BUCKET; slot += 2) {
+        uint64_t check = bucket[slot].load(std::memory_order_relaxed);
+        uint64_t data = bucket[slot + 1].load(std::memory_order_relaxed);
+        if ((check ^ data) == key && data != 0) {
+            if (depth) {
+                *depth = dataDepth(data);
+            }
+            return static_cast<TranspositionResult>(data & 3);
+        }
+    }
+    
+    return TTR_UNKNOWN;
+}
+
+void TranspositionTable::store(uint64_t key, TranspositionResult result, int depth)
+{
+    std::atomic<uint64_t>* bucket = _words + (key & _bucketMask) * WORDS_PER_BUCKET;
+    uint64_t data = packData(result, depth, _generation);
+    
+    // 深度优先条目：同键、旧代或深度不更大时替换，否则写入总是替换的条目
+    uint64_t oldCheck = bucket[0].load(std::memory_order_relaxed);
+    uint64_t oldData = bucket[1].load(std::memory_order_relaxed);
+    int slot = 2;
+    if ((oldCheck ^ oldData) == key || oldData == 0
+        || dataGeneration(oldData) != _generation || dataDepth(oldData) <= depth) {
+        slot = 0;
+    }
+    
+    bucket[slot].store(key ^ data, std::memory_order_relaxed);
+    bucket[slot + 1].store(data, std::memory_order_relaxed);
+}
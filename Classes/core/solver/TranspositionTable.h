@@ -0,0 +1,87 @@
+/**
+ * TranspositionTable.h
+ * 多线程共享的无锁置换表
+ */
+
+#ifndef __TRANSPOSITION_TABLE_H__
+#define __TRANSPOSITION_TABLE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/**
+ * 置换表中记录的搜索结论
+ */
+enum TranspositionResult
+{
+    TTR_UNKNOWN = 0,    // 未记录
+    TTR_LOSS,           // 该状态无法通关
+    TTR_WIN             // 该状态可以通关
+};
+
+/**
+ * 无锁置换表类
+ * 每个桶有两个条目：深度优先条目只被更深（剩余卡牌更多）的结论或旧代结论替换，
+ * 另一个条目总是被替换。条目由两个64位原子字组成，分别保存 键^数据 与 数据，
+ * 读取时校验 键^数据^数据==键，并发写入造成的撕裂条目会被当作未命中丢弃
+ */
+class TranspositionTable
+{
+public:
+    /**
+     * 构造函数
+     */
+    TranspositionTable();
+    
+    /**
+     * 析构函数
+     */
+    ~TranspositionTable();
+    
+    /**
+     * 分配置换表
+     * @param sizeBits 桶数量的二进制位数（桶数为 1 << sizeBits，每桶32字节）
+     * @return 是否分配成功
+     */
+    bool init(int sizeBits);
+    
+    /**
+     * 清空所有条目
+     */
+    void clear();
+    
+    /**
+     * 开始新一代搜索，旧代条目在替换时优先被覆盖
+     */
+    void newGeneration() { _generation = static_cast<uint8_t>(_generation + 1); }
+    
+    /**
+     * 查询状态
+     * @param key 状态键
+     * @param depth 输出记录时的深度，可为nullptr
+     * @return 记录的结论，未命中返回TTR_UNKNOWN
+     */
+    TranspositionResult probe(uint64_t key, int* depth = nullptr) const;
+    
+    /**
+     * 记录状态结论
+     * @param key 状态键
+     * @param result 结论
+     * @param depth 深度（越大表示结论越有价值，如剩余卡牌数），最大65535
+     */
+    void store(uint64_t key, TranspositionResult result, int depth);
+    
+    /**
+     * 获取桶数量
+     * @return 桶数量
+     */
+    size_t getBucketCount() const { return _bucketMask + 1; }
+    
+private:
+    std::atomic<uint64_t>* _words;  // 每桶4个字：键^数据、数据 各两组
+    size_t _bucketMask;             // 桶下标掩码
+    uint8_t _generation;            // 当前代
+};
+
+#endif // __TRANSPOSITION_TABLE_H__
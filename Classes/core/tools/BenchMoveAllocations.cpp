@@ -0,0 +1,264 @@
+/**
+ * BenchMoveAllocations.cpp
+ * 统计每次走子（出牌、抽牌、回退）的堆分配次数，检查稳态走子的分配预算
+ *
+ * 用法: BenchMoveAllocations [--template grid:4x5:24] [--games 100] [--seed 1] [--undo-rate 0.2]
+ *                            [--path compact|model|snapshot]... [--budget 0]
+ *
+ * 每局先用CompactGameState按随机策略生成一串操作（含回退），再在各路径上执行两遍：
+ * 第一遍为预热，全部回退后执行第二遍，第二遍的分配即稳态分配（容器容量已增长到位）。
+ * - compact：CompactGameState的applyMove/undo
+ * - model：GameModel与UndoModel，按GameController/UndoManager中模型侧的步骤执行
+ * - snapshot：每步之后按GameController::submitHintSnapshot生成一份HintSnapshot
+ * --budget 指定稳态每步允许的分配次数，任一选中路径超出时返回1。
+ * 本工具链接了AllocationHooks.cpp，全局分配都经过AllocationTracker
+ */
+
+#include "ToolSupport.h"
+#include "core/profile/AllocationTracker.h"
+#include "core/generator/DealShuffler.h"
+#include "core/hint/HintSnapshot.h"
+#include "core/rules/CompactGameState.h"
+#include "models/UndoModel.h"
+#include "services/GameModelFromLevelGenerator.h"
+#include <stdio.h>
+#include <random>
+
+// 操作序列中表示回退的值（走子沿用CompactGameState的下标与MOVE_DRAW）
+static const int OP_UNDO = -2;
+
+// 单局操作数上限，避免反复回退导致序列过长
+static const int MAX_SCRIPT_LENGTH = 1000;
+
+enum BenchPath
+{
+    BP_COMPACT = 0,
+    BP_MODEL,
+    BP_SNAPSHOT,
+    BP_COUNT
+};
+
+static const char* const PATH_NAMES[BP_COUNT] = { "compact", "model", "snapshot" };
+
+/**
+ * 一条路径的累计结果，下标0为预热遍，1为稳态遍
+ */
+struct PathStats
+{
+    uint64_t moves[2];
+    uint64_t allocations[2];
+    uint64_t bytes[2];
+};
+
+/**
+ * 在走子作用域内执行一步并累计分配
+ */
+template <typename Step>
+static void measureMove(PathStats& stats, int pass, Step step)
+{
+    AllocationCounts before;
+    AllocationCounts after;
+    AllocationTracker::getCounts(AS_MOVE, before);
+    {
+        AllocationScopeGuard guard(AS_MOVE);
+        step();
+    }
+    AllocationTracker::getCounts(AS_MOVE, after);
+    stats.moves[pass]++;
+    stats.allocations[pass] += after.allocations - before.allocations;
+    stats.bytes[pass] += after.bytes - before.bytes;
+}
+
+/**
+ * 按随机策略生成操作序列：有合法走子时随机选一个，按比例插入回退
+ */
+static void makeScript(const CompactDeal& deal, uint64_t seed, double undoRate, std::vector<int>& script)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    CompactGameState state;
+    state.reset(&deal);
+    script.clear();
+    
+    std::vector<int> moves;
+    while (static_cast<int>(script.size()) < MAX_SCRIPT_LENGTH) {
+        if (state.canUndo() && chance(rng) < undoRate) {
+            state.undo();
+            script.push_back(OP_UNDO);
+            continue;
+        }
+        
+        moves.clear();
+        for (int i = 0; i < deal.getPlayfieldCount(); i++) {
+            if (state.canMoveCardFromPlayfieldToTray(i)) {
+                moves.push_back(i);
+            }
+        }
+        if (state.canDrawCardFromStack()) {
+            moves.push_back(CompactGameState::MOVE_DRAW);
+        }
+        if (moves.empty()) {
+            break;
+        }
+        
+        int move = moves[rng() % moves.size()];
+        state.applyMove(move);
+        script.push_back(move);
+    }
+}
+
+/**
+ * 在一局上执行两遍操作序列，累计各路径的分配
+ * @return 关卡展开失败时返回false
+ */
+static bool runGame(const LevelTemplate& levelTemplate, uint64_t seed, double undoRate, const bool* selected,
+                    PathStats* stats, AllocationCounts& load)
+{
+    LevelConfig levelConfig;
+    std::shared_ptr<CompactDeal> deal(new CompactDeal());
+    GameModel* model = nullptr;
+    {
+        AllocationScopeGuard guard(AS_LOAD);
+        DealShuffleParams params;
+        if (!DealShuffler::shuffleLevel(levelTemplate, seed, params, levelConfig) ||
+            !deal->initWithLevelConfig(&levelConfig)) {
+            return false;
+        }
+        model = GameModelFromLevelGenerator::generateGameModel(&levelConfig);
+        if (!model) {
+            return false;
+        }
+    }
+    std::shared_ptr<const CompactDeal> sharedDeal = deal;
+    
+    std::vector<int> script;
+    makeScript(*deal, seed, undoRate, script);
+    
+    CompactGameState state;
+    state.reset(deal.get());
+    UndoModel undoModel;
+    
+    for (int pass = 0; pass < 2; pass++) {
+        for (int op : script) {
+            if (selected[BP_COMPACT]) {
+                measureMove(stats[BP_COMPACT], pass, [&]() {
+                    if (op == OP_UNDO) {
+                        state.undo();
+                    } else {
+                        state.applyMove(op);
+                    }
+                });
+            }
+            if (selected[BP_MODEL] || selected[BP_SNAPSHOT]) {
+                measureMove(stats[BP_MODEL], pass, [&]() {
+                    if (op == OP_UNDO) {
+                        ToolSupport::undoModelMove(model, undoModel);
+                    } else {
+                        ToolSupport::applyModelMove(model, undoModel, op);
+                    }
+                });
+            }
+            if (selected[BP_SNAPSHOT]) {
+                measureMove(stats[BP_SNAPSHOT], pass, [&]() {
+                    delete HintSnapshot::createFromGameModel(model, sharedDeal);
+                });
+            }
+        }
+        
+        // 全部回退到开局，第二遍在已增长的容器上执行
+        while (state.canUndo()) {
+            state.undo();
+        }
+        while (ToolSupport::undoModelMove(model, undoModel)) {
+        }
+        undoModel.clearAllRecords();
+    }
+    
+    CORE_SAFE_DELETE(model);
+    AllocationTracker::getCounts(AS_LOAD, load);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    LevelTemplate levelTemplate;
+    std::string spec = args.getString("--template", "grid:4x5:24");
+    if (!LevelTemplate::parseSpec(spec, levelTemplate)) {
+        fprintf(stderr, "invalid template: %s\n", spec.c_str());
+        return 1;
+    }
+    
+    bool selected[BP_COUNT] = { false, false, false };
+    std::vector<std::string> paths = args.getAll("--path");
+    for (int i = 0; i < BP_COUNT; i++) {
+        selected[i] = paths.empty();
+    }
+    for (const auto& name : paths) {
+        bool found = false;
+        for (int i = 0; i < BP_COUNT; i++) {
+            if (name == PATH_NAMES[i]) {
+                selected[i] = found = true;
+            }
+        }
+        if (!found) {
+            fprintf(stderr, "unknown path: %s\n", name.c_str());
+            return 1;
+        }
+    }
+    
+    int games = args.getInt("--games", 100);
+    uint64_t seed = static_cast<uint64_t>(args.getInt("--seed", 1));
+    double undoRate = args.getDouble("--undo-rate", 0.2);
+    double budget = args.getDouble("--budget", -1.0);
+    
+    AllocationTracker::resetCounts();
+    AllocationTracker::setEnabled(true);
+    if (!AllocationTracker::isHooked()) {
+        fprintf(stderr, "allocation hooks are not linked into this build\n");
+        return 1;
+    }
+    
+    PathStats stats[BP_COUNT] = {};
+    AllocationCounts load = {};
+    int played = 0;
+    for (int g = 0; g < games; g++) {
+        if (runGame(levelTemplate, seed + g, undoRate, selected, stats, load)) {
+            played++;
+        }
+    }
+    AllocationTracker::setEnabled(false);
+    if (played == 0) {
+        fprintf(stderr, "no games could be generated from %s\n", spec.c_str());
+        return 1;
+    }
+    
+    printf("heap allocations per move (%s, %d games, undo rate %.2f)\n", spec.c_str(), played, undoRate);
+    printf("%-10s %10s %12s %12s %14s %14s\n", "path", "moves", "allocs/move", "bytes/move",
+           "steady allocs", "steady bytes");
+    bool overBudget = false;
+    for (int i = 0; i < BP_COUNT; i++) {
+        if (!selected[i] || stats[i].moves[1] == 0) {
+            continue;
+        }
+        const PathStats& s = stats[i];
+        double steadyAllocations = static_cast<double>(s.allocations[1]) / s.moves[1];
+        printf("%-10s %10llu %12.3f %12.1f %14.3f %14.1f\n", PATH_NAMES[i],
+               static_cast<unsigned long long>(s.moves[0] + s.moves[1]),
+               static_cast<double>(s.allocations[0] + s.allocations[1]) / (s.moves[0] + s.moves[1]),
+               static_cast<double>(s.bytes[0] + s.bytes[1]) / (s.moves[0] + s.moves[1]),
+               steadyAllocations, static_cast<double>(s.bytes[1]) / s.moves[1]);
+        if (budget >= 0.0 && steadyAllocations > budget) {
+            overBudget = true;
+        }
+    }
+    printf("%-10s %10d %12.1f %12.1f   (per game)\n", "load", played,
+           static_cast<double>(load.allocations) / played, static_cast<double>(load.bytes) / played);
+    
+    if (overBudget) {
+        fprintf(stderr, "steady-state allocations per move exceed budget %.3f\n", budget);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,244 @@
+/**
+ * BenchRulePolicies.cpp
+ * 比较运行期规则分支与编译期规则策略的走子生成速度，并在各规则变体下求解牌局
+ *
+ * 用法: BenchRulePolicies [--level FILE]... [--random-deal 40,24 --random-count 32 --seed 1]
+ *                         [--walks 200] [--solve --table-bits 20 --node-limit 2000000]
+ */
+
+#include "ToolSupport.h"
+#include "core/rules/RuleSimulator.h"
+#include "core/solver/RuleSolver.h"
+#include <stdio.h>
+#include <random>
+
+/**
+ * 运行期选择的规则变体，对应CARD_RULES_INSTANTIATE中的策略
+ */
+enum RuleVariant
+{
+    RV_ADJACENT = 0,
+    RV_WRAP,
+    RV_TWO_STEP,
+    RV_JOKER,
+    RV_COUNT
+};
+
+static const char* VARIANT_NAMES[] = { "adjacent", "wrap", "two-step", "joker" };
+
+typedef bool (*MatchFunction)(int value, int targetValue);
+
+/**
+ * 通过函数指针调用的匹配函数，对应把规则放在指针后面的写法
+ */
+template <typename Rule>
+static bool matchByPointer(int value, int targetValue)
+{
+    return targetValue == 0 || Rule::matches(value, targetValue);
+}
+
+static const MatchFunction MATCH_FUNCTIONS[] = {
+    matchByPointer<AdjacentRule>, matchByPointer<WrapRule>, matchByPointer<TwoStepRule>, matchByPointer<JokerRule>
+};
+
+/**
+ * 每次检查都按变体分支的匹配函数
+ */
+static bool matchBySwitch(int variant, int value, int targetValue)
+{
+    if (targetValue == 0) {
+        return true;
+    }
+    switch (variant) {
+        case RV_ADJACENT:
+            return AdjacentRule::matches(value, targetValue);
+        case RV_WRAP:
+            return WrapRule::matches(value, targetValue);
+        case RV_TWO_STEP:
+            return TwoStepRule::matches(value, targetValue);
+        default:
+            return JokerRule::matches(value, targetValue);
+    }
+}
+
+/**
+ * 走子生成方式
+ */
+enum GeneratorKind
+{
+    GK_SWITCH = 0,      // 运行期分支
+    GK_POINTER,         // 函数指针
+    GK_TEMPLATE,        // 编译期策略
+    GK_COUNT
+};
+
+/**
+ * 按指定方式生成可打出的卡牌
+ */
+template <typename Rule>
+static int generatePlays(int kind, int variant, const BasicCompactGameState<Rule>& state, std::vector<int32_t>& plays)
+{
+    if (kind == GK_TEMPLATE) {
+        return RuleSimulator<Rule>::generatePlays(state, plays);
+    }
+    
+    plays.clear();
+    const std::vector<uint8_t>& faces = state.getDeal()->getPlayfieldFaces();
+    int trayValue = state.getTrayValue();
+    MatchFunction matches = MATCH_FUNCTIONS[variant];
+    for (size_t i = 0; i < faces.size(); i++) {
+        if (!state.isPlayfieldCardPresent(static_cast<int>(i))) {
+            continue;
+        }
+        bool playable = kind == GK_SWITCH ? matchBySwitch(variant, faces[i] + 1, trayValue) : matches(faces[i] + 1, trayValue);
+        if (playable) {
+            plays.push_back(static_cast<int32_t>(i));
+        }
+    }
+    return static_cast<int>(plays.size());
+}
+
+/**
+ * 在所有牌局上做随机走子，统计生成次数与耗时
+ * @param checksum 输出所有生成结果的校验和，三种方式必须一致
+ * @return 耗时（秒）
+ */
+template <typename Rule>
+static double runWalks(int kind, int variant, const std::vector<CompactDeal>& deals, int walks, uint64_t seed,
+                       uint64_t& calls, uint64_t& checksum)
+{
+    BasicCompactGameState<Rule> state;
+    std::vector<int32_t> plays;
+    std::mt19937_64 rng(seed);
+    calls = 0;
+    checksum = 0;
+    
+    uint64_t start = ToolSupport::nowNanos();
+    for (const auto& deal : deals) {
+        for (int w = 0; w < walks; w++) {
+            state.reset(&deal);
+            while (!state.isGameWon()) {
+                int count = generatePlays(kind, variant, state, plays);
+                calls++;
+                checksum = checksum * 31 + static_cast<uint64_t>(count);
+                if (count > 0) {
+                    state.moveCardFromPlayfieldToTray(plays[rng() % count]);
+                } else if (!state.drawCardFromStack()) {
+                    break;
+                }
+            }
+        }
+    }
+    return (ToolSupport::nowNanos() - start) / 1e9;
+}
+
+/**
+ * 比较一个变体的三种走子生成方式
+ * @return 三种方式结果一致时返回true
+ */
+template <typename Rule>
+static bool benchVariant(int variant, const std::vector<CompactDeal>& deals, int walks, uint64_t seed)
+{
+    double nanosPerCall[GK_COUNT];
+    uint64_t checksums[GK_COUNT];
+    for (int kind = 0; kind < GK_COUNT; kind++) {
+        uint64_t calls = 0;
+        double seconds = runWalks<Rule>(kind, variant, deals, walks, seed, calls, checksums[kind]);
+        nanosPerCall[kind] = calls ? seconds * 1e9 / calls : 0.0;
+    }
+    
+    if (checksums[GK_SWITCH] != checksums[GK_TEMPLATE] || checksums[GK_POINTER] != checksums[GK_TEMPLATE]) {
+        fprintf(stderr, "%s: generators disagree\n", VARIANT_NAMES[variant]);
+        return false;
+    }
+    
+    double templateNanos = nanosPerCall[GK_TEMPLATE];
+    printf("%-10s %12.1f %12.1f %12.1f %10.2fx %10.2fx\n", VARIANT_NAMES[variant],
+           nanosPerCall[GK_SWITCH], nanosPerCall[GK_POINTER], templateNanos,
+           templateNanos > 0 ? nanosPerCall[GK_SWITCH] / templateNanos : 0.0,
+           templateNanos > 0 ? nanosPerCall[GK_POINTER] / templateNanos : 0.0);
+    return true;
+}
+
+/**
+ * 在一个变体下求解所有牌局
+ */
+template <typename Rule>
+static bool solveVariant(int variant, const std::vector<CompactDeal>& deals, int tableBits, uint64_t nodeLimit)
+{
+    RuleSolver<Rule> solver;
+    if (!solver.init(tableBits)) {
+        fprintf(stderr, "failed to allocate table\n");
+        return false;
+    }
+    
+    int counts[3] = { 0, 0, 0 };
+    uint64_t nodes = 0;
+    uint64_t start = ToolSupport::nowNanos();
+    for (const auto& deal : deals) {
+        SolveResult result;
+        solver.solve(&deal, result, nodeLimit);
+        counts[result.status]++;
+        nodes += result.nodes;
+        
+        // 解法必须在同一规则下可以重放
+        if (result.status == SS_SOLVED) {
+            BasicCompactGameState<Rule> state;
+            state.reset(&deal);
+            for (auto move : result.solution) {
+                state.applyMove(move);
+            }
+            if (!state.isGameWon()) {
+                fprintf(stderr, "%s: solution does not replay\n", VARIANT_NAMES[variant]);
+                return false;
+            }
+        }
+    }
+    double seconds = (ToolSupport::nowNanos() - start) / 1e9;
+    
+    printf("%-10s %8d %10d %10d %14llu %10.3f\n", VARIANT_NAMES[variant], counts[SS_SOLVED], counts[SS_UNSOLVABLE],
+           counts[SS_NODE_LIMIT], (unsigned long long)nodes, seconds);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    std::vector<CompactDeal> deals;
+    if (args.getAll("--level").empty() && args.getString("--random-deal", "").empty()) {
+        // 默认使用一组中等规模的随机牌局
+        for (int i = 0; i < 32; i++) {
+            deals.push_back(CompactDeal());
+            ToolSupport::makeRandomDeal(static_cast<uint32_t>(args.getInt("--seed", 1) + i), 40, 24, deals.back());
+        }
+    } else if (!ToolSupport::loadDealsFromArgs(args, deals)) {
+        return 1;
+    }
+    
+    int walks = args.getInt("--walks", 200);
+    uint64_t seed = static_cast<uint64_t>(args.getInt("--seed", 1));
+    
+    printf("move generation, ns per call (%d deals x %d walks)\n", static_cast<int>(deals.size()), walks);
+    printf("%-10s %12s %12s %12s %11s %11s\n", "rule", "switch", "pointer", "template", "vs switch", "vs pointer");
+    bool valid = benchVariant<AdjacentRule>(RV_ADJACENT, deals, walks, seed)
+        && benchVariant<WrapRule>(RV_WRAP, deals, walks, seed)
+        && benchVariant<TwoStepRule>(RV_TWO_STEP, deals, walks, seed)
+        && benchVariant<JokerRule>(RV_JOKER, deals, walks, seed);
+    if (!valid) {
+        return 1;
+    }
+    
+    if (args.hasFlag("--solve")) {
+        int tableBits = args.getInt("--table-bits", 20);
+        uint64_t nodeLimit = static_cast<uint64_t>(args.getDouble("--node-limit", 2000000));
+        printf("\nsolving\n");
+        printf("%-10s %8s %10s %10s %14s %10s\n", "rule", "solved", "unsolvable", "node-limit", "nodes", "seconds");
+        valid = solveVariant<AdjacentRule>(RV_ADJACENT, deals, tableBits, nodeLimit)
+            && solveVariant<WrapRule>(RV_WRAP, deals, tableBits, nodeLimit)
+            && solveVariant<TwoStepRule>(RV_TWO_STEP, deals, tableBits, nodeLimit)
+            && solveVariant<JokerRule>(RV_JOKER, deals, tableBits, nodeLimit);
+    }
+    
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/**
+ * BuildDailyChallenge.cpp
+ * 生成指定日期的每日挑战文件，或校验已有的挑战文件
+ *
+ * 用法: BuildDailyChallenge --date 2026-10-19 (--key-file FILE | --key TEXT) [--out daily_20261019.cdly]
+ *                           [--template grid:4x5:24] [--shuffle deck] [--decks 0] [--salt N]
+ *                           [--min-difficulty 0.6] [--max-difficulty 0.95] [--min-par 4] [--max-par 12]
+ *                           [--playouts 512] [--threads 0] [--max-candidates 4096]
+ *                           [--table-bits 18] [--node-limit 2000000]
+ *       BuildDailyChallenge --verify FILE (--key-file FILE | --key TEXT)
+ * 整个过程不访问网络，相同参数在任何机器上生成相同的文件
+ */
+
+#include "ToolSupport.h"
+#include "core/generator/DailyChallengeBuilder.h"
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * 读取签名密钥
+ */
+static bool loadKey(const ToolArgs& args, std::string& key)
+{
+    std::string keyFile = args.getString("--key-file", "");
+    if (!keyFile.empty()) {
+        std::ifstream file(keyFile.c_str(), std::ios::in | std::ios::binary);
+        if (!file) {
+            fprintf(stderr, "failed to read key file %s\n", keyFile.c_str());
+            return false;
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        key = content.str();
+    } else {
+        key = args.getString("--key", "");
+    }
+    
+    if (key.empty()) {
+        fprintf(stderr, "a signing key is required (--key-file or --key)\n");
+        return false;
+    }
+    return true;
+}
+
+static void printChallenge(const DailyChallenge& challenge)
+{
+    printf("date:        %u\n", challenge.date);
+    printf("template:    %s (%s)\n", challenge.templateSpec.c_str(), DealShuffler::getModeName(challenge.shuffle.mode));
+    printf("candidate:   %u\n", challenge.candidate);
+    printf("seed:        %016llx\n", (unsigned long long)challenge.seed);
+    printf("difficulty:  %.3f\n", challenge.difficulty);
+    printf("par:         %d draws, %d moves\n", challenge.parDraws, challenge.parMoves);
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    std::string key;
+    if (!loadKey(args, key)) {
+        return 1;
+    }
+    
+    std::string verifyPath = args.getString("--verify", "");
+    if (!verifyPath.empty()) {
+        DailyChallenge challenge;
+        if (!DailyChallengeFile::loadFromFile(verifyPath, key, challenge)) {
+            fprintf(stderr, "%s: unreadable or bad signature\n", verifyPath.c_str());
+            return 1;
+        }
+        printChallenge(challenge);
+        if (!DailyChallengeFile::verifySolution(challenge)) {
+            fprintf(stderr, "%s: solution does not replay to par\n", verifyPath.c_str());
+            return 1;
+        }
+        printf("verified\n");
+        return 0;
+    }
+    
+    uint32_t date = 0;
+    if (!DailyChallengeBuilder::parseDate(args.getString("--date", ""), date)) {
+        fprintf(stderr, "--date expects YYYY-MM-DD\n");
+        return 1;
+    }
+    
+    DailyChallengeOptions options;
+    options.templateSpec = args.getString("--template", options.templateSpec);
+    if (!DealShuffler::parseMode(args.getString("--shuffle", "deck"), options.shuffle.mode)) {
+        fprintf(stderr, "bad --shuffle, expected deck, uniform or solvable\n");
+        return 1;
+    }
+    options.shuffle.deckCount = args.getInt("--decks", 0);
+    options.salt = strtoull(args.getString("--salt", "0x4441494C59").c_str(), nullptr, 0);
+    options.minDifficulty = static_cast<float>(args.getDouble("--min-difficulty", options.minDifficulty));
+    options.maxDifficulty = static_cast<float>(args.getDouble("--max-difficulty", options.maxDifficulty));
+    options.minParDraws = args.getInt("--min-par", options.minParDraws);
+    options.maxParDraws = args.getInt("--max-par", options.maxParDraws);
+    options.playouts = args.getInt("--playouts", options.playouts);
+    options.threadCount = args.getInt("--threads", options.threadCount);
+    options.maxCandidates = args.getInt("--max-candidates", options.maxCandidates);
+    options.tableBits = args.getInt("--table-bits", options.tableBits);
+    options.nodeLimit = static_cast<uint64_t>(args.getDouble("--node-limit", static_cast<double>(options.nodeLimit)));
+    
+    DailyChallenge challenge;
+    DailyChallengeStats stats;
+    uint64_t start = ToolSupport::nowNanos();
+    bool found = DailyChallengeBuilder::build(date, options, challenge, &stats);
+    double seconds = (ToolSupport::nowNanos() - start) / 1e9;
+    
+    printf("candidates:  %u (difficulty %u, unsolvable %u, node limit %u, par %u rejected)\n", stats.candidates,
+           stats.outOfDifficulty, stats.unsolvable, stats.nodeLimited, stats.outOfPar);
+    printf("nodes:       %llu\n", (unsigned long long)stats.nodes);
+    printf("seconds:     %.3f\n", seconds);
+    if (!found) {
+        fprintf(stderr, "no candidate met the bounds within %d candidates\n", options.maxCandidates);
+        return 1;
+    }
+    printChallenge(challenge);
+    
+    // 写入前再按客户端的方式重放一遍
+    if (!DailyChallengeFile::verifySolution(challenge)) {
+        fprintf(stderr, "generated solution does not replay\n");
+        return 1;
+    }
+    
+    char defaultPath[64];
+    snprintf(defaultPath, sizeof(defaultPath), "daily_%u.cdly", date);
+    std::string outPath = args.getString("--out", defaultPath);
+    std::ofstream output(outPath.c_str(), std::ios::out | std::ios::binary);
+    if (!output || !DailyChallengeFile::write(challenge, key, output)) {
+        fprintf(stderr, "failed to write %s\n", outPath.c_str());
+        return 1;
+    }
+    output.close();
+    printf("wrote:       %s\n", outPath.c_str());
+    return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * BuildTablebase.cpp
+ * 离线构建残局库，并用标准杆求解器抽查结论
+ *
+ * 用法: BuildTablebase [--max-cards 5] [--out endgame.tb] [--verify 1000 --seed 1]
+ *       BuildTablebase --load endgame.tb [--verify 1000]
+ */
+
+#include "ToolSupport.h"
+#include "core/solver/EndgameTablebase.h"
+#include "core/solver/ParSolver.h"
+#include <stdio.h>
+#include <random>
+
+/**
+ * 随机牌局的初始局面与标准杆求解器对比
+ * @return 不一致的局面数
+ */
+static int verifyTablebase(const EndgameTablebase& tablebase, int count, uint32_t seed)
+{
+    ParSolver solver;
+    solver.init(16);
+    std::mt19937 rng(seed);
+    int mismatches = 0;
+    
+    for (int i = 0; i < count; i++) {
+        // 开局翻出一张手牌，剩余卡牌数为 主牌区 + 备用牌堆 - 1
+        int total = 1 + static_cast<int>(rng() % tablebase.getMaxCards());
+        int playfieldCount = 1 + static_cast<int>(rng() % total);
+        int stackCount = total - playfieldCount + 1;
+        
+        CompactDeal deal;
+        ToolSupport::makeRandomDeal(rng(), playfieldCount, stackCount, deal);
+        CompactGameState state;
+        state.reset(&deal);
+        
+        EndgameProbe probe;
+        ParResult result;
+        if (!tablebase.probe(state, probe) || !solver.solve(deal, result)) {
+            mismatches++;
+            continue;
+        }
+        
+        int expected = result.status == PS_OPTIMAL ? result.parDraws : -1;
+        if (probe.drawsToWin != expected) {
+            fprintf(stderr, "deal %d,%d seed: tablebase %d, search %d\n", playfieldCount, stackCount,
+                    probe.drawsToWin, expected);
+            mismatches++;
+            continue;
+        }
+        
+        std::vector<int32_t> line;
+        if (probe.winnable && !tablebase.playOut(state, line)) {
+            fprintf(stderr, "best moves do not reach a win\n");
+            mismatches++;
+        }
+    }
+    
+    return mismatches;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    EndgameTablebase tablebase;
+    
+    std::string loadFile = args.getString("--load", "");
+    uint64_t start = ToolSupport::nowNanos();
+    if (!loadFile.empty()) {
+        if (!tablebase.loadFromFile(loadFile)) {
+            fprintf(stderr, "failed to load %s\n", loadFile.c_str());
+            return 1;
+        }
+    } else if (!tablebase.build(args.getInt("--max-cards", 5))) {
+        fprintf(stderr, "--max-cards must be 1-%d\n", EndgameTablebase::MAX_SUPPORTED_CARDS);
+        return 1;
+    }
+    double seconds = (ToolSupport::nowNanos() - start) / 1e9;
+    
+    uint64_t winnable = tablebase.countWinnable();
+    printf("max cards:  %d\n", tablebase.getMaxCards());
+    printf("positions:  %llu (%.1f MB)\n", (unsigned long long)tablebase.getEntryCount(),
+           tablebase.getEntryCount() / 1048576.0);
+    printf("winnable:   %.1f%%\n", 100.0 * winnable / tablebase.getEntryCount());
+    printf("%s:   %.3f s\n", loadFile.empty() ? "build" : "load ", seconds);
+    
+    std::string outFile = args.getString("--out", "");
+    if (!outFile.empty() && !tablebase.saveToFile(outFile)) {
+        fprintf(stderr, "failed to write %s\n", outFile.c_str());
+        return 1;
+    }
+    
+    int verifyCount = args.getInt("--verify", 0);
+    if (verifyCount > 0) {
+        int mismatches = verifyTablebase(tablebase, verifyCount, static_cast<uint32_t>(args.getInt("--seed", 1)));
+        printf("verified:   %d deals, %d mismatches\n", verifyCount, mismatches);
+        return mismatches == 0 ? 0 : 2;
+    }
+    
+    return 0;
+}
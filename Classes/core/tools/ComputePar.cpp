@@ -0,0 +1,311 @@
+/**
+ * ComputePar.cpp
+ * 为关卡目录计算最优标准杆（最少抽牌次数），写入关卡Meta字段
+ *
+ * 用法: ComputePar [--level FILE]... [--pack FILE]... [--random-deal 20,24 --random-count 16]
+ *                  [--threads 0] [--table-bits 20] [--node-limit 0] [--tablebase endgame.tb]
+ *                  [--out-dir DIR] [--csv FILE]
+ * --out-dir 只输出求得最优标准杆的关卡：--level 的关卡以原文件名输出，保留原文件的全部字段（如Seed、Template），
+ * 在原有Meta中写入Hash、ParDraws、ParMoves与达到标准杆的解法；--pack 的关卡输出为 <包名>_<n>.json
+ */
+
+#include "ToolSupport.h"
+#include "core/CoreMacros.h"
+#include "core/rules/CanonicalForm.h"
+#include "core/solver/ParSolver.h"
+#include "core/solver/EndgameTablebase.h"
+#include "core/generator/LevelExporter.h"
+#include "configs/loaders/LevelPackLoader.h"
+#include <stdio.h>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#if CARDCORE_HAS_JSON
+#include "configs/loaders/LevelConfigLoader.h"
+#include "json/document.h"
+#include "json/prettywriter.h"
+#include "json/stringbuffer.h"
+#endif
+
+static const char* STATUS_NAMES[] = { "optimal", "unsolvable", "node-limit" };
+
+/**
+ * 目录中的一个关卡
+ */
+struct ParEntry
+{
+    std::string name;               // 来源
+    std::string sourceFile;         // 来源关卡JSON文件，关卡包与随机牌局为空
+    std::string outputName;         // --out-dir 下的输出文件名，随机牌局为空
+    LevelConfig* levelConfig;       // 关卡配置，随机牌局为nullptr
+    CompactDeal deal;               // 牌局
+    ParResult result;               // 求解结果
+    
+    ParEntry()
+        : levelConfig(nullptr)
+    {}
+};
+
+/**
+ * 获取路径中的文件名
+ */
+static std::string getFileName(const std::string& filePath)
+{
+    size_t slash = filePath.find_last_of("/\\");
+    return slash == std::string::npos ? filePath : filePath.substr(slash + 1);
+}
+
+/**
+ * 加载关卡配置并加入目录
+ */
+static bool addLevelConfig(const std::string& name, LevelConfig* levelConfig, std::vector<ParEntry>& entries)
+{
+    entries.push_back(ParEntry());
+    entries.back().name = name;
+    entries.back().levelConfig = levelConfig;
+    return entries.back().deal.initWithLevelConfig(levelConfig);
+}
+
+/**
+ * 按参数加载目录
+ */
+static bool loadCatalog(const ToolArgs& args, std::vector<ParEntry>& entries)
+{
+    for (const auto& filePath : args.getAll("--level")) {
+#if CARDCORE_HAS_JSON
+        if (!addLevelConfig(filePath, LevelConfigLoader::loadLevelConfigFromFile(filePath), entries)) {
+            fprintf(stderr, "failed to load level %s\n", filePath.c_str());
+            return false;
+        }
+        entries.back().sourceFile = filePath;
+        entries.back().outputName = getFileName(filePath);
+#else
+        fprintf(stderr, "cardcore was built without LevelConfigLoader, cannot read %s\n", filePath.c_str());
+        return false;
+#endif
+    }
+    
+    for (const auto& filePath : args.getAll("--pack")) {
+        std::vector<LevelConfig*> levelConfigs;
+        if (!LevelPackLoader::loadFromFile(filePath, levelConfigs)) {
+            fprintf(stderr, "failed to load pack %s\n", filePath.c_str());
+            return false;
+        }
+        for (size_t i = 0; i < levelConfigs.size(); i++) {
+            if (!addLevelConfig(filePath + "#" + std::to_string(i + 1), levelConfigs[i], entries)) {
+                fprintf(stderr, "invalid level %s#%d\n", filePath.c_str(), static_cast<int>(i + 1));
+                return false;
+            }
+            std::string packName = getFileName(filePath);
+            packName = packName.substr(0, packName.find_last_of('.'));
+            entries.back().outputName = packName + "_" + std::to_string(i + 1) + ".json";
+        }
+    }
+    
+    if (!args.getString("--random-deal", "").empty()) {
+        std::vector<CompactDeal> deals;
+        if (!ToolSupport::loadDealsFromArgs(args, deals)) {
+            return false;
+        }
+        for (size_t i = 0; i < deals.size(); i++) {
+            entries.push_back(ParEntry());
+            entries.back().name = "random#" + std::to_string(i + 1);
+            entries.back().deal = deals[i];
+        }
+    }
+    
+    return !entries.empty();
+}
+
+#if CARDCORE_HAS_JSON
+/**
+ * 设置Meta中的一个字段，已有时覆盖
+ */
+static void setMetaMember(rapidjson::Value& meta, const char* name, rapidjson::Value& value,
+                          rapidjson::Document::AllocatorType& allocator)
+{
+    if (meta.HasMember(name)) {
+        meta[name] = value;
+    } else {
+        rapidjson::Value key(name, allocator);
+        meta.AddMember(key, value, allocator);
+    }
+}
+
+/**
+ * 把标准杆合并进关卡JSON的Meta，其余字段原样保留
+ * @param sourceFile 来源关卡文件
+ * @param metadata 标准杆与解法
+ * @param output 输出流
+ * @return 来源文件无法读取或解析时返回false
+ */
+static bool writeMergedJson(const std::string& sourceFile, const LevelMetadata& metadata, std::ostream& output)
+{
+    std::ifstream file(sourceFile.c_str());
+    std::ostringstream content;
+    content << file.rdbuf();
+    
+    rapidjson::Document doc;
+    doc.Parse(content.str().c_str());
+    if (!file || doc.HasParseError() || !doc.IsObject()) {
+        return false;
+    }
+    
+    rapidjson::Document::AllocatorType& allocator = doc.GetAllocator();
+    if (!doc.HasMember("Meta") || !doc["Meta"].IsObject()) {
+        rapidjson::Value meta(rapidjson::kObjectType);
+        setMetaMember(doc, "Meta", meta, allocator);
+    }
+    rapidjson::Value& meta = doc["Meta"];
+    
+    char hashText[32];
+    snprintf(hashText, sizeof(hashText), "%016llx", static_cast<unsigned long long>(metadata.hash));
+    rapidjson::Value hash(hashText, allocator);
+    rapidjson::Value parDraws(metadata.parDraws);
+    rapidjson::Value parMoves(metadata.parMoves);
+    rapidjson::Value solution(rapidjson::kArrayType);
+    for (int32_t move : metadata.solution) {
+        rapidjson::Value step(move);
+        solution.PushBack(step, allocator);
+    }
+    setMetaMember(meta, "Hash", hash, allocator);
+    setMetaMember(meta, "ParDraws", parDraws, allocator);
+    setMetaMember(meta, "ParMoves", parMoves, allocator);
+    setMetaMember(meta, "Solution", solution, allocator);
+    
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+    output << buffer.GetString() << "\n";
+    return true;
+}
+#endif
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    std::vector<ParEntry> entries;
+    if (!loadCatalog(args, entries)) {
+        fprintf(stderr, "no levels, use --level FILE, --pack FILE or --random-deal PF,STACK\n");
+        return 1;
+    }
+    
+    int threadCount = args.getInt("--threads", 0);
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        threadCount = threadCount > 0 ? threadCount : 1;
+    }
+    // 残局库只读，所有线程共享
+    EndgameTablebase tablebase;
+    std::string tablebaseFile = args.getString("--tablebase", "");
+    if (!tablebaseFile.empty() && !tablebase.loadFromFile(tablebaseFile)) {
+        fprintf(stderr, "failed to load tablebase %s\n", tablebaseFile.c_str());
+        return 1;
+    }
+    
+    int tableBits = args.getInt("--table-bits", 20);
+    uint64_t nodeLimit = static_cast<uint64_t>(args.getDouble("--node-limit", 0));
+    
+    // 每个线程一个求解器，按下标领取关卡
+    std::atomic<size_t> nextIndex(0);
+    std::atomic<bool> failed(false);
+    auto worker = [&]() {
+        ParSolver solver;
+        if (!solver.init(tableBits)) {
+            failed = true;
+            return;
+        }
+        solver.setTablebase(tablebaseFile.empty() ? nullptr : &tablebase);
+        for (size_t i = nextIndex++; i < entries.size(); i = nextIndex++) {
+            solver.solve(entries[i].deal, entries[i].result, nodeLimit);
+        }
+    };
+    
+    uint64_t start = ToolSupport::nowNanos();
+    std::vector<std::thread> threads;
+    for (int i = 1; i < threadCount; i++) {
+        threads.push_back(std::thread(worker));
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = (ToolSupport::nowNanos() - start) / 1e9;
+    
+    if (failed) {
+        fprintf(stderr, "failed to allocate transposition table\n");
+        return 1;
+    }
+    
+    std::string outDir = args.getString("--out-dir", "");
+    std::string csvFile = args.getString("--csv", "");
+    std::ofstream csv;
+    if (!csvFile.empty()) {
+        csv.open(csvFile.c_str());
+        csv << "name,hash,status,par_draws,par_moves,incumbent_draws,iterations,nodes\n";
+    }
+    
+    int counts[3] = { 0, 0, 0 };
+    for (size_t i = 0; i < entries.size(); i++) {
+        const ParEntry& entry = entries[i];
+        const ParResult& result = entry.result;
+        uint64_t hash = CanonicalForm::hashDeal(entry.deal);
+        counts[result.status]++;
+        
+        printf("%s: %s, par %d draws / %d moves, beam %d, %d iterations, %llu nodes\n", entry.name.c_str(),
+               STATUS_NAMES[result.status], result.parDraws, result.parMoves, result.incumbentDraws,
+               result.iterations, (unsigned long long)result.nodes);
+        
+        if (csv.is_open()) {
+            char hashText[32];
+            snprintf(hashText, sizeof(hashText), "%016llx", (unsigned long long)hash);
+            csv << entry.name << "," << hashText << "," << STATUS_NAMES[result.status] << "," << result.parDraws << ","
+                << result.parMoves << "," << result.incumbentDraws << "," << result.iterations << "," << result.nodes << "\n";
+        }
+        
+        // 无解或超出节点上限的关卡没有可信的标准杆，不改写
+        if (outDir.empty() || entry.outputName.empty() || result.status != PS_OPTIMAL) {
+            continue;
+        }
+        
+        LevelMetadata metadata;
+        metadata.hash = hash;
+        metadata.parDraws = result.parDraws;
+        metadata.parMoves = result.parMoves;
+        metadata.solution = result.line;
+        
+        // 先在内存中生成，输出目录即来源目录时不会在读取前清空原文件
+        std::ostringstream json;
+#if CARDCORE_HAS_JSON
+        if (!entry.sourceFile.empty()) {
+            if (!writeMergedJson(entry.sourceFile, metadata, json)) {
+                fprintf(stderr, "failed to read %s\n", entry.sourceFile.c_str());
+                return 1;
+            }
+        } else {
+            LevelExporter::writeJson(*entry.levelConfig, &metadata, json);
+        }
+#else
+        LevelExporter::writeJson(*entry.levelConfig, &metadata, json);
+#endif
+
+        std::string outFile = outDir + "/" + entry.outputName;
+        std::ofstream output(outFile.c_str());
+        if (!output || !(output << json.str())) {
+            fprintf(stderr, "failed to write %s\n", outFile.c_str());
+            return 1;
+        }
+    }
+    
+    printf("%d levels: %d optimal, %d unsolvable, %d node-limit, %.3f s, %.1f levels/sec\n",
+           static_cast<int>(entries.size()), counts[PS_OPTIMAL], counts[PS_UNSOLVABLE], counts[PS_NODE_LIMIT],
+           seconds, seconds > 0 ? entries.size() / seconds : 0.0);
+    
+    for (auto& entry : entries) {
+        CORE_SAFE_DELETE(entry.levelConfig);
+    }
+    return 0;
+}
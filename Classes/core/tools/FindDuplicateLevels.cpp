@@ -0,0 +1,107 @@
+/**
+ * FindDuplicateLevels.cpp
+ * 按规范形式查找关卡目录中的重复关卡（只差花色、位置或主牌区顺序的关卡视为重复）
+ *
+ * 用法: FindDuplicateLevels [--level FILE]... [--pack FILE]...
+ */
+
+#include "ToolSupport.h"
+#include "core/CoreMacros.h"
+#include "core/rules/CanonicalForm.h"
+#include "configs/loaders/LevelPackLoader.h"
+#include <stdio.h>
+#include <unordered_map>
+
+/**
+ * 目录中的一个关卡
+ */
+struct CatalogEntry
+{
+    std::string name;               // 来源（文件名或 包文件#序号）
+    std::vector<uint8_t> form;      // 规范形式
+};
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    std::vector<CatalogEntry> entries;
+    
+    for (const auto& filePath : args.getAll("--level")) {
+        CompactDeal deal;
+        if (!ToolSupport::loadDealFromFile(filePath, deal)) {
+            fprintf(stderr, "failed to load level %s\n", filePath.c_str());
+            return 1;
+        }
+        entries.push_back(CatalogEntry());
+        entries.back().name = filePath;
+        CanonicalForm::buildDealForm(deal, entries.back().form);
+    }
+    
+    for (const auto& filePath : args.getAll("--pack")) {
+        std::vector<LevelConfig*> levelConfigs;
+        if (!LevelPackLoader::loadFromFile(filePath, levelConfigs)) {
+            fprintf(stderr, "failed to load pack %s\n", filePath.c_str());
+            return 1;
+        }
+        
+        for (size_t i = 0; i < levelConfigs.size(); i++) {
+            CompactDeal deal;
+            if (deal.initWithLevelConfig(levelConfigs[i])) {
+                entries.push_back(CatalogEntry());
+                entries.back().name = filePath + "#" + std::to_string(i + 1);
+                CanonicalForm::buildDealForm(deal, entries.back().form);
+            }
+            CORE_SAFE_DELETE(levelConfigs[i]);
+        }
+    }
+    
+    if (entries.empty()) {
+        fprintf(stderr, "no levels, use --level FILE or --pack FILE\n");
+        return 1;
+    }
+    
+    uint64_t start = ToolSupport::nowNanos();
+    
+    // 先按哈希分组，再逐字节比较规范形式，排除哈希碰撞
+    std::unordered_map<uint64_t, std::vector<size_t>> buckets;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const std::vector<uint8_t>& form = entries[i].form;
+        buckets[CanonicalForm::hashBytes(form.data(), form.size())].push_back(i);
+    }
+    
+    int groupCount = 0;
+    int duplicateCount = 0;
+    for (const auto& bucket : buckets) {
+        std::vector<bool> grouped(bucket.second.size(), false);
+        for (size_t a = 0; a < bucket.second.size(); a++) {
+            if (grouped[a]) {
+                continue;
+            }
+            
+            std::vector<size_t> group(1, bucket.second[a]);
+            for (size_t b = a + 1; b < bucket.second.size(); b++) {
+                if (!grouped[b] && entries[bucket.second[b]].form == entries[bucket.second[a]].form) {
+                    grouped[b] = true;
+                    group.push_back(bucket.second[b]);
+                }
+            }
+            if (group.size() < 2) {
+                continue;
+            }
+            
+            groupCount++;
+            duplicateCount += static_cast<int>(group.size()) - 1;
+            printf("%016llx:", (unsigned long long)bucket.first);
+            for (auto index : group) {
+                printf(" %s", entries[index].name.c_str());
+            }
+            printf("\n");
+        }
+    }
+    
+    double seconds = (ToolSupport::nowNanos() - start) / 1e9;
+    printf("%d levels, %d duplicate groups, %d redundant levels, %.3f s\n",
+           static_cast<int>(entries.size()), groupCount, duplicateCount, seconds);
+    
+    return duplicateCount > 0 ? 2 : 0;
+}
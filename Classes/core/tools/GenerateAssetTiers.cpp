@@ -0,0 +1,250 @@
+/**
+ * GenerateAssetTiers.cpp
+ * 从原始图片离线生成各分辨率档位的图片目录，并统计每个档位的纹理内存
+ *
+ * 用法: GenerateAssetTiers [--source Resources/res] [--output Resources] [--tier small --tier medium ...]
+ *                          [--max-width 1080] [--max-height 2080] [--dry-run]
+ * 处理原图目录下的全部PNG（资源清单由各档位目录生成，所以这里不依赖清单）。原图先按轴裁到设计分辨率以内
+ *（超出的只有被拉伸铺满区域的背景），再按档位缩放，用面积平均（预乘透明度）缩小，输出到 output/res-档位/
+ */
+
+#include "ToolSupport.h"
+#include "ResourceScan.h"
+#include "configs/models/CardResConfig.h"
+#include <png.h>
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+/**
+ * RGBA图片，每像素4字节，未预乘透明度
+ */
+struct RgbaImage
+{
+    int width;
+    int height;
+    std::vector<uint8_t> pixels;
+    
+    RgbaImage() : width(0), height(0) {}
+};
+
+/**
+ * 单个档位的统计
+ */
+struct TierStats
+{
+    int images;
+    uint64_t textureBytes;      // 按RGBA8888计算的纹理内存
+    uint64_t fileBytes;         // PNG文件大小
+    
+    TierStats() : images(0), textureBytes(0), fileBytes(0) {}
+};
+
+static bool readPng(const std::string& path, RgbaImage& image)
+{
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&png, path.c_str())) {
+        return false;
+    }
+    
+    png.format = PNG_FORMAT_RGBA;
+    image.width = static_cast<int>(png.width);
+    image.height = static_cast<int>(png.height);
+    image.pixels.resize(PNG_IMAGE_SIZE(png));
+    if (!png_image_finish_read(&png, nullptr, image.pixels.data(), 0, nullptr)) {
+        png_image_free(&png);
+        return false;
+    }
+    return true;
+}
+
+static bool writePng(const std::string& path, const RgbaImage& image)
+{
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    png.width = static_cast<png_uint_32>(image.width);
+    png.height = static_cast<png_uint_32>(image.height);
+    png.format = PNG_FORMAT_RGBA;
+    return png_image_write_to_file(&png, path.c_str(), 0, image.pixels.data(), 0, nullptr) != 0;
+}
+
+static uint64_t getFileSize(const std::string& path)
+{
+    struct stat info;
+    return stat(path.c_str(), &info) == 0 ? static_cast<uint64_t>(info.st_size) : 0;
+}
+
+/**
+ * 创建文件所在的各级目录
+ */
+static void makeParentDirectories(const std::string& filePath)
+{
+    for (size_t pos = filePath.find('/', 1); pos != std::string::npos; pos = filePath.find('/', pos + 1)) {
+        std::string directory = filePath.substr(0, pos);
+#ifdef _WIN32
+        _mkdir(directory.c_str());
+#else
+        mkdir(directory.c_str(), 0755);
+#endif
+    }
+}
+
+/**
+ * 沿一个轴做面积平均：目标像素i覆盖源区间[i*ratio, (i+1)*ratio)，按覆盖长度加权
+ * @param source 源数据，count个元素，相邻元素间隔stride个float，每个元素4个通道
+ * @param target 目标数据，targetCount个元素，间隔同stride
+ */
+static void resampleLine(const float* source, int count, float* target, int targetCount, size_t stride)
+{
+    double ratio = static_cast<double>(count) / targetCount;
+    for (int i = 0; i < targetCount; i++) {
+        double begin = i * ratio;
+        double end = begin + ratio;
+        float sum[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (int s = static_cast<int>(begin); s < count && s < end; s++) {
+            float weight = static_cast<float>(std::min(end, s + 1.0) - std::max(begin, static_cast<double>(s)));
+            const float* pixel = source + s * stride;
+            for (int c = 0; c < 4; c++) {
+                sum[c] += pixel[c] * weight;
+            }
+        }
+        float* out = target + i * stride;
+        for (int c = 0; c < 4; c++) {
+            out[c] = sum[c] / static_cast<float>(ratio);
+        }
+    }
+}
+
+/**
+ * 缩放图片：先按行再按列做面积平均，颜色在预乘透明度后平均，避免透明像素的颜色渗到边缘
+ */
+static void resampleImage(const RgbaImage& source, int width, int height, RgbaImage& target)
+{
+    size_t sourcePixels = static_cast<size_t>(source.width) * source.height;
+    std::vector<float> premultiplied(sourcePixels * 4);
+    for (size_t i = 0; i < sourcePixels; i++) {
+        float alpha = source.pixels[i * 4 + 3] / 255.0f;
+        for (int c = 0; c < 3; c++) {
+            premultiplied[i * 4 + c] = source.pixels[i * 4 + c] * alpha;
+        }
+        premultiplied[i * 4 + 3] = source.pixels[i * 4 + 3];
+    }
+    
+    std::vector<float> rows(static_cast<size_t>(width) * source.height * 4);
+    for (int y = 0; y < source.height; y++) {
+        resampleLine(&premultiplied[static_cast<size_t>(y) * source.width * 4], source.width,
+                     &rows[static_cast<size_t>(y) * width * 4], width, 4);
+    }
+    
+    std::vector<float> scaled(static_cast<size_t>(width) * height * 4);
+    for (int x = 0; x < width; x++) {
+        resampleLine(&rows[x * 4], source.height, &scaled[x * 4], height, static_cast<size_t>(width) * 4);
+    }
+    
+    target.width = width;
+    target.height = height;
+    target.pixels.resize(scaled.size());
+    for (size_t i = 0; i < scaled.size(); i += 4) {
+        float alpha = scaled[i + 3];
+        for (int c = 0; c < 3; c++) {
+            float value = alpha > 0.0f ? scaled[i + c] * 255.0f / alpha : 0.0f;
+            target.pixels[i + c] = static_cast<uint8_t>(std::min(255.0f, value + 0.5f));
+        }
+        target.pixels[i + 3] = static_cast<uint8_t>(std::min(255.0f, alpha + 0.5f));
+    }
+}
+
+static void printStats(const char* name, const TierStats& stats)
+{
+    printf("%-8s %4d images  %9.1f KB texture  %8.1f KB files\n", name, stats.images, stats.textureBytes / 1024.0,
+           stats.fileBytes / 1024.0);
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    std::string sourceDir = args.getString("--source", "Resources/res");
+    std::string outputDir = args.getString("--output", "Resources") + "/";
+    int maxWidth = args.getInt("--max-width", 1080);
+    int maxHeight = args.getInt("--max-height", 2080);
+    bool dryRun = args.hasFlag("--dry-run");
+    
+    std::vector<AssetTierType> tiers;
+    for (const auto& name : args.getAll("--tier")) {
+        AssetTierType tier;
+        if (!CardResConfig::parseAssetTierName(name, tier)) {
+            fprintf(stderr, "bad --tier %s, expected small, medium or large\n", name.c_str());
+            return 1;
+        }
+        tiers.push_back(tier);
+    }
+    if (tiers.empty()) {
+        for (int tier = ATT_SMALL; tier < ATT_NUM_ASSET_TIER_TYPES; tier++) {
+            tiers.push_back(static_cast<AssetTierType>(tier));
+        }
+    }
+    
+    std::vector<std::string> files;
+    if (!ResourceScan::listFiles(sourceDir, files)) {
+        fprintf(stderr, "failed to read %s\n", sourceDir.c_str());
+        return 1;
+    }
+    std::vector<std::string> names;
+    for (const auto& file : files) {
+        if (ResourceScan::hasSuffix(file, ".png")) {
+            names.push_back(file);
+        }
+    }
+    
+    TierStats sourceStats;
+    std::vector<TierStats> tierStats(tiers.size());
+    for (const auto& name : names) {
+        RgbaImage source;
+        std::string sourcePath = sourceDir + "/" + name;
+        if (!readPng(sourcePath, source)) {
+            fprintf(stderr, "failed to read %s\n", sourcePath.c_str());
+            return 1;
+        }
+        sourceStats.images++;
+        sourceStats.textureBytes += static_cast<uint64_t>(source.width) * source.height * 4;
+        sourceStats.fileBytes += getFileSize(sourcePath);
+        
+        int baseWidth = std::min(source.width, maxWidth);
+        int baseHeight = std::min(source.height, maxHeight);
+        for (size_t i = 0; i < tiers.size(); i++) {
+            float scale = CardResConfig::getAssetTierScale(tiers[i]);
+            int width = std::max(1, static_cast<int>(lround(baseWidth * scale)));
+            int height = std::max(1, static_cast<int>(lround(baseHeight * scale)));
+            tierStats[i].images++;
+            tierStats[i].textureBytes += static_cast<uint64_t>(width) * height * 4;
+            if (dryRun) {
+                continue;
+            }
+            
+            RgbaImage target;
+            resampleImage(source, width, height, target);
+            std::string targetPath = outputDir + CardResConfig::getAssetTierDirectory(tiers[i]) + name;
+            makeParentDirectories(targetPath);
+            if (!writePng(targetPath, target)) {
+                fprintf(stderr, "failed to write %s\n", targetPath.c_str());
+                return 1;
+            }
+            tierStats[i].fileBytes += getFileSize(targetPath);
+        }
+    }
+    
+    printStats("source", sourceStats);
+    for (size_t i = 0; i < tiers.size(); i++) {
+        printStats(CardResConfig::getAssetTierName(tiers[i]).c_str(), tierStats[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * GenerateLevels.cpp
+ * 批量生成必然可解的关卡
+ *
+ * 用法: GenerateLevels [--count 1000] [--threads 0] [--seed 1]
+ *                      [--template grid:3x4:20]... [--template-level FILE[:STACK]]...
+ *                      [--min-difficulty 0] [--max-difficulty 1] [--playouts 64]
+ *                      [--out-dir DIR] [--start-id 1] [--pack FILE] [--par]
+ * --out-dir 输出 level_<id>.json（含Meta字段），--pack 输出二进制关卡包，
+ * --par 同时计算标准杆写入Meta（解法替换为达到标准杆的操作序列）
+ */
+
+#include "ToolSupport.h"
+#include "core/CoreMacros.h"
+#include "core/generator/SolvableLevelGenerator.h"
+#include "core/generator/LevelExporter.h"
+#include "core/solver/ParSolver.h"
+#include <fstream>
+#include <stdio.h>
+
+#if CARDCORE_HAS_JSON
+#include "configs/loaders/LevelConfigLoader.h"
+#endif
+
+/**
+ * 解析模板参数
+ */
+static bool parseTemplates(const ToolArgs& args, std::vector<LevelTemplate>& templates)
+{
+    for (const auto& spec : args.getAll("--template")) {
+        LevelTemplate levelTemplate;
+        if (!LevelTemplate::parseSpec(spec, levelTemplate)) {
+            fprintf(stderr, "bad template %s, expected grid:ROWSxCOLS:STACK\n", spec.c_str());
+            return false;
+        }
+        templates.push_back(levelTemplate);
+    }
+    
+    for (const auto& spec : args.getAll("--template-level")) {
+#if CARDCORE_HAS_JSON
+        std::string filePath = spec;
+        int stackCount = 0;
+        size_t colon = spec.rfind(':');
+        if (colon != std::string::npos) {
+            filePath = spec.substr(0, colon);
+            stackCount = atoi(spec.c_str() + colon + 1);
+        }
+        
+        LevelConfig* levelConfig = LevelConfigLoader::loadLevelConfigFromFile(filePath);
+        if (!levelConfig) {
+            fprintf(stderr, "failed to load template level %s\n", filePath.c_str());
+            return false;
+        }
+        templates.push_back(LevelTemplate::createFromLevelConfig(spec, levelConfig, stackCount));
+        CORE_SAFE_DELETE(levelConfig);
+#else
+        fprintf(stderr, "cardcore was built without LevelConfigLoader, cannot read %s\n", spec.c_str());
+        return false;
+#endif
+    }
+    
+    if (templates.empty()) {
+        templates.push_back(LevelTemplate::createGrid("grid:3x4:20", 3, 4, 20));
+    }
+    
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    std::vector<LevelTemplate> templates;
+    if (!parseTemplates(args, templates)) {
+        return 1;
+    }
+    
+    LevelGenerationOptions options;
+    options.levelCount = args.getInt("--count", 1000);
+    options.threadCount = args.getInt("--threads", 0);
+    options.seed = static_cast<uint64_t>(args.getInt("--seed", 1));
+    options.minDifficulty = static_cast<float>(args.getDouble("--min-difficulty", 0.0));
+    options.maxDifficulty = static_cast<float>(args.getDouble("--max-difficulty", 1.0));
+    options.playouts = args.getInt("--playouts", 64);
+    
+    std::vector<GeneratedLevel> levels;
+    LevelGenerationStats stats;
+    
+    uint64_t start = ToolSupport::nowNanos();
+    bool complete = SolvableLevelGenerator::generate(templates, options, levels, &stats);
+    double seconds = (ToolSupport::nowNanos() - start) / 1e9;
+    
+    printf("levels:            %d / %d\n", static_cast<int>(levels.size()), options.levelCount);
+    printf("attempts:          %llu\n", (unsigned long long)stats.attempts);
+    printf("duplicates:        %llu\n", (unsigned long long)stats.duplicates);
+    printf("out of difficulty: %llu\n", (unsigned long long)stats.outOfDifficulty);
+    printf("levels/sec:        %.0f\n", seconds > 0 ? levels.size() / seconds : 0.0);
+    
+    std::string outDir = args.getString("--out-dir", "");
+    if (!outDir.empty()) {
+        int startId = args.getInt("--start-id", 1);
+        ParSolver parSolver;
+        bool computePar = args.hasFlag("--par") && parSolver.init(args.getInt("--table-bits", 20));
+        for (size_t i = 0; i < levels.size(); i++) {
+            char fileName[64];
+            snprintf(fileName, sizeof(fileName), "/level_%d.json", startId + static_cast<int>(i));
+            std::ofstream output((outDir + fileName).c_str());
+            if (!output) {
+                fprintf(stderr, "failed to write %s%s\n", outDir.c_str(), fileName);
+                return 1;
+            }
+            
+            LevelMetadata metadata;
+            metadata.hash = levels[i].hash;
+            metadata.difficulty = levels[i].difficulty;
+            metadata.solution = levels[i].solution;
+            
+            CompactDeal deal;
+            ParResult parResult;
+            if (computePar && deal.initWithLevelConfig(&levels[i].config)
+                && parSolver.solve(deal, parResult) && parResult.status == PS_OPTIMAL) {
+                metadata.parDraws = parResult.parDraws;
+                metadata.parMoves = parResult.parMoves;
+                metadata.solution = parResult.line;
+            }
+            LevelExporter::writeJson(levels[i].config, &metadata, output);
+        }
+    }
+    
+    std::string packFile = args.getString("--pack", "");
+    if (!packFile.empty()) {
+        std::vector<const LevelConfig*> configs;
+        for (const auto& level : levels) {
+            configs.push_back(&level.config);
+        }
+        
+        std::ofstream output(packFile.c_str(), std::ios::out | std::ios::binary);
+        LevelExporter::writePack(configs, output);
+        if (!output) {
+            fprintf(stderr, "failed to write %s\n", packFile.c_str());
+            return 1;
+        }
+    }
+    
+    return complete ? 0 : 2;
+}
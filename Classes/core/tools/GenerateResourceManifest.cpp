@@ -0,0 +1,353 @@
+/**
+ * GenerateResourceManifest.cpp
+ * 扫描Resources/，校验代码引用的资源都存在，生成constexpr资源清单 configs/models/ResourceManifest.h
+ *
+ * 用法: GenerateResourceManifest --resources Resources --output Classes/configs/models/ResourceManifest.h
+ * 作为构建步骤在cardcore之前运行：缺少任何资源（原图、任一档位的图片或字体）时返回1，构建失败；
+ * 清单内容没有变化时不改写文件，避免触发重新编译。档位目录中存在但清单未引用的文件只给出警告
+ */
+
+#include "ResourceScan.h"
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// 档位名称，顺序与AssetTierType一致，目录为"res-名称/"
+static const char* const TIER_NAMES[] = { "small", "medium", "large" };
+static const int TIER_COUNT = sizeof(TIER_NAMES) / sizeof(TIER_NAMES[0]);
+
+// 原图目录
+static const char* const SOURCE_DIRECTORY = "res/";
+
+// 花色，顺序与CardSuitType一致
+static const char* const SUIT_NAMES[] = { "clubs", "diamonds", "hearts", "spades" };
+static const int SUIT_COUNT = sizeof(SUIT_NAMES) / sizeof(SUIT_NAMES[0]);
+
+// 面值，顺序与CardFaceType一致
+static const char* const FACE_NAMES[] = { "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K" };
+static const int FACE_COUNT = sizeof(FACE_NAMES) / sizeof(FACE_NAMES[0]);
+
+/**
+ * 清单项
+ */
+struct ManifestEntry
+{
+    std::string identifier;     // 枚举名
+    std::string name;           // 图片相对档位目录，其余相对Resources/
+    bool tiered;                // 是否按档位存放
+    uint32_t hash;              // 名称的FNV-1a哈希
+};
+
+/**
+ * FNV-1a 32位哈希，与生成的hashResourceName一致
+ */
+static uint32_t hashName(const std::string& name)
+{
+    uint32_t hash = 2166136261u;
+    for (unsigned char c : name) {
+        hash = (hash ^ c) * 16777619u;
+    }
+    return hash;
+}
+
+static std::string toIdentifier(const std::string& text)
+{
+    std::string identifier;
+    for (char c : text) {
+        if (c >= 'a' && c <= 'z') {
+            identifier += static_cast<char>(c - 'a' + 'A');
+        } else if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+            identifier += c;
+        } else {
+            identifier += '_';
+        }
+    }
+    return identifier;
+}
+
+static void addEntry(std::vector<ManifestEntry>& entries, const std::string& identifier, const std::string& name,
+                     bool tiered)
+{
+    ManifestEntry entry;
+    entry.identifier = "RID_" + identifier;
+    entry.name = name;
+    entry.tiered = tiered;
+    entry.hash = hashName(name);
+    entries.push_back(entry);
+}
+
+/**
+ * 代码引用的全部资源：不分档位的资源在前，图片在后
+ */
+static void buildEntries(std::vector<ManifestEntry>& entries)
+{
+    addEntry(entries, "FONT_MARKER_FELT", "fonts/Marker Felt.ttf", false);
+    
+    addEntry(entries, "CARD_GENERAL", "card_general.png", true);
+    addEntry(entries, "DESK_SCENE", "desk_scene.png", true);
+    addEntry(entries, "HAND_SCENE", "hand_scene.png", true);
+    for (int suit = 0; suit < SUIT_COUNT; suit++) {
+        addEntry(entries, "SUIT_" + toIdentifier(SUIT_NAMES[suit]), std::string("suits/") + SUIT_NAMES[suit] + ".png",
+                 true);
+    }
+    for (int small = 0; small < 2; small++) {
+        for (int red = 0; red < 2; red++) {
+            std::string prefix = std::string(small ? "small_" : "big_") + (red ? "red_" : "black_");
+            for (int face = 0; face < FACE_COUNT; face++) {
+                std::string name = prefix + FACE_NAMES[face];
+                addEntry(entries, "NUMBER_" + toIdentifier(name), "number/" + name + ".png", true);
+            }
+        }
+    }
+}
+
+static std::string tierDirectory(int tier)
+{
+    return std::string("res-") + TIER_NAMES[tier] + "/";
+}
+
+static std::string pathInTier(const ManifestEntry& entry, int tier)
+{
+    return entry.tiered ? tierDirectory(tier) + entry.name : entry.name;
+}
+
+/**
+ * 校验资源：缺少的文件与哈希冲突是错误，未被引用的档位文件是警告
+ * @return 错误数
+ */
+static int checkResources(const std::vector<ManifestEntry>& entries, const std::vector<std::string>& files)
+{
+    std::set<std::string> present(files.begin(), files.end());
+    std::set<std::string> referenced;
+    int errors = 0;
+    
+    for (const auto& entry : entries) {
+        std::vector<std::string> required;
+        if (entry.tiered) {
+            required.push_back(SOURCE_DIRECTORY + entry.name);
+            for (int tier = 0; tier < TIER_COUNT; tier++) {
+                required.push_back(pathInTier(entry, tier));
+            }
+        } else {
+            required.push_back(entry.name);
+        }
+        for (const auto& path : required) {
+            referenced.insert(path);
+            if (!present.count(path)) {
+                fprintf(stderr, "error: missing resource %s (%s)\n", path.c_str(), entry.identifier.c_str());
+                errors++;
+            }
+        }
+    }
+    
+    for (size_t i = 0; i < entries.size(); i++) {
+        for (size_t j = i + 1; j < entries.size(); j++) {
+            if (entries[i].hash == entries[j].hash) {
+                fprintf(stderr, "error: hash collision between %s and %s\n", entries[i].name.c_str(),
+                        entries[j].name.c_str());
+                errors++;
+            }
+        }
+    }
+    
+    for (const auto& path : files) {
+        if (path.compare(0, 4, "res-") == 0 && !referenced.count(path)) {
+            fprintf(stderr, "warning: %s is not referenced by the manifest\n", path.c_str());
+        }
+    }
+    return errors;
+}
+
+static std::string generateHeader(const std::vector<ManifestEntry>& entries)
+{
+    std::ostringstream out;
+    out << "/**\n";
+    out << " * ResourceManifest.h\n";
+    out << " * 资源清单：由GenerateResourceManifest扫描Resources/生成，不要手工修改\n";
+    out << " */\n";
+    out << "\n";
+    out << "#ifndef __RESOURCE_MANIFEST_H__\n";
+    out << "#define __RESOURCE_MANIFEST_H__\n";
+    out << "\n";
+    out << "#include <stdint.h>\n";
+    out << "\n";
+    out << "/**\n";
+    out << " * 资源ID，即清单数组的下标\n";
+    out << " */\n";
+    out << "enum ResourceId\n";
+    out << "{\n";
+    for (const auto& entry : entries) {
+        char line[160];
+        snprintf(line, sizeof(line), "    %-32s // %s\n", (entry.identifier + ",").c_str(), entry.name.c_str());
+        out << line;
+    }
+    out << "    RID_NUM_RESOURCES\n";
+    out << "};\n";
+    out << "\n";
+    
+    int firstImage = 0;
+    while (firstImage < static_cast<int>(entries.size()) && !entries[firstImage].tiered) {
+        firstImage++;
+    }
+    out << "// 第一张按档位存放的图片，此前的资源（字体）不分档位\n";
+    out << "const ResourceId RID_FIRST_IMAGE = " << entries[firstImage].identifier << ";\n";
+    out << "\n";
+    out << "// 档位数，顺序与AssetTierType一致\n";
+    out << "const int RESOURCE_TIER_COUNT = " << TIER_COUNT << ";\n";
+    out << "\n";
+    out << "/**\n";
+    out << " * 清单项\n";
+    out << " */\n";
+    out << "struct ResourceEntry\n";
+    out << "{\n";
+    out << "    uint32_t hash;          // 名称的FNV-1a哈希，跨平台稳定，可在日志与持久化数据中代替名称\n";
+    out << "    const char* name;       // 名称，图片相对档位目录，其余相对Resources/\n";
+    out << "};\n";
+    out << "\n";
+    out << "constexpr ResourceEntry RESOURCE_ENTRIES[RID_NUM_RESOURCES] = {\n";
+    for (const auto& entry : entries) {
+        char line[160];
+        snprintf(line, sizeof(line), "    { 0x%08xu, \"%s\" },\n", entry.hash, entry.name.c_str());
+        out << line;
+    }
+    out << "};\n";
+    out << "\n";
+    out << "// 各档位下的完整路径，按[档位][资源ID]索引\n";
+    out << "constexpr const char* RESOURCE_PATHS[RESOURCE_TIER_COUNT][RID_NUM_RESOURCES] = {\n";
+    for (int tier = 0; tier < TIER_COUNT; tier++) {
+        out << "    {\n";
+        for (const auto& entry : entries) {
+            out << "        \"" << pathInTier(entry, tier) << "\",\n";
+        }
+        out << "    },\n";
+    }
+    out << "};\n";
+    out << "\n";
+    out << "// 花色图片，按CardSuitType索引\n";
+    out << "constexpr ResourceId CARD_SUIT_RESOURCES[" << SUIT_COUNT << "] = {\n";
+    for (int suit = 0; suit < SUIT_COUNT; suit++) {
+        out << "    RID_SUIT_" << toIdentifier(SUIT_NAMES[suit]) << ",\n";
+    }
+    out << "};\n";
+    out << "\n";
+    out << "// 数字图片，按[是否小数字][是否红色][CardFaceType]索引\n";
+    out << "constexpr ResourceId CARD_NUMBER_RESOURCES[2][2][" << FACE_COUNT << "] = {\n";
+    for (int small = 0; small < 2; small++) {
+        out << "    {\n";
+        for (int red = 0; red < 2; red++) {
+            std::string prefix = std::string(small ? "SMALL_" : "BIG_") + (red ? "RED_" : "BLACK_");
+            out << "        {";
+            for (int face = 0; face < FACE_COUNT; face++) {
+                out << (face % 4 == 0 ? "\n            " : " ");
+                out << "RID_NUMBER_" << prefix << toIdentifier(FACE_NAMES[face]) << ",";
+            }
+            out << "\n        },\n";
+        }
+        out << "    },\n";
+    }
+    out << "};\n";
+    out << "\n";
+    out << "/**\n";
+    out << " * 资源名称的FNV-1a哈希，可在编译期计算\n";
+    out << " * @param name 资源名称\n";
+    out << " * @return 哈希\n";
+    out << " */\n";
+    out << "constexpr uint32_t hashResourceName(const char* name, uint32_t hash = 2166136261u)\n";
+    out << "{\n";
+    out << "    return *name ? hashResourceName(name + 1, (hash ^ static_cast<uint8_t>(*name)) * 16777619u) : hash;\n";
+    out << "}\n";
+    out << "\n";
+    out << "/**\n";
+    out << " * 校验清单中的哈希与hashResourceName一致\n";
+    out << " */\n";
+    out << "constexpr bool checkResourceHashes(int index = 0)\n";
+    out << "{\n";
+    out << "    return index == RID_NUM_RESOURCES ||\n";
+    out << "           (RESOURCE_ENTRIES[index].hash == hashResourceName(RESOURCE_ENTRIES[index].name) &&\n";
+    out << "            checkResourceHashes(index + 1));\n";
+    out << "}\n";
+    out << "\n";
+    out << "static_assert(checkResourceHashes(), \"resource manifest hashes are stale, rerun GenerateResourceManifest\");\n";
+    out << "\n";
+    out << "#endif // __RESOURCE_MANIFEST_H__\n";
+    return out.str();
+}
+
+/**
+ * 内容有变化时才写文件，沿用已有文件的换行风格
+ */
+static bool writeIfChanged(const std::string& path, const std::string& content, bool& changed)
+{
+    std::string existing;
+    std::ifstream in(path.c_str(), std::ios::in | std::ios::binary);
+    if (in) {
+        std::ostringstream buffer;
+        buffer << in.rdbuf();
+        existing = buffer.str();
+    }
+    
+    std::string output = content;
+    if (existing.find("\r\n") != std::string::npos) {
+        output.clear();
+        for (char c : content) {
+            if (c == '\n') {
+                output += '\r';
+            }
+            output += c;
+        }
+    }
+    
+    changed = output != existing;
+    if (!changed) {
+        return true;
+    }
+    std::ofstream out(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    out << output;
+    return static_cast<bool>(out);
+}
+
+int main(int argc, char** argv)
+{
+    // 不链接核心库（核心库依赖本工具的输出），参数自行解析
+    std::string resourcesDir = "Resources";
+    std::string outputPath;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--resources") == 0) {
+            resourcesDir = argv[i + 1];
+        } else if (strcmp(argv[i], "--output") == 0) {
+            outputPath = argv[i + 1];
+        }
+    }
+    
+    std::vector<std::string> files;
+    if (!ResourceScan::listFiles(resourcesDir, files)) {
+        fprintf(stderr, "error: cannot read resource directory %s\n", resourcesDir.c_str());
+        return 1;
+    }
+    
+    std::vector<ManifestEntry> entries;
+    buildEntries(entries);
+    int errors = checkResources(entries, files);
+    if (errors > 0) {
+        fprintf(stderr, "resource manifest: %d error(s) in %s\n", errors, resourcesDir.c_str());
+        return 1;
+    }
+    
+    if (outputPath.empty()) {
+        printf("resource manifest: %d resources, %d files scanned\n", static_cast<int>(entries.size()),
+               static_cast<int>(files.size()));
+        return 0;
+    }
+    
+    bool changed = false;
+    if (!writeIfChanged(outputPath, generateHeader(entries), changed)) {
+        fprintf(stderr, "error: cannot write %s\n", outputPath.c_str());
+        return 1;
+    }
+    printf("resource manifest: %d resources, %s\n", static_cast<int>(entries.size()),
+           changed ? "written" : "up to date");
+    return 0;
+}
@@ -0,0 +1,218 @@
+/**
+ * ReplayBatchVerifier.cpp
+ * 批量校验排行榜提交
+ *
+ * 用法: ReplayBatchVerifier [--level FILE]... [--random-deal 20,24] [--threads 0] [--batch 50000]
+ *                           [--input FILE|-] [--verdicts FILE]
+ *                           [--template grid:3x4:20 [--shuffle deck] [--decks 0] [--template-seeds 16]]
+ *                           [--generate 50000 --tamper 10 --write FILE] [--repeat 1]
+ * 关卡ID按 --level 出现顺序从1开始编号，种子固定为0；--template 注册为其后的一个种子关卡，
+ * 任意64位种子的提交都按模板展开校验
+ * --generate 按随机策略生成合法提交并按比例篡改，用于压测；带 --template 时另外为种子关卡的
+ * --template-seeds 个种子生成提交
+ */
+
+#include "ToolSupport.h"
+#include "core/verify/ReplayVerifier.h"
+#include "core/server/SessionRecording.h"
+#include "core/generator/DealShuffler.h"
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdio.h>
+
+static const char* VERDICT_NAMES[RVC_NUM_VERDICT_CODES] = {
+    "accepted", "malformed", "unknown_level", "illegal_move", "result_mismatch"
+};
+
+/**
+ * 生成提交用的牌局
+ */
+struct SubmissionTarget
+{
+    uint32_t levelId;       // 关卡ID
+    uint64_t seed;          // 发牌种子
+    CompactDeal deal;       // 牌局
+};
+
+/**
+ * 生成压测用的提交，tamperPercent比例的提交被篡改
+ */
+static void generateSubmissions(const std::vector<SubmissionTarget>& targets, int count, int tamperPercent,
+                                uint32_t seed, ReplaySubmissionBatch& batch)
+{
+    std::mt19937 rng(seed);
+    CompactGameState state;
+    
+    for (size_t d = 0; d < targets.size(); d++) {
+        const SubmissionTarget& target = targets[d];
+        std::vector<RecordedSession> sessions;
+        int dealCount = count / static_cast<int>(targets.size()) + (d == 0 ? count % targets.size() : 0);
+        SessionRecording::generateRandomSessions(target.deal, target.levelId, dealCount, 200,
+                                                 seed + static_cast<uint32_t>(d), sessions);
+        
+        for (auto& session : sessions) {
+            // 重放得到真实结果
+            state.reset(&target.deal);
+            for (int32_t move : session.moves) {
+                if (move == SessionRecording::MOVE_UNDO) {
+                    state.undo();
+                } else {
+                    state.applyMove(move);
+                }
+            }
+            
+            ClaimedResult claimed;
+            claimed.won = state.isGameWon() ? 1 : 0;
+            claimed.playfieldRemaining = static_cast<uint16_t>(state.getPlayfieldRemaining());
+            claimed.moveCount = static_cast<uint32_t>(state.getHistory().size());
+            
+            if (static_cast<int>(rng() % 100) < tamperPercent) {
+                if (rng() % 2 == 0 || session.moves.empty()) {
+                    claimed.won = 1;
+                    claimed.playfieldRemaining = 0;
+                } else {
+                    session.moves[rng() % session.moves.size()] = static_cast<int32_t>(rng() % 200);
+                }
+            }
+            
+            batch.addSubmission(session.levelId, target.seed, session.moves.data(),
+                                static_cast<uint32_t>(session.moves.size()), claimed);
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    std::vector<CompactDeal> deals;
+    if (!ToolSupport::loadDealsFromArgs(args, deals)) {
+        return 1;
+    }
+    
+    ReplayVerifier verifier;
+    std::vector<SubmissionTarget> targets;
+    for (size_t i = 0; i < deals.size(); i++) {
+        verifier.registerDeal(static_cast<uint32_t>(i + 1), 0, deals[i]);
+        targets.push_back(SubmissionTarget());
+        targets.back().levelId = static_cast<uint32_t>(i + 1);
+        targets.back().seed = 0;
+        targets.back().deal = deals[i];
+    }
+    
+    // 种子关卡只注册模板，校验时按提交的种子展开
+    std::string spec = args.getString("--template", "");
+    if (!spec.empty()) {
+        LevelTemplate levelTemplate;
+        DealShuffleParams params;
+        std::string modeName = args.getString("--shuffle", "deck");
+        if (!LevelTemplate::parseSpec(spec, levelTemplate) || !DealShuffler::parseMode(modeName, params.mode)) {
+            fprintf(stderr, "bad template %s or shuffle mode %s\n", spec.c_str(), modeName.c_str());
+            return 1;
+        }
+        params.deckCount = args.getInt("--decks", 0);
+        uint32_t levelId = static_cast<uint32_t>(deals.size() + 1);
+        verifier.registerTemplate(levelId, levelTemplate, params);
+        
+        // 压测用的种子取满64位
+        int seedCount = args.getInt("--template-seeds", 16);
+        LevelConfig levelConfig;
+        for (int i = 0; i < seedCount; i++) {
+            SubmissionTarget target;
+            target.levelId = levelId;
+            target.seed = 0x9E3779B97F4A7C15ULL * static_cast<uint64_t>(i + 1);
+            if (DealShuffler::shuffleLevel(levelTemplate, target.seed, params, levelConfig) &&
+                target.deal.initWithLevelConfig(&levelConfig)) {
+                targets.push_back(target);
+            }
+        }
+    }
+    verifier.start(args.getInt("--threads", 0));
+    
+    ReplaySubmissionBatch batch;
+    std::vector<ReplayVerdict> verdicts;
+    uint64_t counts[RVC_NUM_VERDICT_CODES] = {0};
+    uint64_t totalSubmissions = 0;
+    uint64_t totalNanos = 0;
+    
+    std::string verdictFile = args.getString("--verdicts", "");
+    std::ofstream verdictOutput;
+    if (!verdictFile.empty()) {
+        verdictOutput.open(verdictFile.c_str());
+    }
+    
+    int generateCount = args.getInt("--generate", 0);
+    if (generateCount > 0) {
+        generateSubmissions(targets, generateCount, args.getInt("--tamper", 10),
+                            static_cast<uint32_t>(args.getInt("--seed", 1)), batch);
+        
+        std::string writeFile = args.getString("--write", "");
+        if (!writeFile.empty()) {
+            std::ofstream output(writeFile.c_str());
+            for (size_t i = 0; i < batch.size(); i++) {
+                batch.writeSubmission(output, i);
+            }
+        }
+        
+        // 重复校验同一批次以测量稳定吞吐
+        int repeat = args.getInt("--repeat", 1);
+        for (int r = 0; r < repeat; r++) {
+            uint64_t start = ToolSupport::nowNanos();
+            verifier.verifyBatch(batch, verdicts);
+            totalNanos += ToolSupport::nowNanos() - start;
+            totalSubmissions += verdicts.size();
+            for (const auto& verdict : verdicts) {
+                counts[verdict.code]++;
+            }
+        }
+    } else {
+        std::string inputFile = args.getString("--input", "-");
+        std::ifstream fileInput;
+        if (inputFile != "-") {
+            fileInput.open(inputFile.c_str());
+            if (!fileInput) {
+                fprintf(stderr, "failed to open %s\n", inputFile.c_str());
+                return 1;
+            }
+        }
+        std::istream& input = inputFile == "-" ? std::cin : fileInput;
+        
+        size_t batchSize = static_cast<size_t>(args.getInt("--batch", 50000));
+        while (true) {
+            batch.clear();
+            if (batch.readFromStream(input, batchSize) == 0) {
+                break;
+            }
+            
+            uint64_t start = ToolSupport::nowNanos();
+            verifier.verifyBatch(batch, verdicts);
+            totalNanos += ToolSupport::nowNanos() - start;
+            totalSubmissions += verdicts.size();
+            
+            for (const auto& verdict : verdicts) {
+                counts[verdict.code]++;
+                if (verdictOutput) {
+                    verdictOutput << VERDICT_NAMES[verdict.code];
+                    if (verdict.code == RVC_ILLEGAL_MOVE) {
+                        verdictOutput << " " << verdict.moveIndex;
+                    }
+                    verdictOutput << "\n";
+                }
+            }
+        }
+    }
+    
+    printf("threads:             %d\n", verifier.getThreadCount());
+    printf("submissions:         %llu\n", (unsigned long long)totalSubmissions);
+    for (int i = 0; i < RVC_NUM_VERDICT_CODES; i++) {
+        printf("  %-18s %llu\n", VERDICT_NAMES[i], (unsigned long long)counts[i]);
+    }
+    double seconds = totalNanos / 1e9;
+    printf("submissions/sec:     %.0f\n", seconds > 0 ? totalSubmissions / seconds : 0.0);
+    printf("us per verdict:      %.3f (wall time / submissions)\n",
+           totalSubmissions > 0 ? totalNanos / 1000.0 / totalSubmissions : 0.0);
+    
+    verifier.stop();
+    return 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * ResourceScan.h
+ * 资源目录扫描，供资源相关的离线工具使用（不依赖核心库）
+ */
+
+#ifndef __RESOURCE_SCAN_H__
+#define __RESOURCE_SCAN_H__
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+/**
+ * 资源扫描类
+ */
+class ResourceScan
+{
+public:
+    /**
+     * 递归列出目录下的全部文件
+     * @param root 根目录
+     * @param files 输出相对根目录的文件路径（以"/"分隔，已排序）
+     * @return 根目录能否打开
+     */
+    static bool listFiles(const std::string& root, std::vector<std::string>& files)
+    {
+        files.clear();
+        if (!listDirectory(root, "", files)) {
+            return false;
+        }
+        std::sort(files.begin(), files.end());
+        return true;
+    }
+    
+    /**
+     * 判断路径是否以指定后缀结尾
+     */
+    static bool hasSuffix(const std::string& path, const std::string& suffix)
+    {
+        return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+    
+private:
+    static bool listDirectory(const std::string& root, const std::string& relative, std::vector<std::string>& files)
+    {
+        std::string directory = relative.empty() ? root : root + "/" + relative;
+#ifdef _WIN32
+        WIN32_FIND_DATAA entry;
+        HANDLE handle = FindFirstFileA((directory + "/*").c_str(), &entry);
+        if (handle == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        do {
+            std::string name = entry.cFileName;
+            if (name == "." || name == "..") {
+                continue;
+            }
+            std::string path = relative.empty() ? name : relative + "/" + name;
+            if (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+                listDirectory(root, path, files);
+            } else {
+                files.push_back(path);
+            }
+        } while (FindNextFileA(handle, &entry));
+        FindClose(handle);
+#else
+        DIR* dir = opendir(directory.c_str());
+        if (!dir) {
+            return false;
+        }
+        while (struct dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name == "." || name == "..") {
+                continue;
+            }
+            std::string path = relative.empty() ? name : relative + "/" + name;
+            struct stat info;
+            if (stat((root + "/" + path).c_str(), &info) != 0) {
+                continue;
+            }
+            if (S_ISDIR(info.st_mode)) {
+                listDirectory(root, path, files);
+            } else {
+                files.push_back(path);
+            }
+        }
+        closedir(dir);
+#endif
+        return true;
+    }
+};
+
+#endif // __RESOURCE_SCAN_H__
@@ -0,0 +1,451 @@
+/**
+ * RunBenchmarks.cpp
+ * 游戏热点路径的微基准：关卡解析、模型生成、走子与回退、回退记录增长、卡牌资源路径
+ *
+ * 用法: RunBenchmarks [--filter NAME]... [--samples 30] [--min-sample-ms 5] [--runs 5] [--output results.json]
+ *                     [--baseline base.json]... [--threshold 0.05]
+ *       RunBenchmarks --compare base.json... --with current.json... [--threshold 0.05]
+ *
+ * --filter 只运行名称包含该子串的基准（可重复）；--output 把结果写成JSON；
+ * --runs 大于1时以子进程把全部基准运行多次并合并，结果中记录各次中位数的极差；
+ * --baseline 运行后与基线文件比较，--compare/--with 只比较已有的结果文件，重复给出的文件按多次运行合并。
+ * 比较时中位数变化超过阈值加上运行间极差记为退化，存在退化时返回1。
+ * 卡牌视图的基准在游戏工程中运行（见ViewBenchmarks），结果格式相同，可以用本工具比较
+ */
+
+#include "ToolSupport.h"
+#include "core/profile/MicroBenchmark.h"
+#include "core/generator/DealShuffler.h"
+#include "core/generator/LevelExporter.h"
+#include "core/rules/CompactGameState.h"
+#include "configs/models/CardResConfig.h"
+#include "models/UndoModel.h"
+#include "services/GameModelFromLevelGenerator.h"
+#include <iostream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+#if CARDCORE_HAS_JSON
+#include "configs/loaders/LevelConfigLoader.h"
+#endif
+
+// 小关卡与默认关卡规模相当，大关卡用来观察卡牌数量对解析与生成的影响
+static const char* const SMALL_LEVEL_SPEC = "grid:4x5:24";
+static const char* const HUGE_LEVEL_SPEC = "grid:16x16:144";
+
+// 回退记录增长基准每次追加的记录数
+static const int UNDO_GROWTH_RECORDS = 1000;
+
+// 默认的进程运行次数；进程之间的差异（内存布局、CPU频率）常大于同一进程内的置信区间
+static const int DEFAULT_RUNS = 5;
+
+/**
+ * 基准运行环境
+ */
+struct BenchContext
+{
+    std::vector<std::string> filters;
+    BenchmarkOptions options;
+    std::vector<BenchmarkResult> results;
+};
+
+/**
+ * 名称匹配过滤条件时运行基准并打印结果
+ */
+static void runCase(BenchContext& context, const std::string& name, const MicroBenchmark::Body& body,
+                    const MicroBenchmark::Body& setup = MicroBenchmark::Body())
+{
+    if (!context.filters.empty()) {
+        bool matched = false;
+        for (const auto& filter : context.filters) {
+            matched = matched || name.find(filter) != std::string::npos;
+        }
+        if (!matched) {
+            return;
+        }
+    }
+    
+    BenchmarkResult result;
+    MicroBenchmark::run(name, body, context.options, result, setup);
+    printf("%-32s %14.1f ns  [%.1f, %.1f]  x%llu\n", name.c_str(), result.meanNanos, result.ciLowNanos,
+           result.ciHighNanos, static_cast<unsigned long long>(result.iterations));
+    fflush(stdout);
+    context.results.push_back(result);
+}
+
+/**
+ * 释放游戏模型，连同析构函数不负责的手牌区卡牌
+ */
+static void releaseGameModel(GameModel* model)
+{
+    CardModel* trayTopCard = model->getTrayTopCard();
+    model->setTrayTopCardDirectly(nullptr);
+    delete trayTopCard;
+    delete model;
+}
+
+/**
+ * 按模板展开关卡
+ */
+static bool makeLevel(const char* spec, LevelConfig& levelConfig)
+{
+    LevelTemplate levelTemplate;
+    return LevelTemplate::parseSpec(spec, levelTemplate) &&
+           DealShuffler::shuffleLevel(levelTemplate, 1, DealShuffleParams(), levelConfig);
+}
+
+/**
+ * 按随机策略生成一局不含回退的操作序列
+ */
+static void makeScript(const LevelConfig& levelConfig, std::vector<int>& script)
+{
+    CompactDeal deal;
+    CompactGameState state;
+    script.clear();
+    if (!deal.initWithLevelConfig(&levelConfig)) {
+        return;
+    }
+    state.reset(&deal);
+    
+    uint64_t random = 1;
+    std::vector<int> moves;
+    while (true) {
+        moves.clear();
+        for (int i = 0; i < deal.getPlayfieldCount(); i++) {
+            if (state.canMoveCardFromPlayfieldToTray(i)) {
+                moves.push_back(i);
+            }
+        }
+        if (moves.empty() && state.canDrawCardFromStack()) {
+            moves.push_back(CompactGameState::MOVE_DRAW);
+        }
+        if (moves.empty()) {
+            break;
+        }
+        
+        random = random * 6364136223846793005ull + 1442695040888963407ull;
+        int move = moves[(random >> 33) % moves.size()];
+        state.applyMove(move);
+        script.push_back(move);
+    }
+}
+
+/**
+ * 关卡解析（JSON文本由LevelExporter写出）与模型生成，模型生成包含释放
+ */
+static void runLevelBenchmarks(BenchContext& context, const char* label, const LevelConfig& levelConfig)
+{
+#if CARDCORE_HAS_JSON
+    std::ostringstream json;
+    LevelExporter::writeJson(levelConfig, nullptr, json);
+    std::string text = json.str();
+    runCase(context, std::string("level.parse.") + label, [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            LevelConfig* parsed = LevelConfigLoader::parseFromJson(text);
+            MicroBenchmark::keep(parsed);
+            delete parsed;
+        }
+    });
+#else
+    fprintf(stderr, "level.parse.%s skipped: cardcore was built without LevelConfigLoader\n", label);
+#endif
+
+    runCase(context, std::string("model.generate.") + label, [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            GameModel* model = GameModelFromLevelGenerator::generateGameModel(&levelConfig);
+            MicroBenchmark::keep(model);
+            releaseGameModel(model);
+        }
+    });
+}
+
+/**
+ * 走子与回退：每次迭代在一份新生成的模型上走完一局，每次出牌后立即回退再重新出牌
+ * （与GameController/UndoManager的模型侧步骤一致）。GameModel抽牌时不保存原手牌区卡牌，
+ * 抽牌的回退不能还原局面，因此抽牌只执行不回退。模型在不计时的准备阶段生成，每次迭代的工作量相同
+ */
+static void runMoveUndoBenchmark(BenchContext& context, const LevelConfig& levelConfig)
+{
+    std::vector<int> script;
+    makeScript(levelConfig, script);
+    if (script.empty()) {
+        fprintf(stderr, "model.move_undo skipped: no legal moves in %s\n", SMALL_LEVEL_SPEC);
+        return;
+    }
+    int undos = 0;
+    for (int move : script) {
+        undos += move != CompactGameState::MOVE_DRAW;
+    }
+    
+    std::vector<GameModel*> models;
+    auto releaseModels = [&]() {
+        for (GameModel* model : models) {
+            releaseGameModel(model);
+        }
+        models.clear();
+    };
+    UndoModel undoModel;
+    
+    runCase(context, "model.move_undo", [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            GameModel* model = models[i];
+            for (int move : script) {
+                ToolSupport::applyModelMove(model, undoModel, move);
+                if (move != CompactGameState::MOVE_DRAW) {
+                    ToolSupport::undoModelMove(model, undoModel);
+                    ToolSupport::applyModelMove(model, undoModel, move);
+                }
+            }
+            undoModel.clearAllRecords();
+        }
+    }, [&](uint64_t iterations) {
+        releaseModels();
+        for (uint64_t i = 0; i < iterations; i++) {
+            models.push_back(GameModelFromLevelGenerator::generateGameModel(&levelConfig));
+        }
+    });
+    releaseModels();
+    printf("%-32s (%d moves and %d undos per iteration)\n", "", static_cast<int>(script.size()) + undos, undos);
+}
+
+/**
+ * 回退记录的增长与稳态追加、移除
+ */
+static void runUndoModelBenchmarks(BenchContext& context)
+{
+    OperationRecord record;
+    record.type = OT_PLAYFIELD_TO_TRAY;
+    record.cardId = 1;
+    record.prevTrayCardId = 0;
+    
+    // 从空的回退模型开始追加，包含容器扩容
+    runCase(context, "undo.growth.1000", [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            UndoModel undoModel;
+            for (int r = 0; r < UNDO_GROWTH_RECORDS; r++) {
+                undoModel.addOperationRecord(record);
+            }
+            MicroBenchmark::keep(&undoModel);
+        }
+    });
+    
+    // 容量已到位后的追加与读取、移除
+    UndoModel steadyModel;
+    for (int r = 0; r < UNDO_GROWTH_RECORDS; r++) {
+        steadyModel.addOperationRecord(record);
+    }
+    steadyModel.clearAllRecords();
+    runCase(context, "undo.push_pop", [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            steadyModel.addOperationRecord(record);
+            OperationRecord last = steadyModel.getLastRecord();
+            MicroBenchmark::keep(&last);
+            steadyModel.removeLastRecord();
+        }
+    });
+}
+
+/**
+ * 卡牌资源路径：每次迭代按CardView::init的方式为52张牌各生成一组路径
+ */
+static void runCardResConfigBenchmark(BenchContext& context)
+{
+    runCase(context, "resconfig.card_paths.52", [&](uint64_t iterations) {
+        size_t length = 0;
+        for (uint64_t i = 0; i < iterations; i++) {
+            for (int suit = CST_CLUBS; suit <= CST_SPADES; suit++) {
+                for (int face = CFT_ACE; face <= CFT_KING; face++) {
+                    CardFaceType cardFace = static_cast<CardFaceType>(face);
+                    CardSuitType cardSuit = static_cast<CardSuitType>(suit);
+                    bool isRed = cardSuit == CST_DIAMONDS || cardSuit == CST_HEARTS;
+                    length += CardResConfig::getCardFaceImagePath(cardFace, cardSuit).size();
+                    length += CardResConfig::getCardSuitImagePath(cardSuit).size();
+                    length += CardResConfig::getCardNumberImagePath(cardFace, isRed, false).size();
+                    length += CardResConfig::getCardNumberImagePath(cardFace, isRed, true).size();
+                }
+            }
+        }
+        MicroBenchmark::keep(&length);
+    });
+    
+    // 同样的查找只取资源ID与清单中的路径，不构造字符串
+    runCase(context, "resconfig.card_ids.52", [&](uint64_t iterations) {
+        uintptr_t checksum = 0;
+        for (uint64_t i = 0; i < iterations; i++) {
+            for (int suit = CST_CLUBS; suit <= CST_SPADES; suit++) {
+                for (int face = CFT_ACE; face <= CFT_KING; face++) {
+                    CardFaceType cardFace = static_cast<CardFaceType>(face);
+                    CardSuitType cardSuit = static_cast<CardSuitType>(suit);
+                    bool isRed = cardSuit == CST_DIAMONDS || cardSuit == CST_HEARTS;
+                    checksum += reinterpret_cast<uintptr_t>(CardResConfig::getResourcePath(RID_CARD_GENERAL));
+                    checksum += reinterpret_cast<uintptr_t>(
+                        CardResConfig::getResourcePath(CardResConfig::getCardSuitImageId(cardSuit)));
+                    checksum += reinterpret_cast<uintptr_t>(
+                        CardResConfig::getResourcePath(CardResConfig::getCardNumberImageId(cardFace, isRed, false)));
+                    checksum += reinterpret_cast<uintptr_t>(
+                        CardResConfig::getResourcePath(CardResConfig::getCardNumberImageId(cardFace, isRed, true)));
+                }
+            }
+        }
+        MicroBenchmark::keep(&checksum);
+    });
+}
+
+/**
+ * 在本进程内运行全部基准
+ * @return 是否成功
+ */
+static bool runInProcess(BenchContext& context)
+{
+    LevelConfig smallLevel;
+    LevelConfig hugeLevel;
+    if (!makeLevel(SMALL_LEVEL_SPEC, smallLevel) || !makeLevel(HUGE_LEVEL_SPEC, hugeLevel)) {
+        fprintf(stderr, "failed to build benchmark levels\n");
+        return false;
+    }
+    
+    printf("%-32s %17s  %s\n", "benchmark", "mean", "95% CI");
+    runLevelBenchmarks(context, "small", smallLevel);
+    runLevelBenchmarks(context, "huge", hugeLevel);
+    runMoveUndoBenchmark(context, smallLevel);
+    runUndoModelBenchmarks(context);
+    runCardResConfigBenchmark(context);
+    return true;
+}
+
+/**
+ * 为命令行参数加引号
+ */
+static std::string quoteArg(const std::string& arg)
+{
+    return "\"" + arg + "\"";
+}
+
+/**
+ * 以子进程运行runs次本工具，每次只运行一遍并写出单独的结果文件，读取后合并
+ * @param outputPrefix 临时结果文件的前缀
+ * @return 是否全部运行成功
+ */
+static bool runInChildProcesses(int argc, char** argv, int runs, const std::string& outputPrefix,
+                                BenchContext& context)
+{
+    // 转发过滤与采样参数，--runs、--output、--baseline由本进程处理
+    std::string command = quoteArg(argv[0]);
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if ((arg == "--runs" || arg == "--output" || arg == "--baseline") && i + 1 < argc) {
+            i++;
+            continue;
+        }
+        command += " " + quoteArg(arg);
+    }
+    
+    std::vector<std::vector<BenchmarkResult>> results(runs);
+    for (int run = 0; run < runs; run++) {
+        std::string runPath = outputPrefix + ".run" + std::to_string(run + 1) + ".json";
+        std::string runCommand = command + " --runs 1 --output " + quoteArg(runPath);
+#ifdef _WIN32
+        // cmd.exe会去掉整行最外层的一对引号
+        runCommand = "\"" + runCommand + "\"";
+#endif
+        printf("run %d/%d\n", run + 1, runs);
+        fflush(stdout);
+        bool loaded = system(runCommand.c_str()) == 0 && MicroBenchmark::loadJsonFile(runPath, results[run]);
+        remove(runPath.c_str());
+        if (!loaded) {
+            fprintf(stderr, "benchmark run %d failed\n", run + 1);
+            return false;
+        }
+    }
+    
+    MicroBenchmark::merge(results, context.results);
+    printf("\n%-32s %14s %9s  %s\n", "benchmark", "median ns", "spread", "runs");
+    for (const auto& result : context.results) {
+        double spread = result.medianNanos > 0.0 ? result.runSpreadNanos / result.medianNanos : 0.0;
+        printf("%-32s %14.1f %8.1f%%  %d\n", result.name.c_str(), result.medianNanos, spread * 100.0, result.runs);
+    }
+    return true;
+}
+
+/**
+ * 读取并合并多个结果文件
+ * @return 是否全部读取成功
+ */
+static bool loadRuns(const std::vector<std::string>& paths, std::vector<BenchmarkResult>& merged)
+{
+    std::vector<std::vector<BenchmarkResult>> runs(paths.size());
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (!MicroBenchmark::loadJsonFile(paths[i], runs[i])) {
+            fprintf(stderr, "failed to read benchmark results from %s\n", paths[i].c_str());
+            return false;
+        }
+    }
+    MicroBenchmark::merge(runs, merged);
+    return !merged.empty();
+}
+
+/**
+ * 比较两组结果，返回进程退出码
+ */
+static int compareResults(const std::vector<std::string>& baselinePaths, const std::vector<BenchmarkResult>& current,
+                          double threshold)
+{
+    std::vector<BenchmarkResult> baseline;
+    if (!loadRuns(baselinePaths, baseline)) {
+        return 1;
+    }
+    
+    int regressions = MicroBenchmark::compare(baseline, current, threshold, std::cout);
+    if (regressions > 0) {
+        fprintf(stderr, "%d benchmark(s) regressed by more than %.1f%%\n", regressions, threshold * 100.0);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    double threshold = args.getDouble("--threshold", 0.05);
+    
+    std::vector<std::string> comparePaths = args.getAll("--compare");
+    if (!comparePaths.empty()) {
+        std::vector<BenchmarkResult> current;
+        std::vector<std::string> currentPaths = args.getAll("--with");
+        if (currentPaths.empty()) {
+            fprintf(stderr, "--compare needs --with RESULTS.json\n");
+            return 1;
+        }
+        if (!loadRuns(currentPaths, current)) {
+            return 1;
+        }
+        return compareResults(comparePaths, current, threshold);
+    }
+    
+    BenchContext context;
+    context.filters = args.getAll("--filter");
+    context.options.samples = args.getInt("--samples", context.options.samples);
+    context.options.minSampleNanos = static_cast<uint64_t>(args.getDouble("--min-sample-ms", 5.0) * 1e6);
+    int runs = args.getInt("--runs", DEFAULT_RUNS);
+    std::string outputPath = args.getString("--output", "");
+    
+    bool ran = runs > 1 ? runInChildProcesses(argc, argv, runs, outputPath.empty() ? "benchmarks" : outputPath, context)
+                        : runInProcess(context);
+    if (!ran) {
+        return 1;
+    }
+    
+    if (!outputPath.empty() && !MicroBenchmark::writeJsonFile("cardcore", context.results, outputPath)) {
+        fprintf(stderr, "failed to write %s\n", outputPath.c_str());
+        return 1;
+    }
+    
+    std::vector<std::string> baselinePaths = args.getAll("--baseline");
+    if (!baselinePaths.empty()) {
+        printf("\n");
+        return compareResults(baselinePaths, context.results, threshold);
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * SessionLoadGenerator.cpp
+ * 会话服务压测工具：回放录制的对局，统计每秒操作数与批次延迟
+ *
+ * 用法: SessionLoadGenerator [--level FILE]... [--random-deal 20,24] [--seed 1]
+ *                            [--sessions 10000] [--moves 60] [--batch 1024] [--shards 0]
+ *                            [--record FILE] [--replay FILE] [--socket PATH]
+ * 不指定 --replay 时按随机策略生成对局；指定 --record 时把对局写入文件；
+ * 指定 --socket 时压测运行中的SessionServer，否则在进程内启动SessionHost
+ */
+
+#include "ToolSupport.h"
+#include "core/server/SessionHost.h"
+#include "core/server/SessionSocket.h"
+#include "core/server/SessionRecording.h"
+#include <stdio.h>
+
+/**
+ * 把录制的操作转换为请求
+ */
+static SessionRequest makeRequest(uint32_t sessionId, const RecordedSession& session, size_t step)
+{
+    SessionRequest request = SessionRequest();
+    request.sessionId = sessionId;
+    
+    if (step == 0) {
+        request.type = SRT_CREATE;
+        request.levelId = session.levelId;
+    } else if (step > session.moves.size()) {
+        request.type = SRT_CLOSE;
+    } else {
+        int32_t move = session.moves[step - 1];
+        if (move == CompactGameState::MOVE_DRAW) {
+            request.type = SRT_DRAW;
+        } else if (move == SessionRecording::MOVE_UNDO) {
+            request.type = SRT_UNDO;
+        } else {
+            request.type = SRT_PLAY;
+            request.cardIndex = move;
+        }
+    }
+    
+    return request;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    std::vector<CompactDeal> deals;
+    if (!ToolSupport::loadDealsFromArgs(args, deals)) {
+        return 1;
+    }
+    
+    // 准备录制的对局
+    std::vector<RecordedSession> sessions;
+    std::string replayFile = args.getString("--replay", "");
+    if (!replayFile.empty()) {
+        if (!SessionRecording::loadFromFile(replayFile, sessions)) {
+            fprintf(stderr, "failed to load recording %s\n", replayFile.c_str());
+            return 1;
+        }
+    } else {
+        int sessionCount = args.getInt("--sessions", 10000);
+        int maxMoves = args.getInt("--moves", 60);
+        uint32_t seed = static_cast<uint32_t>(args.getInt("--seed", 1));
+        for (size_t i = 0; i < deals.size(); i++) {
+            int count = sessionCount / static_cast<int>(deals.size()) + (i == 0 ? sessionCount % deals.size() : 0);
+            SessionRecording::generateRandomSessions(deals[i], static_cast<uint32_t>(i + 1), count,
+                                                     maxMoves, seed + static_cast<uint32_t>(i), sessions);
+        }
+    }
+    
+    std::string recordFile = args.getString("--record", "");
+    if (!recordFile.empty() && !SessionRecording::saveToFile(recordFile, sessions)) {
+        fprintf(stderr, "failed to write recording %s\n", recordFile.c_str());
+        return 1;
+    }
+    
+    // 连接服务
+    SessionHost host;
+    SessionSocketClient client;
+    std::string socketPath = args.getString("--socket", "");
+    if (socketPath.empty()) {
+        for (size_t i = 0; i < deals.size(); i++) {
+            host.registerDeal(static_cast<uint32_t>(i + 1), deals[i]);
+        }
+        host.start(args.getInt("--shards", 0));
+    } else if (!client.connect(socketPath)) {
+        fprintf(stderr, "failed to connect %s\n", socketPath.c_str());
+        return 1;
+    }
+    
+    // 每批从每个活跃会话各取一个请求，轮流推进
+    size_t batchSize = static_cast<size_t>(args.getInt("--batch", 1024));
+    std::vector<size_t> steps(sessions.size(), 0);
+    std::vector<uint32_t> active;
+    for (size_t i = 0; i < sessions.size(); i++) {
+        active.push_back(static_cast<uint32_t>(i));
+    }
+    
+    std::vector<SessionRequest> requests;
+    std::vector<SessionResponse> responses;
+    std::vector<double> batchLatencies;
+    uint64_t moveCount = 0, requestCount = 0, rejectedCount = 0;
+    size_t cursor = 0;
+    
+    uint64_t startTime = ToolSupport::nowNanos();
+    while (!active.empty()) {
+        requests.clear();
+        size_t taken = 0;
+        while (taken < active.size() && requests.size() < batchSize) {
+            if (cursor >= active.size()) {
+                cursor = 0;
+            }
+            uint32_t index = active[cursor++];
+            SessionRequest request = makeRequest(index + 1, sessions[index], steps[index]++);
+            if (request.type == SRT_DRAW || request.type == SRT_PLAY || request.type == SRT_UNDO) {
+                moveCount++;
+            }
+            requests.push_back(request);
+            taken++;
+        }
+        responses.resize(requests.size());
+        
+        uint64_t batchStart = ToolSupport::nowNanos();
+        if (socketPath.empty()) {
+            host.processBatch(requests.data(), requests.size(), responses.data());
+        } else if (!client.processBatch(requests.data(), requests.size(), responses.data())) {
+            fprintf(stderr, "connection lost\n");
+            return 1;
+        }
+        batchLatencies.push_back((ToolSupport::nowNanos() - batchStart) / 1000.0);
+        
+        requestCount += requests.size();
+        for (const auto& response : responses) {
+            if (response.result != SRC_OK) {
+                rejectedCount++;
+            }
+        }
+        
+        // 移除已经发送关闭请求的会话
+        std::vector<uint32_t> stillActive;
+        stillActive.reserve(active.size());
+        for (uint32_t index : active) {
+            if (steps[index] <= sessions[index].moves.size() + 1) {
+                stillActive.push_back(index);
+            }
+        }
+        active.swap(stillActive);
+    }
+    double seconds = (ToolSupport::nowNanos() - startTime) / 1e9;
+    
+    printf("sessions:        %d\n", static_cast<int>(sessions.size()));
+    printf("shards:          %d\n", socketPath.empty() ? host.getShardCount() : -1);
+    printf("batches:         %d (size %d)\n", static_cast<int>(batchLatencies.size()), static_cast<int>(batchSize));
+    printf("requests:        %llu (%llu rejected)\n", (unsigned long long)requestCount, (unsigned long long)rejectedCount);
+    printf("moves/sec:       %.0f\n", seconds > 0 ? moveCount / seconds : 0.0);
+    printf("requests/sec:    %.0f\n", seconds > 0 ? requestCount / seconds : 0.0);
+    printf("batch p50 (us):  %.1f\n", ToolSupport::percentile(batchLatencies, 50));
+    printf("batch p99 (us):  %.1f\n", ToolSupport::percentile(batchLatencies, 99));
+    
+    host.stop();
+    return rejectedCount == 0 ? 0 : 2;
+}
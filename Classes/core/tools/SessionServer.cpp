@@ -0,0 +1,56 @@
+/**
+ * SessionServer.cpp
+ * 无界面会话服务进程，通过本地套接字接收批量操作
+ *
+ * 用法: SessionServer --socket /tmp/cardgame.sock [--level FILE]... [--random-deal 20,24] [--shards N]
+ * 关卡ID按 --level 出现顺序从1开始编号，--random-deal 生成的牌局排在最后
+ */
+
+#include "ToolSupport.h"
+#include "core/server/SessionHost.h"
+#include "core/server/SessionSocket.h"
+#include <signal.h>
+#include <stdio.h>
+
+static volatile sig_atomic_t s_running = 1;
+
+static void handleSignal(int)
+{
+    s_running = 0;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    std::string socketPath = args.getString("--socket", "/tmp/cardgame_sessions.sock");
+    
+    std::vector<CompactDeal> deals;
+    if (!ToolSupport::loadDealsFromArgs(args, deals)) {
+        return 1;
+    }
+    
+    SessionHost host;
+    for (size_t i = 0; i < deals.size(); i++) {
+        host.registerDeal(static_cast<uint32_t>(i + 1), deals[i]);
+    }
+    host.start(args.getInt("--shards", 0));
+    
+    SessionSocketServer server;
+    if (!server.start(socketPath, &host)) {
+        fprintf(stderr, "failed to listen on %s\n", socketPath.c_str());
+        return 1;
+    }
+    
+    signal(SIGINT, handleSignal);
+    signal(SIGTERM, handleSignal);
+    
+    printf("serving %d level(s) on %s with %d shard(s)\n",
+           static_cast<int>(deals.size()), socketPath.c_str(), host.getShardCount());
+    
+    while (s_running && server.pollOnce(100)) {
+    }
+    
+    server.stop();
+    host.stop();
+    return 0;
+}
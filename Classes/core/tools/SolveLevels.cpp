@@ -0,0 +1,212 @@
+/**
+ * SolveLevels.cpp
+ * 并行求解关卡，或在多个线程数下运行基准测试；--anytime 使用束搜索处理超大关卡
+ *
+ * 用法: SolveLevels [--level FILE]... [--random-deal 20,24 --random-count 16 --seed 1]
+ *                   [--threads 0] [--table-bits 22] [--node-limit 0] [--tablebase endgame.tb]
+ *                   [--benchmark 1,2,4,8,16,32]
+ *                   [--anytime --beam-width 64 --max-beam-width 65536 --time-limit 1 --print-line]
+ */
+
+#include "ToolSupport.h"
+#include "core/solver/ParallelSolver.h"
+#include "core/solver/BeamSolver.h"
+#include "core/solver/EndgameTablebase.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+static const char* STATUS_NAMES[] = { "solved", "unsolvable", "node-limit" };
+static const char* ANYTIME_STATUS_NAMES[] = { "won", "exhausted", "budget" };
+
+/**
+ * 重放解法，确认其确实通关
+ */
+static bool checkSolution(const CompactDeal& deal, const std::vector<int32_t>& solution)
+{
+    CompactGameState state;
+    state.reset(&deal);
+    for (auto move : solution) {
+        if (!state.applyMove(move)) {
+            return false;
+        }
+    }
+    return state.isGameWon();
+}
+
+/**
+ * 解析逗号分隔的线程数列表
+ */
+static std::vector<int> parseThreadCounts(const std::string& text)
+{
+    std::vector<int> counts;
+    const char* cursor = text.c_str();
+    while (*cursor) {
+        char* end = nullptr;
+        long value = strtol(cursor, &end, 10);
+        if (end == cursor) {
+            break;
+        }
+        if (value > 0) {
+            counts.push_back(static_cast<int>(value));
+        }
+        cursor = *end == ',' ? end + 1 : end;
+    }
+    return counts;
+}
+
+/**
+ * 求解所有牌局，累加统计
+ * @return 解法全部正确时返回true
+ */
+static bool solveAll(ParallelSolver& solver, const std::vector<CompactDeal>& deals, uint64_t nodeLimit,
+                     bool verbose, std::vector<int>& statuses, SolveResult& total)
+{
+    bool valid = true;
+    statuses.clear();
+    
+    for (size_t i = 0; i < deals.size(); i++) {
+        SolveResult result;
+        solver.solve(&deals[i], result, nodeLimit);
+        statuses.push_back(result.status);
+        
+        if (result.status == SS_SOLVED && !checkSolution(deals[i], result.solution)) {
+            fprintf(stderr, "deal %d: solution does not replay\n", static_cast<int>(i + 1));
+            valid = false;
+        }
+        
+        total.nodes += result.nodes;
+        total.tableProbes += result.tableProbes;
+        total.tableHits += result.tableHits;
+        total.splits += result.splits;
+        total.steals += result.steals;
+        
+        if (verbose) {
+            printf("deal %d: %s, %llu nodes, %d moves\n", static_cast<int>(i + 1), STATUS_NAMES[result.status],
+                   (unsigned long long)result.nodes, static_cast<int>(result.solution.size()));
+        }
+    }
+    
+    return valid;
+}
+
+/**
+ * 用束搜索逐个处理牌局
+ */
+static int runAnytime(const ToolArgs& args, const std::vector<CompactDeal>& deals)
+{
+    AnytimeSearchOptions options;
+    options.initialBeamWidth = args.getInt("--beam-width", options.initialBeamWidth);
+    options.maxBeamWidth = args.getInt("--max-beam-width", options.maxBeamWidth);
+    options.nodeBudget = static_cast<uint64_t>(args.getDouble("--node-limit", 0));
+    options.timeLimitSeconds = args.getDouble("--time-limit", options.timeLimitSeconds);
+    bool printLine = args.hasFlag("--print-line");
+    
+    for (size_t i = 0; i < deals.size(); i++) {
+        AnytimeSearchResult result;
+        if (!BeamSolver::search(deals[i], options, result)) {
+            fprintf(stderr, "deal %d: search failed\n", static_cast<int>(i + 1));
+            return 1;
+        }
+        
+        printf("deal %d: %s, %d moves, %d left, confidence %.2f, %llu nodes, width %d, %.3f s\n",
+               static_cast<int>(i + 1), ANYTIME_STATUS_NAMES[result.status], static_cast<int>(result.line.size()),
+               result.playfieldRemaining, result.confidence, (unsigned long long)result.nodes,
+               result.beamWidth, result.seconds);
+        
+        if (printLine) {
+            for (auto move : result.line) {
+                if (move == CompactGameState::MOVE_DRAW) {
+                    printf(" d");
+                } else {
+                    printf(" p%d", move);
+                }
+            }
+            printf("\n");
+        }
+    }
+    
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    ToolArgs args(argc, argv);
+    
+    std::vector<CompactDeal> deals;
+    if (!ToolSupport::loadDealsFromArgs(args, deals)) {
+        return 1;
+    }
+    
+    if (args.hasFlag("--anytime")) {
+        return runAnytime(args, deals);
+    }
+    
+    EndgameTablebase tablebase;
+    std::string tablebaseFile = args.getString("--tablebase", "");
+    if (!tablebaseFile.empty() && !tablebase.loadFromFile(tablebaseFile)) {
+        fprintf(stderr, "failed to load tablebase %s\n", tablebaseFile.c_str());
+        return 1;
+    }
+    
+    int tableBits = args.getInt("--table-bits", 22);
+    uint64_t nodeLimit = static_cast<uint64_t>(args.getDouble("--node-limit", 0));
+    std::vector<int> threadCounts = parseThreadCounts(args.getString("--benchmark", ""));
+    bool benchmark = !threadCounts.empty();
+    if (!benchmark) {
+        threadCounts.push_back(args.getInt("--threads", 0));
+    }
+    
+    if (benchmark) {
+        printf("%8s %10s %14s %10s %10s %8s\n", "threads", "seconds", "nodes/sec", "tt hit", "steals", "speedup");
+    }
+    
+    double baseSeconds = 0.0;
+    std::vector<int> baseStatuses;
+    for (auto threadCount : threadCounts) {
+        ParallelSolver solver;
+        if (!solver.start(threadCount, tableBits)) {
+            fprintf(stderr, "failed to start solver\n");
+            return 1;
+        }
+        solver.setTablebase(tablebaseFile.empty() ? nullptr : &tablebase);
+        
+        std::vector<int> statuses;
+        SolveResult total;
+        uint64_t start = ToolSupport::nowNanos();
+        bool valid = solveAll(solver, deals, nodeLimit, !benchmark, statuses, total);
+        double seconds = (ToolSupport::nowNanos() - start) / 1e9;
+        int actualThreads = solver.getThreadCount();
+        solver.stop();
+        
+        if (!valid) {
+            return 1;
+        }
+        
+        if (!benchmark) {
+            printf("%d deals, %.3f s, %.0f nodes/sec, tt hit %.1f%%\n", static_cast<int>(deals.size()), seconds,
+                   seconds > 0 ? total.nodes / seconds : 0.0,
+                   total.tableProbes ? 100.0 * total.tableHits / total.tableProbes : 0.0);
+            continue;
+        }
+        
+        // 不同线程数得出的可解性结论必须一致（达到节点上限的除外）
+        if (baseStatuses.empty()) {
+            baseSeconds = seconds;
+            baseStatuses = statuses;
+        } else {
+            for (size_t i = 0; i < statuses.size(); i++) {
+                if (statuses[i] != baseStatuses[i] && statuses[i] != SS_NODE_LIMIT && baseStatuses[i] != SS_NODE_LIMIT) {
+                    fprintf(stderr, "deal %d: %s with %d threads, %s before\n", static_cast<int>(i + 1),
+                            STATUS_NAMES[statuses[i]], threadCount, STATUS_NAMES[baseStatuses[i]]);
+                    return 1;
+                }
+            }
+        }
+        
+        printf("%8d %10.3f %14.0f %9.1f%% %10llu %7.2fx\n", actualThreads, seconds, seconds > 0 ? total.nodes / seconds : 0.0,
+               total.tableProbes ? 100.0 * total.tableHits / total.tableProbes : 0.0,
+               (unsigned long long)total.steals, seconds > 0 ? baseSeconds / seconds : 0.0);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,202 @@
+/**
+ * ToolSupport.cpp
+ * 命令行工具辅助实现
+ */
+
+#include "ToolSupport.h"
+#include "core/CoreMacros.h"
+#include "core/rules/CompactGameState.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if CARDCORE_HAS_JSON
+#include "configs/loaders/LevelConfigLoader.h"
+#endif
+
+ToolArgs::ToolArgs(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++) {
+        _args.push_back(argv[i]);
+    }
+}
+
+bool ToolArgs::hasFlag(const std::string& name) const
+{
+    return std::find(_args.begin(), _args.end(), name) != _args.end();
+}
+
+std::string ToolArgs::getString(const std::string& name, const std::string& defaultValue) const
+{
+    for (size_t i = 0; i + 1 < _args.size(); i++) {
+        if (_args[i] == name) {
+            return _args[i + 1];
+        }
+    }
+    return defaultValue;
+}
+
+int ToolArgs::getInt(const std::string& name, int defaultValue) const
+{
+    std::string value = getString(name, "");
+    return value.empty() ? defaultValue : atoi(value.c_str());
+}
+
+double ToolArgs::getDouble(const std::string& name, double defaultValue) const
+{
+    std::string value = getString(name, "");
+    return value.empty() ? defaultValue : atof(value.c_str());
+}
+
+std::vector<std::string> ToolArgs::getAll(const std::string& name) const
+{
+    std::vector<std::string> values;
+    for (size_t i = 0; i + 1 < _args.size(); i++) {
+        if (_args[i] == name) {
+            values.push_back(_args[i + 1]);
+        }
+    }
+    return values;
+}
+
+bool ToolSupport::loadDealFromFile(const std::string& filePath, CompactDeal& deal)
+{
+#if CARDCORE_HAS_JSON
+    LevelConfig* levelConfig = LevelConfigLoader::loadLevelConfigFromFile(filePath);
+    bool result = deal.initWithLevelConfig(levelConfig);
+    CORE_SAFE_DELETE(levelConfig);
+    return result;
+#else
+    (void)deal;
+    fprintf(stderr, "cardcore was built without LevelConfigLoader, cannot read %s\n", filePath.c_str());
+    return false;
+#endif
+}
+
+bool ToolSupport::makeRandomDeal(uint32_t seed, int playfieldCount, int stackCount, CompactDeal& deal)
+{
+    std::mt19937 rng(seed);
+    std::vector<uint8_t> playfieldFaces, playfieldSuits, stackFaces, stackSuits;
+    
+    for (int i = 0; i < playfieldCount; i++) {
+        playfieldFaces.push_back(static_cast<uint8_t>(rng() % 13));
+        playfieldSuits.push_back(static_cast<uint8_t>(rng() % 4));
+    }
+    for (int i = 0; i < stackCount; i++) {
+        stackFaces.push_back(static_cast<uint8_t>(rng() % 13));
+        stackSuits.push_back(static_cast<uint8_t>(rng() % 4));
+    }
+    
+    return deal.init(playfieldFaces, playfieldSuits, stackFaces, stackSuits);
+}
+
+bool ToolSupport::loadDealsFromArgs(const ToolArgs& args, std::vector<CompactDeal>& deals)
+{
+    for (const auto& filePath : args.getAll("--level")) {
+        CompactDeal deal;
+        if (!loadDealFromFile(filePath, deal)) {
+            fprintf(stderr, "failed to load level %s\n", filePath.c_str());
+            return false;
+        }
+        deals.push_back(deal);
+    }
+    
+    // --random-deal 主牌区数,备用牌堆数
+    std::string randomDeal = args.getString("--random-deal", deals.empty() ? "20,24" : "");
+    if (!randomDeal.empty()) {
+        int playfieldCount = 0, stackCount = 0;
+        if (sscanf(randomDeal.c_str(), "%d,%d", &playfieldCount, &stackCount) != 2) {
+            fprintf(stderr, "--random-deal expects PLAYFIELD,STACK\n");
+            return false;
+        }
+        
+        // --random-count 连续种子生成多个随机牌局
+        uint32_t seed = static_cast<uint32_t>(args.getInt("--seed", 1));
+        int count = args.getInt("--random-count", 1);
+        for (int i = 0; i < count; i++) {
+            CompactDeal deal;
+            if (!makeRandomDeal(seed + i, playfieldCount, stackCount, deal)) {
+                return false;
+            }
+            deals.push_back(deal);
+        }
+    }
+    
+    return !deals.empty();
+}
+
+uint64_t ToolSupport::nowNanos()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+double ToolSupport::percentile(std::vector<double>& samples, double percentile)
+{
+    if (samples.empty()) {
+        return 0.0;
+    }
+    
+    std::sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(percentile / 100.0 * (samples.size() - 1) + 0.5);
+    return samples[std::min(index, samples.size() - 1)];
+}
+
+bool ToolSupport::applyModelMove(GameModel* model, UndoModel& undoModel, int move)
+{
+    CardModel* trayTopCard = model->getTrayTopCard();
+    OperationRecord record;
+    record.prevTrayCardId = trayTopCard ? trayTopCard->getCardId() : -1;
+    
+    if (move == CompactGameState::MOVE_DRAW) {
+        if (!model->drawCardFromStack() || !model->getTrayTopCard()) {
+            return false;
+        }
+        record.type = OT_STACK_TO_TRAY;
+        record.cardId = model->getTrayTopCard()->getCardId();
+        undoModel.addOperationRecord(record);
+        return true;
+    }
+    
+    CardModel* card = model->getPlayfieldCardById(move);
+    if (!card || (trayTopCard && !GameModel::canMatch(card, trayTopCard))) {
+        return false;
+    }
+    record.type = OT_PLAYFIELD_TO_TRAY;
+    record.cardId = move;
+    record.fromPos = card->getPosition();
+    undoModel.addOperationRecord(record);
+    model->moveCardFromPlayfieldToTray(move);
+    return true;
+}
+
+bool ToolSupport::undoModelMove(GameModel* model, UndoModel& undoModel)
+{
+    if (!undoModel.canUndo()) {
+        return false;
+    }
+    OperationRecord record = undoModel.getLastRecord();
+    CardModel* currentTrayCard = model->getTrayTopCard();
+    if (!currentTrayCard || currentTrayCard->getCardId() != record.cardId) {
+        return false;
+    }
+    
+    if (record.type == OT_PLAYFIELD_TO_TRAY) {
+        CardModel* newCard = new CardModel(record.cardId, currentTrayCard->getFace(), currentTrayCard->getSuit(),
+                                           record.fromPos);
+        model->getPlayfieldCards().push_back(newCard);
+        delete currentTrayCard;
+    } else {
+        model->getStackCards().push_back(currentTrayCard);
+    }
+    
+    model->setTrayTopCardDirectly(nullptr);
+    CardModel* previousTrayCard = model->restorePreviousTrayCard();
+    if (previousTrayCard) {
+        model->setTrayTopCardDirectly(previousTrayCard);
+    }
+    undoModel.removeLastRecord();
+    return true;
+}
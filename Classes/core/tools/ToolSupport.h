@@ -0,0 +1,97 @@
+/**
+ * ToolSupport.h
+ * 命令行工具共用的参数解析与牌局加载
+ */
+
+#ifndef __TOOL_SUPPORT_H__
+#define __TOOL_SUPPORT_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "core/rules/CompactDeal.h"
+#include "models/GameModel.h"
+#include "models/UndoModel.h"
+
+/**
+ * 命令行参数，支持 "--name value" 与 "--flag" 两种形式
+ */
+class ToolArgs
+{
+public:
+    ToolArgs(int argc, char** argv);
+    
+    bool hasFlag(const std::string& name) const;                                                // 是否带有开关参数
+    std::string getString(const std::string& name, const std::string& defaultValue) const;     // 获取字符串参数
+    int getInt(const std::string& name, int defaultValue) const;                               // 获取整数参数
+    double getDouble(const std::string& name, double defaultValue) const;                      // 获取浮点参数
+    std::vector<std::string> getAll(const std::string& name) const;                            // 获取重复出现的参数
+    
+private:
+    std::vector<std::string> _args;     // 原始参数
+};
+
+/**
+ * 工具辅助类
+ */
+class ToolSupport
+{
+public:
+    /**
+     * 从关卡JSON文件加载牌局（需要核心库带有LevelConfigLoader）
+     * @param filePath 关卡文件路径
+     * @param deal 输出的牌局
+     * @return 是否加载成功
+     */
+    static bool loadDealFromFile(const std::string& filePath, CompactDeal& deal);
+    
+    /**
+     * 生成随机牌局，用于没有关卡文件时的压测
+     * @param seed 随机种子
+     * @param playfieldCount 主牌区卡牌数
+     * @param stackCount 备用牌堆卡牌数
+     * @param deal 输出的牌局
+     * @return 是否生成成功
+     */
+    static bool makeRandomDeal(uint32_t seed, int playfieldCount, int stackCount, CompactDeal& deal);
+    
+    /**
+     * 按 --level、--random-deal 与 --random-count 参数加载牌局，关卡ID从1开始依次编号
+     * @param args 命令行参数
+     * @param deals 输出的牌局
+     * @return 是否至少加载了一个牌局
+     */
+    static bool loadDealsFromArgs(const ToolArgs& args, std::vector<CompactDeal>& deals);
+    
+    /**
+     * 获取当前单调时钟（纳秒）
+     * @return 纳秒
+     */
+    static uint64_t nowNanos();
+    
+    /**
+     * 计算百分位数，会对输入排序
+     * @param samples 样本
+     * @param percentile 百分位（0-100）
+     * @return 百分位数
+     */
+    static double percentile(std::vector<double>& samples, double percentile);
+    
+    /**
+     * 模型侧出牌或抽牌，与GameController::handlePlayfieldCardClick/handleStackClick一致
+     * @param model 游戏模型
+     * @param undoModel 回退模型，成功时追加一条记录
+     * @param move 主牌区卡牌ID（与CompactDeal下标相同）或CompactGameState::MOVE_DRAW
+     * @return 是否执行成功
+     */
+    static bool applyModelMove(GameModel* model, UndoModel& undoModel, int move);
+    
+    /**
+     * 模型侧回退，与UndoManager::undo中对模型的操作一致（不含视图与动画）
+     * 出牌的回退按UndoManager的做法新建卡牌模型放回主牌区；原手牌区卡牌在UndoManager中不再被引用，这里直接释放
+     * @return 没有可回退的记录或记录与手牌区不一致时返回false
+     */
+    static bool undoModelMove(GameModel* model, UndoModel& undoModel);
+};
+
+#endif // __TOOL_SUPPORT_H__
@@ -0,0 +1,119 @@
+/**
+ * ReplaySubmission.cpp
+ * 提交批次实现
+ */
+
+#include "ReplaySubmission.h"
+#include "core/rules/CompactGameState.h"
+#include "core/server/SessionRecording.h"
+#include <stdlib.h>
+
+void ReplaySubmissionBatch::clear()
+{
+    _submissions.clear();
+    _moves.clear();
+}
+
+void ReplaySubmissionBatch::addSubmission(uint32_t levelId, uint64_t seed, const int32_t* moves, uint32_t moveCount,
+                                          const ClaimedResult& claimed)
+{
+    ReplaySubmission submission;
+    submission.levelId = levelId;
+    submission.seed = seed;
+    submission.moveOffset = static_cast<uint32_t>(_moves.size());
+    submission.moveCount = moveCount;
+    submission.claimed = claimed;
+    
+    _moves.insert(_moves.end(), moves, moves + moveCount);
+    _submissions.push_back(submission);
+}
+
+size_t ReplaySubmissionBatch::readFromStream(std::istream& input, size_t maxCount)
+{
+    size_t count = 0;
+    while (count < maxCount && std::getline(input, _line)) {
+        if (_line.empty()) {
+            continue;
+        }
+        
+        ReplaySubmission submission;
+        submission.moveOffset = static_cast<uint32_t>(_moves.size());
+        
+        // 手工解析避免每行产生临时字符串
+        const char* p = _line.c_str();
+        char* end = nullptr;
+        unsigned long long fields[5];
+        bool valid = true;
+        for (int i = 0; i < 5 && valid; i++) {
+            fields[i] = strtoull(p, &end, 10);
+            valid = end != p;
+            p = end;
+        }
+        while (valid && *p == ' ') {
+            p++;
+        }
+        valid = valid && *p == ':';
+        
+        if (valid) {
+            p++;
+            while (*p) {
+                if (*p == ' ') {
+                    p++;
+                } else if (*p == 'd') {
+                    _moves.push_back(CompactGameState::MOVE_DRAW);
+                    p++;
+                } else if (*p == 'u') {
+                    _moves.push_back(SessionRecording::MOVE_UNDO);
+                    p++;
+                } else if (*p == 'p') {
+                    long index = strtol(p + 1, &end, 10);
+                    if (end == p + 1 || index < 0) {
+                        valid = false;
+                        break;
+                    }
+                    _moves.push_back(static_cast<int32_t>(index));
+                    p = end;
+                } else {
+                    valid = false;
+                    break;
+                }
+            }
+        }
+        
+        if (valid) {
+            submission.levelId = static_cast<uint32_t>(fields[0]);
+            submission.seed = static_cast<uint64_t>(fields[1]);
+            submission.claimed.won = fields[2] ? 1 : 0;
+            submission.claimed.playfieldRemaining = static_cast<uint16_t>(fields[3]);
+            submission.claimed.moveCount = static_cast<uint32_t>(fields[4]);
+            submission.moveCount = static_cast<uint32_t>(_moves.size()) - submission.moveOffset;
+        } else {
+            // 格式错误：丢弃已解析的操作，交给校验器判定为无效提交
+            _moves.resize(submission.moveOffset);
+        }
+        
+        _submissions.push_back(submission);
+        count++;
+    }
+    
+    return count;
+}
+
+void ReplaySubmissionBatch::writeSubmission(std::ostream& output, size_t index) const
+{
+    const ReplaySubmission& submission = _submissions[index];
+    output << submission.levelId << " " << submission.seed << " " << static_cast<int>(submission.claimed.won)
+           << " " << submission.claimed.playfieldRemaining << " " << submission.claimed.moveCount << ":";
+    
+    for (uint32_t i = 0; i < submission.moveCount; i++) {
+        int32_t move = _moves[submission.moveOffset + i];
+        if (move == CompactGameState::MOVE_DRAW) {
+            output << " d";
+        } else if (move == SessionRecording::MOVE_UNDO) {
+            output << " u";
+        } else {
+            output << " p" << move;
+        }
+    }
+    output << "\n";
+}
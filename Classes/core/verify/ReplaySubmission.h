@@ -0,0 +1,111 @@
+/**
+ * ReplaySubmission.h
+ * 客户端提交的对局记录，多条提交的操作连续存放在同一块缓冲区中
+ */
+
+#ifndef __REPLAY_SUBMISSION_H__
+#define __REPLAY_SUBMISSION_H__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <istream>
+
+/**
+ * 客户端声明的对局结果
+ */
+struct ClaimedResult
+{
+    uint8_t won;                    // 是否胜利
+    uint16_t playfieldRemaining;    // 主牌区剩余卡牌数
+    uint32_t moveCount;             // 有效操作数（撤销会抵消一次操作）
+    
+    ClaimedResult()
+        : won(0)
+        , playfieldRemaining(0)
+        , moveCount(0)
+    {}
+};
+
+/**
+ * 一条提交，操作序列通过偏移引用批次的操作缓冲区
+ */
+struct ReplaySubmission
+{
+    uint32_t levelId;       // 关卡ID
+    uint64_t seed;          // 发牌种子（DealShuffler与每日挑战的种子为64位）
+    uint32_t moveOffset;    // 操作在缓冲区中的起始位置
+    uint32_t moveCount;     // 操作数量
+    ClaimedResult claimed;  // 声明的结果
+    
+    ReplaySubmission()
+        : levelId(0)
+        , seed(0)
+        , moveOffset(0)
+        , moveCount(0)
+    {}
+};
+
+/**
+ * 提交批次，操作编码与SessionRecording一致：主牌区下标、MOVE_DRAW(-1)、MOVE_UNDO(-2)
+ * 文本格式每行一条："<levelId> <seed> <won> <playfieldRemaining> <moveCount>: p3 d u p5"
+ */
+class ReplaySubmissionBatch
+{
+public:
+    /**
+     * 清空批次，保留已分配的容量
+     */
+    void clear();
+    
+    /**
+     * 添加一条提交
+     * @param levelId 关卡ID
+     * @param seed 发牌种子
+     * @param moves 操作数组
+     * @param moveCount 操作数量
+     * @param claimed 声明的结果
+     */
+    void addSubmission(uint32_t levelId, uint64_t seed, const int32_t* moves, uint32_t moveCount,
+                       const ClaimedResult& claimed);
+    
+    /**
+     * 从文本流读取提交，直到流结束或读满maxCount条
+     * @param input 输入流
+     * @param maxCount 最多读取条数
+     * @return 读取的条数，格式错误的行记为操作数为0且levelId为0的提交
+     */
+    size_t readFromStream(std::istream& input, size_t maxCount);
+    
+    /**
+     * 把一条提交写成文本行
+     * @param output 输出流
+     * @param index 提交下标
+     */
+    void writeSubmission(std::ostream& output, size_t index) const;
+    
+    /**
+     * 获取提交数量
+     * @return 提交数量
+     */
+    size_t size() const { return _submissions.size(); }
+    
+    /**
+     * 获取提交列表
+     * @return 提交列表
+     */
+    const std::vector<ReplaySubmission>& getSubmissions() const { return _submissions; }
+    
+    /**
+     * 获取操作缓冲区
+     * @return 操作缓冲区
+     */
+    const std::vector<int32_t>& getMoves() const { return _moves; }
+    
+private:
+    std::vector<ReplaySubmission> _submissions;    // 提交列表
+    std::vector<int32_t> _moves;                   // 所有提交的操作
+    std::string _line;                             // 读取时复用的行缓冲
+};
+
+#endif // __REPLAY_SUBMISSION_H__
@@ -0,0 +1,236 @@
+/**
+ * ReplayVerifier.cpp
+ * 排行榜提交校验器实现
+ */
+
+#include "ReplayVerifier.h"
+#include "core/server/SessionRecording.h"
+
+// 每次领取的提交数，兼顾负载均衡与原子操作开销
+static const size_t VERIFY_CHUNK_SIZE = 64;
+
+ReplayVerifier::ReplayVerifier()
+    : _generation(0)
+    , _busyWorkers(0)
+    , _running(false)
+    , _batch(nullptr)
+    , _verdicts(nullptr)
+    , _nextIndex(0)
+{
+}
+
+ReplayVerifier::~ReplayVerifier()
+{
+    stop();
+}
+
+bool ReplayVerifier::registerDeal(uint32_t levelId, uint64_t seed, const CompactDeal& deal)
+{
+    if (_running || deal.getStackCount() == 0) {
+        return false;
+    }
+    
+    DealKey key;
+    key.levelId = levelId;
+    key.seed = seed;
+    _deals[key] = deal;
+    return true;
+}
+
+bool ReplayVerifier::registerTemplate(uint32_t levelId, const LevelTemplate& levelTemplate,
+                                      const DealShuffleParams& params)
+{
+    if (_running || levelTemplate.stackCount <= 0) {
+        return false;
+    }
+    
+    SeededLevel& seededLevel = _seededLevels[levelId];
+    seededLevel.levelTemplate = levelTemplate;
+    seededLevel.params = params;
+    return true;
+}
+
+bool ReplayVerifier::start(int threadCount)
+{
+    if (_running) {
+        return false;
+    }
+    
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        if (threadCount <= 0) {
+            threadCount = 1;
+        }
+    }
+    
+    _running = true;
+    // 调用线程也参与校验，因此只需额外创建threadCount - 1个线程
+    for (int i = 1; i < threadCount; i++) {
+        _workers.push_back(std::thread(&ReplayVerifier::workerLoop, this));
+    }
+    
+    return true;
+}
+
+void ReplayVerifier::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_running) {
+            return;
+        }
+        _running = false;
+    }
+    _startCond.notify_all();
+    
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+    _workers.clear();
+}
+
+void ReplayVerifier::verifyBatch(const ReplaySubmissionBatch& batch, std::vector<ReplayVerdict>& verdicts)
+{
+    verdicts.resize(batch.size());
+    if (batch.size() == 0) {
+        return;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _batch = &batch;
+        _verdicts = verdicts.data();
+        _nextIndex.store(0, std::memory_order_relaxed);
+        _busyWorkers = static_cast<int>(_workers.size());
+        _generation++;
+    }
+    _startCond.notify_all();
+    
+    drainBatch(_callerScratch);
+    
+    // 等待所有工作线程退出当前批次，之后batch与verdicts才可以被调用方修改
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (_busyWorkers > 0) {
+        _doneCond.wait(lock);
+    }
+    _batch = nullptr;
+    _verdicts = nullptr;
+}
+
+void ReplayVerifier::workerLoop()
+{
+    VerifyScratch scratch;
+    uint64_t seenGeneration = 0;
+    
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (_running && _generation == seenGeneration) {
+                _startCond.wait(lock);
+            }
+            if (!_running) {
+                return;
+            }
+            seenGeneration = _generation;
+        }
+        
+        drainBatch(scratch);
+        
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_busyWorkers == 0) {
+            _doneCond.notify_one();
+        }
+    }
+}
+
+void ReplayVerifier::drainBatch(VerifyScratch& scratch)
+{
+    const std::vector<ReplaySubmission>& submissions = _batch->getSubmissions();
+    const int32_t* moves = _batch->getMoves().data();
+    size_t total = submissions.size();
+    
+    while (true) {
+        size_t begin = _nextIndex.fetch_add(VERIFY_CHUNK_SIZE, std::memory_order_relaxed);
+        if (begin >= total) {
+            return;
+        }
+        
+        size_t end = begin + VERIFY_CHUNK_SIZE < total ? begin + VERIFY_CHUNK_SIZE : total;
+        for (size_t i = begin; i < end; i++) {
+            const ReplaySubmission& submission = submissions[i];
+            _verdicts[i] = verifySubmission(submission, moves + submission.moveOffset,
+                                            findDeal(submission.levelId, submission.seed, scratch), scratch.state);
+        }
+    }
+}
+
+ReplayVerdict ReplayVerifier::verifySubmission(const ReplaySubmission& submission, const int32_t* moves,
+                                               const CompactDeal* deal, CompactGameState& scratch)
+{
+    ReplayVerdict verdict;
+    
+    // 格式错误的行在读取时被标记为关卡0且没有操作
+    if (submission.levelId == 0) {
+        verdict.code = RVC_MALFORMED;
+        return verdict;
+    }
+    
+    if (!deal || !scratch.reset(deal)) {
+        verdict.code = RVC_UNKNOWN_LEVEL;
+        return verdict;
+    }
+    
+    for (uint32_t i = 0; i < submission.moveCount; i++) {
+        int32_t move = moves[i];
+        bool legal;
+        if (move == SessionRecording::MOVE_UNDO) {
+            legal = scratch.undo();
+        } else if (move == CompactGameState::MOVE_DRAW || move >= 0) {
+            legal = scratch.applyMove(move);
+        } else {
+            legal = false;
+        }
+        
+        if (!legal) {
+            verdict.code = RVC_ILLEGAL_MOVE;
+            verdict.moveIndex = i;
+            return verdict;
+        }
+    }
+    
+    const ClaimedResult& claimed = submission.claimed;
+    bool matches = (claimed.won != 0) == scratch.isGameWon()
+        && claimed.playfieldRemaining == scratch.getPlayfieldRemaining()
+        && claimed.moveCount == scratch.getHistory().size();
+    
+    verdict.code = matches ? RVC_ACCEPTED : RVC_RESULT_MISMATCH;
+    return verdict;
+}
+
+const CompactDeal* ReplayVerifier::findDeal(uint32_t levelId, uint64_t seed, VerifyScratch& scratch) const
+{
+    DealKey key;
+    key.levelId = levelId;
+    key.seed = seed;
+    auto it = _deals.find(key);
+    if (it != _deals.end()) {
+        return &it->second;
+    }
+    
+    auto seededIt = _seededLevels.find(levelId);
+    if (seededIt == _seededLevels.end()) {
+        return nullptr;
+    }
+    
+    // 同一种子（如当天的每日挑战）的提交集中出现，命中缓存时不再展开，也不产生堆分配
+    CachedDeal& cached = scratch.dealCache[DealKeyHash()(key) % DEAL_CACHE_SIZE];
+    if (!cached.filled || !(cached.key == key)) {
+        const SeededLevel& seededLevel = seededIt->second;
+        cached.key = key;
+        cached.filled = true;
+        cached.valid = DealShuffler::shuffleLevel(seededLevel.levelTemplate, seed, seededLevel.params,
+                                                  scratch.levelConfig)
+            && cached.deal.initWithLevelConfig(&scratch.levelConfig);
+    }
+    return cached.valid ? &cached.deal : nullptr;
+}
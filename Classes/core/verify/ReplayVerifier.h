@@ -0,0 +1,221 @@
+/**
+ * ReplayVerifier.h
+ * 排行榜提交校验器，按关卡规则重放客户端的操作序列并核对声明的结果
+ */
+
+#ifndef __REPLAY_VERIFIER_H__
+#define __REPLAY_VERIFIER_H__
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include "ReplaySubmission.h"
+#include "core/rules/CompactGameState.h"
+#include "core/generator/DealShuffler.h"
+
+/**
+ * 校验结论
+ */
+enum ReplayVerdictCode
+{
+    RVC_ACCEPTED = 0,       // 通过
+    RVC_MALFORMED,          // 提交格式错误
+    RVC_UNKNOWN_LEVEL,      // 关卡或种子未注册
+    RVC_ILLEGAL_MOVE,       // 存在不合法的操作
+    RVC_RESULT_MISMATCH,    // 重放结果与声明不一致
+    RVC_NUM_VERDICT_CODES
+};
+
+/**
+ * 单条提交的校验结果
+ */
+struct ReplayVerdict
+{
+    uint8_t code;           // 结论（ReplayVerdictCode）
+    uint32_t moveIndex;     // 非法操作所在位置（仅RVC_ILLEGAL_MOVE有效）
+    
+    ReplayVerdict()
+        : code(RVC_MALFORMED)
+        , moveIndex(0)
+    {}
+};
+
+/**
+ * 提交校验器类
+ * 工作线程各自持有一个CompactGameState作为可复用的状态缓冲区，
+ * 缓冲区增长到最大关卡规模后，校验单条提交不再产生堆分配。
+ * 种子关卡（含每日挑战）不必逐个种子注册：注册（布局模板，发牌参数）后，未注册的种子在首次出现时
+ * 由DealShuffler展开，结果缓存在各线程自己的牌局缓存中，同一种子的后续提交直接命中
+ */
+class ReplayVerifier
+{
+public:
+    /**
+     * 构造函数
+     */
+    ReplayVerifier();
+    
+    /**
+     * 析构函数
+     */
+    ~ReplayVerifier();
+    
+    /**
+     * 注册关卡牌局，必须在start之前调用
+     * @param levelId 关卡ID
+     * @param seed 发牌种子
+     * @param deal 牌局定义
+     * @return 是否注册成功
+     */
+    bool registerDeal(uint32_t levelId, uint64_t seed, const CompactDeal& deal);
+    
+    /**
+     * 注册种子关卡，该关卡未注册的种子按模板与发牌参数展开，必须在start之前调用
+     * @param levelId 关卡ID
+     * @param levelTemplate 布局模板
+     * @param params 发牌参数
+     * @return 是否注册成功
+     */
+    bool registerTemplate(uint32_t levelId, const LevelTemplate& levelTemplate, const DealShuffleParams& params);
+    
+    /**
+     * 启动工作线程
+     * @param threadCount 线程数（包含调用线程），为0时使用CPU核心数
+     * @return 是否启动成功
+     */
+    bool start(int threadCount);
+    
+    /**
+     * 停止工作线程
+     */
+    void stop();
+    
+    /**
+     * 并行校验一个批次，阻塞直到全部完成
+     * @param batch 提交批次
+     * @param verdicts 输出的校验结果，与提交一一对应
+     */
+    void verifyBatch(const ReplaySubmissionBatch& batch, std::vector<ReplayVerdict>& verdicts);
+    
+    /**
+     * 校验单条提交
+     * @param submission 提交
+     * @param moves 提交的操作数组
+     * @param deal 牌局定义，为nullptr表示未注册
+     * @param scratch 可复用的状态缓冲区
+     * @return 校验结果
+     */
+    static ReplayVerdict verifySubmission(const ReplaySubmission& submission, const int32_t* moves,
+                                          const CompactDeal* deal, CompactGameState& scratch);
+    
+    /**
+     * 获取线程数（包含调用线程）
+     * @return 线程数
+     */
+    int getThreadCount() const { return static_cast<int>(_workers.size()) + 1; }
+    
+private:
+    static const int DEAL_CACHE_SIZE = 64;  // 每个线程缓存的展开牌局数
+    
+    /**
+     * 已注册牌局的键
+     */
+    struct DealKey
+    {
+        uint32_t levelId;   // 关卡ID
+        uint64_t seed;      // 发牌种子
+        
+        bool operator==(const DealKey& other) const { return levelId == other.levelId && seed == other.seed; }
+    };
+    
+    /**
+     * 牌局键的哈希
+     */
+    struct DealKeyHash
+    {
+        size_t operator()(const DealKey& key) const
+        {
+            return std::hash<uint64_t>()((key.seed * 0x9E3779B97F4A7C15ULL) ^ key.levelId);
+        }
+    };
+    
+    /**
+     * 种子关卡的展开方式
+     */
+    struct SeededLevel
+    {
+        LevelTemplate levelTemplate;    // 布局模板
+        DealShuffleParams params;       // 发牌参数
+    };
+    
+    /**
+     * 线程缓存中展开过的一个牌局，按键直接映射到槽位
+     */
+    struct CachedDeal
+    {
+        DealKey key;        // 牌局键
+        bool filled;        // 槽位是否已使用
+        bool valid;         // 展开是否成功（失败也缓存，重复的无效种子不再展开）
+        CompactDeal deal;   // 展开的牌局
+        
+        CachedDeal()
+            : filled(false)
+            , valid(false)
+        {
+            key.levelId = 0;
+            key.seed = 0;
+        }
+    };
+    
+    /**
+     * 每个线程的可复用缓冲区
+     */
+    struct VerifyScratch
+    {
+        CompactGameState state;                     // 重放用的状态缓冲区
+        CachedDeal dealCache[DEAL_CACHE_SIZE];      // 展开过的种子牌局
+        LevelConfig levelConfig;                    // 展开时的关卡配置缓冲区
+    };
+    
+    std::unordered_map<DealKey, CompactDeal, DealKeyHash> _deals;  // 已注册的牌局
+    std::unordered_map<uint32_t, SeededLevel> _seededLevels;        // 已注册的种子关卡（关卡ID为键）
+    std::vector<std::thread> _workers;                              // 工作线程
+    VerifyScratch _callerScratch;                                   // 调用线程的缓冲区
+    
+    std::mutex _mutex;                      // 批次同步锁
+    std::condition_variable _startCond;     // 批次开始通知
+    std::condition_variable _doneCond;      // 批次完成通知
+    uint64_t _generation;                   // 批次序号
+    int _busyWorkers;                       // 尚未完成当前批次的工作线程数
+    bool _running;                          // 是否运行中
+    
+    const ReplaySubmissionBatch* _batch;    // 当前批次
+    ReplayVerdict* _verdicts;               // 当前批次的结果
+    std::atomic<size_t> _nextIndex;         // 下一块待领取的提交下标
+    
+    /**
+     * 工作线程主循环
+     */
+    void workerLoop();
+    
+    /**
+     * 领取并校验提交直到当前批次被领完
+     * @param scratch 线程缓冲区
+     */
+    void drainBatch(VerifyScratch& scratch);
+    
+    /**
+     * 查找牌局：先查已注册的牌局，未命中时在线程缓存中查找或按种子关卡展开
+     * @param levelId 关卡ID
+     * @param seed 发牌种子
+     * @param scratch 线程缓冲区
+     * @return 牌局定义，未注册或展开失败返回nullptr
+     */
+    const CompactDeal* findDeal(uint32_t levelId, uint64_t seed, VerifyScratch& scratch) const;
+};
+
+#endif // __REPLAY_VERIFIER_H__
@@ -0,0 +1,74 @@
+/**
+ * Sha256.h
+ * SHA-256摘要与HMAC-SHA256签名，用于离线生成的文件的完整性校验
+ */
+
+#ifndef __SHA256_H__
+#define __SHA256_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * SHA-256摘要类（FIPS 180-4），可以分段输入
+ */
+class Sha256
+{
+public:
+    static const int DIGEST_SIZE = 32;      // 摘要字节数
+    static const int BLOCK_SIZE = 64;       // 分组字节数
+    
+    Sha256();
+    
+    /**
+     * 重新开始计算
+     */
+    void reset();
+    
+    /**
+     * 输入数据
+     * @param data 数据
+     * @param size 字节数
+     */
+    void update(const void* data, size_t size);
+    
+    /**
+     * 结束计算并输出摘要，之后需要reset才能再次使用
+     * @param digest 输出DIGEST_SIZE字节
+     */
+    void finish(uint8_t* digest);
+    
+    /**
+     * 计算一段数据的摘要
+     */
+    static void hash(const void* data, size_t size, uint8_t* digest);
+    
+    /**
+     * 计算HMAC-SHA256（RFC 2104）
+     * @param key 密钥
+     * @param keySize 密钥字节数
+     * @param data 数据
+     * @param size 数据字节数
+     * @param mac 输出DIGEST_SIZE字节
+     */
+    static void hmac(const void* key, size_t keySize, const void* data, size_t size, uint8_t* mac);
+    
+    /**
+     * 比较两个摘要，耗时与内容无关
+     * @return 相同时返回true
+     */
+    static bool equalDigests(const uint8_t* a, const uint8_t* b);
+    
+private:
+    /**
+     * 处理一个分组
+     */
+    void processBlock(const uint8_t* block);
+    
+    uint32_t _state[8];             // 中间状态
+    uint8_t _buffer[BLOCK_SIZE];    // 未满一个分组的数据
+    size_t _bufferSize;             // 缓冲区数据长度
+    uint64_t _totalSize;            // 已输入的总字节数
+};
+
+#endif // __SHA256_H__
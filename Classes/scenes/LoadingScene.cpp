@@ -0,0 +1,176 @@
+/**
+ * LoadingScene.cpp
+ * 加载场景实现
+ */
+
+#include "LoadingScene.h"
+#include "GameScene.h"
+#include "../configs/models/CardResConfig.h"
+#include "../adapters/CocosAdapter.h"
+#include "../core/hint/SharedTablebase.h"
+#include "../controllers/FramePacer.h"
+#include "../core/profile/FrameProfiler.h"
+
+USING_NS_CC;
+
+// 启动时刻与各阶段耗时（毫秒，未完成时为-1）
+static uint64_t s_launchNanos = 0;
+static double s_preloadMillis = -1.0;
+static double s_timeToInteractiveMillis = -1.0;
+
+// 等待游戏场景第一帧的监听器
+static EventListenerCustom* s_firstFrameListener = nullptr;
+
+void LoadingScene::markLaunch()
+{
+    s_launchNanos = FrameProfiler::nowNanos();
+}
+
+Scene* LoadingScene::createScene()
+{
+    return LoadingScene::create();
+}
+
+double LoadingScene::getPreloadMillis()
+{
+    return s_preloadMillis;
+}
+
+double LoadingScene::getTimeToInteractiveMillis()
+{
+    return s_timeToInteractiveMillis;
+}
+
+LoadingScene::LoadingScene()
+    : _loadedCount(0)
+    , _failedCount(0)
+    , _startNanos(0)
+    , _progressLabel(nullptr)
+    , _progressBar(nullptr)
+    , _progressWidth(0.0f)
+{
+}
+
+bool LoadingScene::init()
+{
+    if (!Scene::init()) {
+        return false;
+    }
+    
+    CardResConfig::getAllImagePaths(_paths);
+    
+    auto visibleSize = Director::getInstance()->getVisibleSize();
+    Vec2 origin = Director::getInstance()->getVisibleOrigin();
+    Vec2 center(origin.x + visibleSize.width / 2, origin.y + visibleSize.height / 2);
+    
+    // 只使用系统字体与纯色层，加载界面本身不依赖任何待加载的资源
+    _progressWidth = visibleSize.width * 0.6f;
+    auto barBg = LayerColor::create(Color4B(60, 60, 60, 255), _progressWidth, 24);
+    barBg->setPosition(Vec2(center.x - _progressWidth / 2, center.y - 12));
+    this->addChild(barBg);
+    
+    _progressBar = LayerColor::create(Color4B(70, 130, 180, 255), _progressWidth, 24);
+    _progressBar->setPosition(barBg->getPosition());
+    _progressBar->setAnchorPoint(Vec2::ZERO);
+    _progressBar->setScaleX(0.0f);
+    this->addChild(_progressBar);
+    
+    _progressLabel = Label::createWithSystemFont("", "Arial", 40);
+    _progressLabel->setPosition(Vec2(center.x, center.y + 60));
+    this->addChild(_progressLabel);
+    
+    updateProgress();
+    return true;
+}
+
+void LoadingScene::onEnter()
+{
+    Scene::onEnter();
+    
+    _startNanos = FrameProfiler::nowNanos();
+    if (s_launchNanos == 0) {
+        s_launchNanos = _startNanos;
+    }
+    
+    // 残局库在后台线程构建，与纹理预加载同时进行，不阻塞主线程
+    SharedTablebase::buildAsync();
+    
+    if (_paths.empty()) {
+        startGame();
+        return;
+    }
+    
+    // 已在缓存中的纹理会立即回调，全部命中时在这里就会切换场景（切换在下一帧生效）
+    TextureCache* textureCache = Director::getInstance()->getTextureCache();
+    for (const auto& path : _paths) {
+        textureCache->addImageAsync(path, CC_CALLBACK_1(LoadingScene::onTextureLoaded, this), path);
+    }
+}
+
+void LoadingScene::onExit()
+{
+    // 场景提前退出时不再回调到已销毁的对象
+    TextureCache* textureCache = Director::getInstance()->getTextureCache();
+    for (const auto& path : _paths) {
+        textureCache->unbindImageAsync(path);
+    }
+    
+    Scene::onExit();
+}
+
+void LoadingScene::onTextureLoaded(Texture2D* texture)
+{
+    // 加载期间没有动作也没有输入，靠回调保持满帧率，避免空闲帧率拖慢纹理上传
+    FramePacer::wake();
+    
+    _loadedCount++;
+    if (!texture) {
+        _failedCount++;
+    }
+    updateProgress();
+    
+    if (_loadedCount == static_cast<int>(_paths.size())) {
+        s_preloadMillis = (FrameProfiler::nowNanos() - _startNanos) / 1e6;
+        CCLOG("LoadingScene: %d textures preloaded in %.1f ms, %d failed", _loadedCount, s_preloadMillis,
+              _failedCount);
+        
+        // 此时缓存中只有预加载的纹理，即当前档位游戏场景的纹理内存
+        int textureCount = 0;
+        long textureKB = 0;
+        CocosAdapter::getTextureCacheUsage(textureCount, textureKB);
+        CCLOG("LoadingScene: asset tier %s, %d textures resident, %ld KB",
+              CardResConfig::getAssetTierName(CardResConfig::getAssetTier()).c_str(), textureCount, textureKB);
+        startGame();
+    }
+}
+
+void LoadingScene::updateProgress()
+{
+    int total = static_cast<int>(_paths.size());
+    float progress = total > 0 ? static_cast<float>(_loadedCount) / total : 1.0f;
+    _progressBar->setScaleX(progress);
+    _progressLabel->setString(StringUtils::format("Loading %d/%d", _loadedCount, total));
+}
+
+void LoadingScene::startGame()
+{
+    Director* director = Director::getInstance();
+    Scene* gameScene = GameScene::createScene();
+    director->replaceScene(gameScene);
+    
+    // 游戏场景成为运行场景后的第一次绘制完成即可交互；监听器不引用本场景，切换后本场景会被释放
+    EventDispatcher* dispatcher = director->getEventDispatcher();
+    if (s_firstFrameListener) {
+        dispatcher->removeEventListener(s_firstFrameListener);
+    }
+    s_firstFrameListener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW, [gameScene](EventCustom*) {
+        Director* director = Director::getInstance();
+        if (director->getRunningScene() != gameScene) {
+            return;
+        }
+        s_timeToInteractiveMillis = (FrameProfiler::nowNanos() - s_launchNanos) / 1e6;
+        CCLOG("LoadingScene: first interactive frame %.1f ms after launch", s_timeToInteractiveMillis);
+        director->getEventDispatcher()->removeEventListener(s_firstFrameListener);
+        s_firstFrameListener = nullptr;
+    });
+}
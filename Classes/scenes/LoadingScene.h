@@ -0,0 +1,80 @@
+/**
+ * LoadingScene.h
+ * 加载场景：异步预加载游戏用到的全部纹理，完成后进入游戏场景
+ */
+
+#ifndef __LOADING_SCENE_H__
+#define __LOADING_SCENE_H__
+
+#include "cocos2d.h"
+#include <string>
+#include <vector>
+
+/**
+ * 加载场景类
+ * 从CardResConfig列出全部图片，用TextureCache::addImageAsync在引擎的加载线程上解码，
+ * 主线程在回调中上传纹理并刷新进度；全部纹理进入缓存后切换到GameScene，
+ * 此后CardView与GameView创建精灵时不再同步解码图片。
+ * 记录从启动到GameScene第一帧绘制完成（可交互）的耗时
+ */
+class LoadingScene : public cocos2d::Scene
+{
+public:
+    /**
+     * 记录启动时刻，应在applicationDidFinishLaunching开头调用
+     */
+    static void markLaunch();
+    
+    /**
+     * 创建加载场景
+     * @return 加载场景
+     */
+    static cocos2d::Scene* createScene();
+    
+    /**
+     * 预加载耗时
+     * @return 毫秒，尚未完成时为负数
+     */
+    static double getPreloadMillis();
+    
+    /**
+     * 从启动到游戏场景第一帧绘制完成的耗时
+     * @return 毫秒，尚未完成时为负数
+     */
+    static double getTimeToInteractiveMillis();
+    
+    virtual bool init();
+    virtual void onEnter();
+    virtual void onExit();
+    
+    CREATE_FUNC(LoadingScene);
+    
+private:
+    LoadingScene();
+    
+    /**
+     * 一张纹理加载完成（失败时texture为nullptr）
+     * @param texture 纹理
+     */
+    void onTextureLoaded(cocos2d::Texture2D* texture);
+    
+    /**
+     * 刷新进度显示
+     */
+    void updateProgress();
+    
+    /**
+     * 切换到游戏场景，并在其第一帧绘制完成时记录可交互耗时
+     */
+    void startGame();
+    
+    std::vector<std::string> _paths;         // 待加载的图片
+    int _loadedCount;                        // 已完成的数量（含失败）
+    int _failedCount;                        // 加载失败的数量
+    uint64_t _startNanos;                    // 开始预加载的时刻
+    cocos2d::Label* _progressLabel;          // 进度文字
+    cocos2d::LayerColor* _progressBar;       // 进度条
+    float _progressWidth;                    // 进度条满格宽度
+};
+
+#endif // __LOADING_SCENE_H__
@@ -1,42 +1,51 @@
-/**
- * GameModelFromLevelGenerator.h
- * 游戏模型生成器，将关卡配置转换为游戏模型
- */
-
-#ifndef __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
-#define __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
-
-#include "cocos2d.h"
-#include "../models/GameModel.h"
-#include "../configs/models/LevelConfig.h"
-
-/**
- * 游戏模型生成器类，将关卡配置转换为游戏模型
- */
-class GameModelFromLevelGenerator
-{
-public:
-    /**
-     * 从关卡配置生成游戏模型
-     * @param levelConfig 关卡配置
-     * @return 游戏模型
-     */
-    static GameModel* generateGameModel(const LevelConfig* levelConfig);
-    
-private:
-    /**
-     * 生成主牌区卡牌
-     * @param cardConfigs 卡牌配置列表
-     * @return 卡牌模型列表
-     */
-    static std::vector<CardModel*> generatePlayfieldCards(const std::vector<CardConfig>& cardConfigs);
-    
-    /**
-     * 生成备用牌堆卡牌
-     * @param cardConfigs 卡牌配置列表
-     * @return 卡牌模型列表
-     */
-    static std::vector<CardModel*> generateStackCards(const std::vector<CardConfig>& cardConfigs);
-};
-
+/**
+ * GameModelFromLevelGenerator.h
+ * 游戏模型生成器，将关卡配置转换为游戏模型
+ */
+
+#ifndef __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
+#define __GAME_MODEL_FROM_LEVEL_GENERATOR_H__
+
+#include "../models/GameModel.h"
+#include "../configs/models/LevelConfig.h"
+#include "../core/generator/DealShuffler.h"
+
+/**
+ * 游戏模型生成器类，将关卡配置转换为游戏模型
+ */
+class GameModelFromLevelGenerator
+{
+public:
+    /**
+     * 从关卡配置生成游戏模型
+     * @param levelConfig 关卡配置
+     * @return 游戏模型
+     */
+    static GameModel* generateGameModel(const LevelConfig* levelConfig);
+    
+    /**
+     * 按（布局模板，种子，发牌参数）展开关卡并生成游戏模型，相同参数在各平台得到相同的牌局
+     * @param levelTemplate 布局模板
+     * @param seed 种子
+     * @param params 发牌参数
+     * @return 游戏模型，展开失败返回nullptr
+     */
+    static GameModel* generateGameModel(const LevelTemplate& levelTemplate, uint64_t seed, const DealShuffleParams& params);
+    
+private:
+    /**
+     * 生成主牌区卡牌
+     * @param cardConfigs 卡牌配置列表
+     * @return 卡牌模型列表
+     */
+    static std::vector<CardModel*> generatePlayfieldCards(const std::vector<CardConfig>& cardConfigs);
+    
+    /**
+     * 生成备用牌堆卡牌
+     * @param cardConfigs 卡牌配置列表
+     * @return 卡牌模型列表
+     */
+    static std::vector<CardModel*> generateStackCards(const std::vector<CardConfig>& cardConfigs);
+};
+
 #endif // __GAME_MODEL_FROM_LEVEL_GENERATOR_H__ 
\ No newline at end of file
@@ -1,172 +1,240 @@
-/**
- * GameView.h
- * 游戏视图类，负责整个游戏UI的展示
- */
-
-#ifndef __GAME_VIEW_H__
-#define __GAME_VIEW_H__
-
-#include "cocos2d.h"
-#include "ui/CocosGUI.h"
-#include "CardView.h"
-#include "../models/GameModel.h"
-
-// 前置声明，避免循环引用
-class GameController;
-class UndoManager;
-
-/**
- * 游戏视图类，管理游戏UI展示
- */
-class GameView : public cocos2d::Node
-{
-public:
-    // 将GameController和UndoManager设为友元类，使其能够访问私有成员
-    friend class GameController;
-    friend class UndoManager;
-    
-    /**
-     * 创建游戏视图
-     * @param model 游戏数据模型
-     * @return 游戏视图对象
-     */
-    static GameView* create(const GameModel* model);
-    
-    /**
-     * 初始化游戏视图
-     * @param model 游戏数据模型
-     * @return 是否初始化成功
-     */
-    virtual bool init(const GameModel* model);
-    
-    /**
-     * 设置游戏控制器引用
-     * @param controller 游戏控制器指针
-     */
-    void setGameController(GameController* controller) { _gameController = controller; }
-    
-    /**
-     * 设置主牌区卡牌点击回调
-     * @param callback 点击回调函数
-     */
-    void setOnPlayfieldCardClickCallback(const std::function<void(int)>& callback);
-    
-    /**
-     * 获取主牌区卡牌点击回调
-     * @return 点击回调函数
-     */
-    std::function<void(int)> getCardClickCallback() const;
-    
-    /**
-     * 设置备用牌堆点击回调
-     * @param callback 点击回调函数
-     */
-    void setOnStackClickCallback(const std::function<void()>& callback);
-    
-    /**
-     * 设置回退按钮点击回调
-     * @param callback 点击回调函数
-     */
-    void setOnUndoClickCallback(const std::function<void()>& callback);
-    
-    /**
-     * 更新手牌区顶部卡牌
-     * @param card 卡牌模型
-     */
-    void updateTrayTopCard(const CardModel* card);
-    
-    /**
-     * 播放卡牌从主牌区移动到手牌区的动画
-     * @param cardId 要移动的卡牌ID
-     */
-    void playCardMoveToTrayAnimation(int cardId);
-    
-    /**
-     * 播放卡牌直接覆盖手牌的动画
-     * @param cardId 要移动的卡牌ID
-     */
-    void playDirectCoverAnimation(int cardId);
-    
-    /**
-     * 播放从备用牌堆到手牌区的动画
-     */
-    void playStackToTrayAnimation();
-    
-    /**
-     * 播放卡牌从手牌区移动到目标位置的动画
-     * @param targetPos 目标位置
-     * @param callback 动画完成回调
-     */
-    void playTrayToPositionAnimation(const cocos2d::Vec2& targetPos, const std::function<void()>& callback = nullptr);
-    
-    /**
-     * 移除主牌区卡牌
-     * @param cardId 卡牌ID
-     */
-    void removePlayfieldCard(int cardId);
-    
-    /**
-     * 使用新的卡牌视图更新手牌区
-     * @param cardView 新的卡牌视图
-     */
-    void setTrayTopCardView(CardView* cardView);
-    
-    /**
-     * 启用/禁用主牌区卡牌交互
-     * @param enabled 是否启用交互
-     */
-    void setPlayfieldCardsInteractive(bool enabled);
-    
-    /**
-     * 启用/禁用备用牌堆交互
-     * @param enabled 是否启用交互
-     */
-    void setStackInteractive(bool enabled);
-    
-    /**
-     * 启用/禁用回退按钮
-     * @param enabled 是否启用
-     */
-    void setUndoButtonEnabled(bool enabled);
-    
-private:
-    const GameModel* _model;                     // 游戏数据模型
-    GameController* _gameController;             // 游戏控制器
-    std::map<int, CardView*> _playfieldCardViews; // 主牌区卡牌视图
-    CardView* _trayTopCardView;                  // 手牌区顶部卡牌视图
-    cocos2d::Node* _stackNode;                   // 备用牌堆节点
-    cocos2d::ui::Button* _undoButton;            // 回退按钮
-    
-    cocos2d::Node* _playfieldLayer;              // 主牌区层
-    cocos2d::Node* _trayLayer;                   // 手牌区层
-    cocos2d::Node* _stackLayer;                  // 备用牌堆层
-    
-    std::function<void(int)> _cardClickCallback;  // 卡牌点击回调函数
-    
-    /**
-     * 初始化游戏区域
-     */
-    void initGameAreas();
-    
-    /**
-     * 初始化主牌区卡牌
-     */
-    void initPlayfieldCards();
-    
-    /**
-     * 初始化手牌区
-     */
-    void initTray();
-    
-    /**
-     * 初始化备用牌堆
-     */
-    void initStack();
-    
-    /**
-     * 初始化UI控件
-     */
-    void initUI();
-};
-
+/**
+ * GameView.h
+ * 游戏视图类，负责整个游戏UI的展示
+ */
+
+#ifndef __GAME_VIEW_H__
+#define __GAME_VIEW_H__
+
+#include "cocos2d.h"
+#include "ui/CocosGUI.h"
+#include "CardView.h"
+#include "PlayfieldRenderer.h"
+#include "../models/GameModel.h"
+
+// 前置声明，避免循环引用
+class GameController;
+class UndoManager;
+
+/**
+ * 游戏视图类，管理游戏UI展示
+ */
+class GameView : public cocos2d::Node
+{
+public:
+    // 将GameController和UndoManager设为友元类，使其能够访问私有成员
+    friend class GameController;
+    friend class UndoManager;
+    
+    /**
+     * 创建游戏视图
+     * @param model 游戏数据模型
+     * @return 游戏视图对象
+     */
+    static GameView* create(const GameModel* model);
+    
+    /**
+     * 初始化游戏视图
+     * @param model 游戏数据模型
+     * @return 是否初始化成功
+     */
+    virtual bool init(const GameModel* model);
+    
+    /**
+     * 设置游戏控制器引用
+     * @param controller 游戏控制器指针
+     */
+    void setGameController(GameController* controller) { _gameController = controller; }
+    
+    /**
+     * 设置主牌区卡牌点击回调
+     * @param callback 点击回调函数
+     */
+    void setOnPlayfieldCardClickCallback(const std::function<void(int)>& callback);
+    
+    /**
+     * 获取主牌区卡牌点击回调
+     * @return 点击回调函数
+     */
+    std::function<void(int)> getCardClickCallback() const;
+    
+    /**
+     * 设置备用牌堆点击回调
+     * @param callback 点击回调函数
+     */
+    void setOnStackClickCallback(const std::function<void()>& callback);
+    
+    /**
+     * 设置回退按钮点击回调
+     * @param callback 点击回调函数
+     */
+    void setOnUndoClickCallback(const std::function<void()>& callback);
+    
+    /**
+     * 更新手牌区顶部卡牌
+     * @param card 卡牌模型
+     */
+    void updateTrayTopCard(const CardModel* card);
+    
+    /**
+     * 播放卡牌从主牌区移动到手牌区的动画
+     * @param cardId 要移动的卡牌ID
+     */
+    void playCardMoveToTrayAnimation(int cardId);
+    
+    /**
+     * 播放卡牌直接覆盖手牌的动画
+     * @param cardId 要移动的卡牌ID
+     */
+    void playDirectCoverAnimation(int cardId);
+    
+    /**
+     * 播放从备用牌堆到手牌区的动画
+     */
+    void playStackToTrayAnimation();
+    
+    /**
+     * 播放卡牌从手牌区移动到目标位置的动画
+     * @param targetPos 目标位置
+     * @param callback 动画完成回调
+     */
+    void playTrayToPositionAnimation(const cocos2d::Vec2& targetPos, const std::function<void()>& callback = nullptr);
+    
+    /**
+     * 移除主牌区卡牌
+     * @param cardId 卡牌ID
+     */
+    void removePlayfieldCard(int cardId);
+    
+    /**
+     * 把卡牌放回主牌区（回退动画结束时调用），由主牌区渲染器绘制
+     * @param card 卡牌模型
+     */
+    void restorePlayfieldCard(const CardModel* card);
+    
+    /**
+     * 使用新的卡牌视图更新手牌区
+     * @param cardView 新的卡牌视图
+     */
+    void setTrayTopCardView(CardView* cardView);
+    
+    /**
+     * 启用/禁用主牌区卡牌交互
+     * @param enabled 是否启用交互
+     */
+    void setPlayfieldCardsInteractive(bool enabled);
+    
+    /**
+     * 启用/禁用备用牌堆交互
+     * @param enabled 是否启用交互
+     */
+    void setStackInteractive(bool enabled);
+    
+    /**
+     * 启用/禁用回退按钮
+     * @param enabled 是否启用
+     */
+    void setUndoButtonEnabled(bool enabled);
+    
+    /**
+     * 设置提示按钮点击回调
+     * @param callback 点击回调函数
+     */
+    void setOnHintClickCallback(const std::function<void()>& callback);
+    
+    /**
+     * 启用/禁用提示按钮
+     * @param enabled 是否启用
+     */
+    void setHintButtonEnabled(bool enabled);
+    
+    /**
+     * 高亮提示的操作
+     * @param cardId 主牌区卡牌ID，-1表示备用牌堆
+     */
+    void showHint(int cardId);
+    
+    /**
+     * 清除提示高亮
+     */
+    void clearHint();
+    
+    /**
+     * 显示/隐藏"已无法通关"提示
+     * @param visible 是否显示
+     */
+    void setNoWinsLeftVisible(bool visible);
+    
+    /**
+     * 获取可点击目标中心的世界坐标，供自动化输入使用
+     * @param target 主牌区卡牌ID，TOUCH_TARGET_STACK为备用牌堆，TOUCH_TARGET_UNDO为回退按钮
+     * @param position 输出世界坐标
+     * @return 目标不存在或不可见时返回false
+     */
+    bool getTouchTargetPosition(int target, cocos2d::Vec2& position) const;
+    
+    static const int TOUCH_TARGET_STACK = -1;    // 备用牌堆
+    static const int TOUCH_TARGET_UNDO = -2;     // 回退按钮
+    
+private:
+    const GameModel* _model;                     // 游戏数据模型
+    GameController* _gameController;             // 游戏控制器
+    PlayfieldRenderer* _playfieldRenderer;       // 主牌区渲染器，绘制全部静止的主牌区卡牌
+    std::map<int, CardView*> _playfieldCardViews; // 临时换成卡牌视图的主牌区卡牌（动画中或高亮中）
+    bool _playfieldInteractive;                  // 主牌区卡牌是否可点击
+    int _pressedCardId;                          // 按下的主牌区卡牌，-1表示没有
+    CardView* _trayTopCardView;                  // 手牌区顶部卡牌视图
+    cocos2d::Node* _stackNode;                   // 备用牌堆节点
+    cocos2d::ui::Button* _undoButton;            // 回退按钮
+    cocos2d::ui::Button* _hintButton;            // 提示按钮
+    cocos2d::Node* _hintNode;                    // 当前高亮的节点
+    float _hintScale;                            // 高亮节点的原始缩放
+    int _hintCardId;                             // 高亮的主牌区卡牌，-1表示没有
+    cocos2d::Label* _noWinsLabel;                // "已无法通关"提示
+    
+    cocos2d::Node* _playfieldLayer;              // 主牌区层
+    cocos2d::Node* _trayLayer;                   // 手牌区层
+    cocos2d::Node* _stackLayer;                  // 备用牌堆层
+    
+    std::function<void(int)> _cardClickCallback;  // 卡牌点击回调函数
+    
+    /**
+     * 初始化游戏区域
+     */
+    void initGameAreas();
+    
+    /**
+     * 初始化主牌区卡牌
+     */
+    void initPlayfieldCards();
+    
+    /**
+     * 把主牌区卡牌换成卡牌视图（用于动画和高亮），对应的四边形隐藏
+     * @param cardId 卡牌ID
+     * @return 卡牌视图，卡牌不在主牌区时返回nullptr
+     */
+    CardView* promotePlayfieldCard(int cardId);
+    
+    /**
+     * 移除卡牌视图，卡牌重新由主牌区渲染器绘制
+     * @param cardId 卡牌ID
+     */
+    void demotePlayfieldCard(int cardId);
+    
+    /**
+     * 初始化手牌区
+     */
+    void initTray();
+    
+    /**
+     * 初始化备用牌堆
+     */
+    void initStack();
+    
+    /**
+     * 初始化UI控件
+     */
+    void initUI();
+};
+
 #endif // __GAME_VIEW_H__ 
\ No newline at end of file
@@ -0,0 +1,406 @@
+/**
+ * PlayfieldRenderer.cpp
+ * 主牌区渲染器实现
+ */
+
+#include "PlayfieldRenderer.h"
+#include "CardView.h"
+#include "../adapters/CocosAdapter.h"
+#include <algorithm>
+#include <string.h>
+
+USING_NS_CC;
+
+// 卡牌尺寸，与CardView一致
+static const float CARD_WIDTH = 182.0f;
+static const float CARD_HEIGHT = 282.0f;
+
+// 图集每行的格子数，格子之间留出空白避免线性过滤时相邻牌面渗色
+static const int ATLAS_COLUMNS = 8;
+static const float ATLAS_PADDING = 2.0f;
+static const float ATLAS_CELL_WIDTH = CARD_WIDTH + ATLAS_PADDING * 2;
+static const float ATLAS_CELL_HEIGHT = CARD_HEIGHT + ATLAS_PADDING * 2;
+
+/**
+ * 图集格子中心的位置（点，原点在左下角）
+ */
+static Vec2 getAtlasCellCenter(int cell)
+{
+    return Vec2((cell % ATLAS_COLUMNS + 0.5f) * ATLAS_CELL_WIDTH, (cell / ATLAS_COLUMNS + 0.5f) * ATLAS_CELL_HEIGHT);
+}
+
+PlayfieldRenderer* PlayfieldRenderer::create(const GameModel* model)
+{
+    PlayfieldRenderer* renderer = new (std::nothrow) PlayfieldRenderer();
+    if (renderer && renderer->init(model)) {
+        renderer->autorelease();
+        return renderer;
+    }
+    CC_SAFE_DELETE(renderer);
+    return nullptr;
+}
+
+PlayfieldRenderer::PlayfieldRenderer()
+    : _visibleCount(0)
+    , _dirtyBegin(0)
+    , _dirtyEnd(0)
+    , _atlas(nullptr)
+    , _atlasRendered(false)
+    , _bufferCapacity(0)
+{
+    _buffers[0] = 0;
+    _buffers[1] = 0;
+}
+
+PlayfieldRenderer::~PlayfieldRenderer()
+{
+    if (_buffers[0]) {
+        glDeleteBuffers(2, _buffers);
+    }
+    releaseAtlasSources();
+    CC_SAFE_RELEASE_NULL(_atlas);
+}
+
+bool PlayfieldRenderer::init(const GameModel* model)
+{
+    if (!Node::init() || !model) {
+        return false;
+    }
+    
+    // 先登记全部牌面再合成一次图集，避免逐张追加时反复重建
+    for (const auto& card : model->getPlayfieldCards()) {
+        int faceKey = card->getFace() * CST_NUM_CARD_SUIT_TYPES + card->getSuit();
+        if (std::find(_atlasFaces.begin(), _atlasFaces.end(), faceKey) == _atlasFaces.end()) {
+            _atlasFaces.push_back(faceKey);
+        }
+    }
+    if (!_atlasFaces.empty() && !composeAtlas()) {
+        return false;
+    }
+    
+    for (const auto& card : model->getPlayfieldCards()) {
+        updateCard(card);
+    }
+    
+    setGLProgramState(GLProgramState::getOrCreateWithGLProgramName(GLProgram::SHADER_NAME_POSITION_TEXTURE_COLOR));
+    _customCommand.func = CC_CALLBACK_0(PlayfieldRenderer::onDraw, this);
+
+#if CC_ENABLE_CACHE_TEXTURE_DATA
+    auto listener = EventListenerCustom::create(EVENT_RENDERER_RECREATED, [this](EventCustom*) {
+        onRendererRecreated();
+    });
+    _eventDispatcher->addEventListenerWithSceneGraphPriority(listener, this);
+#endif
+
+    return true;
+}
+
+void PlayfieldRenderer::updateCard(const CardModel* card)
+{
+    if (!card) {
+        return;
+    }
+    
+    int slot;
+    auto it = _slotByCardId.find(card->getCardId());
+    if (it != _slotByCardId.end()) {
+        slot = it->second;
+    } else {
+        CardSlot newSlot;
+        newSlot.cardId = card->getCardId();
+        newSlot.atlasCell = getAtlasCell(card->getFace(), card->getSuit());
+        newSlot.scale = 1.0f;
+        newSlot.visible = false;
+        slot = static_cast<int>(_slots.size());
+        _slots.push_back(newSlot);
+        _quads.push_back(V3F_C4B_T2F_Quad());
+        _slotByCardId[newSlot.cardId] = slot;
+    }
+    
+    CardSlot& target = _slots[slot];
+    target.position = CocosAdapter::toVec2(card->getPosition());
+    target.scale = 1.0f;
+    if (!target.visible) {
+        target.visible = true;
+        _visibleCount++;
+    }
+    writeQuad(slot);
+}
+
+void PlayfieldRenderer::setCardVisible(int cardId, bool visible)
+{
+    auto it = _slotByCardId.find(cardId);
+    if (it == _slotByCardId.end() || _slots[it->second].visible == visible) {
+        return;
+    }
+    
+    _slots[it->second].visible = visible;
+    _visibleCount += visible ? 1 : -1;
+    writeQuad(it->second);
+}
+
+bool PlayfieldRenderer::isCardVisible(int cardId) const
+{
+    auto it = _slotByCardId.find(cardId);
+    return it != _slotByCardId.end() && _slots[it->second].visible;
+}
+
+void PlayfieldRenderer::setCardScale(int cardId, float scale)
+{
+    auto it = _slotByCardId.find(cardId);
+    if (it == _slotByCardId.end() || _slots[it->second].scale == scale) {
+        return;
+    }
+    
+    _slots[it->second].scale = scale;
+    writeQuad(it->second);
+}
+
+bool PlayfieldRenderer::getCardPosition(int cardId, Vec2& position) const
+{
+    auto it = _slotByCardId.find(cardId);
+    if (it == _slotByCardId.end()) {
+        return false;
+    }
+    
+    position = _slots[it->second].position;
+    return true;
+}
+
+int PlayfieldRenderer::hitTest(const Vec2& location) const
+{
+    // 后面的槽位画在上层，从后往前找
+    for (auto it = _slots.rbegin(); it != _slots.rend(); ++it) {
+        if (!it->visible) {
+            continue;
+        }
+        Rect rect(it->position.x - CARD_WIDTH / 2, it->position.y - CARD_HEIGHT / 2, CARD_WIDTH, CARD_HEIGHT);
+        if (rect.containsPoint(location)) {
+            return it->cardId;
+        }
+    }
+    return -1;
+}
+
+void PlayfieldRenderer::draw(Renderer* renderer, const Mat4& transform, uint32_t flags)
+{
+    // 上一次合成的图集已经画完，合成用的视图不再需要
+    if (_atlasRendered) {
+        releaseAtlasSources();
+    }
+    
+    if (_visibleCount == 0 || !_atlas) {
+        return;
+    }
+    
+    _drawTransform = transform;
+    _customCommand.init(_globalZOrder, transform, flags);
+    renderer->addCommand(&_customCommand);
+}
+
+int PlayfieldRenderer::getAtlasCell(CardFaceType face, CardSuitType suit)
+{
+    int faceKey = face * CST_NUM_CARD_SUIT_TYPES + suit;
+    auto it = std::find(_atlasFaces.begin(), _atlasFaces.end(), faceKey);
+    if (it != _atlasFaces.end()) {
+        return static_cast<int>(it - _atlasFaces.begin());
+    }
+    
+    // 只有回退恢复了初始化时没有的牌面才会走到这里
+    _atlasFaces.push_back(faceKey);
+    composeAtlas();
+    return static_cast<int>(_atlasFaces.size()) - 1;
+}
+
+bool PlayfieldRenderer::composeAtlas()
+{
+    int cellCount = static_cast<int>(_atlasFaces.size());
+    int columns = std::min(cellCount, ATLAS_COLUMNS);
+    int rows = (cellCount + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS;
+    _atlasSize = Size(columns * ATLAS_CELL_WIDTH, rows * ATLAS_CELL_HEIGHT);
+    
+    // 旧图集的渲染命令可能还在队列中，留到本帧结束再释放
+    if (_atlas) {
+        _atlas->autorelease();
+        _atlas = nullptr;
+    }
+    _atlas = RenderTexture::create(static_cast<int>(_atlasSize.width), static_cast<int>(_atlasSize.height),
+                                   Texture2D::PixelFormat::RGBA8888);
+    if (!_atlas) {
+        CCLOG("PlayfieldRenderer: failed to create %dx%d atlas", static_cast<int>(_atlasSize.width),
+              static_cast<int>(_atlasSize.height));
+        return false;
+    }
+    _atlas->retain();
+    
+    // 渲染纹理按内容缩放因子（即资源档位缩放）换算像素，图集与档位图片同一分辨率；
+    // 它不在TextureCache中，预加载日志与自动对局的纹理内存都不含这一项，这里单独记录
+    Texture2D* atlasTexture = _atlas->getSprite()->getTexture();
+    CCLOG("PlayfieldRenderer: %d faces, atlas %dx%d px, %d KB", cellCount, atlasTexture->getPixelsWide(),
+          atlasTexture->getPixelsHigh(), atlasTexture->getPixelsWide() * atlasTexture->getPixelsHigh() * 4 / 1024);
+    
+    // 用CardView绘制牌面，与动画中的卡牌外观完全一致；命令在下一次渲染时执行
+    releaseAtlasSources();
+    Renderer* renderer = Director::getInstance()->getRenderer();
+    _atlas->beginWithClear(0, 0, 0, 0);
+    for (int cell = 0; cell < cellCount; cell++) {
+        CardFaceType face = static_cast<CardFaceType>(_atlasFaces[cell] / CST_NUM_CARD_SUIT_TYPES);
+        CardSuitType suit = static_cast<CardSuitType>(_atlasFaces[cell] % CST_NUM_CARD_SUIT_TYPES);
+        CardModel* model = new CardModel(-1, face, suit, CocosAdapter::fromVec2(getAtlasCellCenter(cell)));
+        _atlasModels.push_back(model);
+        CardView* view = CardView::create(model);
+        if (view) {
+            view->visit(renderer, Mat4::IDENTITY, 0);
+            _atlasSources.pushBack(view);
+        }
+    }
+    _atlas->end();
+    _atlasRendered = false;
+    
+    // 图集尺寸变了，全部纹理坐标都要重写
+    for (int slot = 0; slot < static_cast<int>(_slots.size()); slot++) {
+        writeQuad(slot);
+    }
+    return true;
+}
+
+void PlayfieldRenderer::releaseAtlasSources()
+{
+    _atlasSources.clear();
+    for (CardModel* model : _atlasModels) {
+        delete model;
+    }
+    _atlasModels.clear();
+    _atlasRendered = false;
+}
+
+void PlayfieldRenderer::writeQuad(int slot)
+{
+    const CardSlot& card = _slots[slot];
+    V3F_C4B_T2F_Quad& quad = _quads[slot];
+    
+    // 隐藏的卡牌写成退化四边形，不改变索引和绘制调用
+    if (!card.visible || !_atlas) {
+        memset(&quad, 0, sizeof(quad));
+    } else {
+        float halfWidth = CARD_WIDTH * card.scale / 2;
+        float halfHeight = CARD_HEIGHT * card.scale / 2;
+        float left = card.position.x - halfWidth;
+        float right = card.position.x + halfWidth;
+        float bottom = card.position.y - halfHeight;
+        float top = card.position.y + halfHeight;
+        quad.tl.vertices = Vec3(left, top, 0);
+        quad.bl.vertices = Vec3(left, bottom, 0);
+        quad.tr.vertices = Vec3(right, top, 0);
+        quad.br.vertices = Vec3(right, bottom, 0);
+        
+        // 渲染纹理的原点在左下角，纹理坐标不用翻转
+        Texture2D* texture = _atlas->getSprite()->getTexture();
+        Vec2 center = getAtlasCellCenter(card.atlasCell);
+        float u0 = (center.x - CARD_WIDTH / 2) / _atlasSize.width * texture->getMaxS();
+        float u1 = (center.x + CARD_WIDTH / 2) / _atlasSize.width * texture->getMaxS();
+        float v0 = (center.y - CARD_HEIGHT / 2) / _atlasSize.height * texture->getMaxT();
+        float v1 = (center.y + CARD_HEIGHT / 2) / _atlasSize.height * texture->getMaxT();
+        quad.tl.texCoords = Tex2F(u0, v1);
+        quad.bl.texCoords = Tex2F(u0, v0);
+        quad.tr.texCoords = Tex2F(u1, v1);
+        quad.br.texCoords = Tex2F(u1, v0);
+        
+        quad.tl.colors = Color4B::WHITE;
+        quad.bl.colors = Color4B::WHITE;
+        quad.tr.colors = Color4B::WHITE;
+        quad.br.colors = Color4B::WHITE;
+    }
+    
+    if (_dirtyBegin >= _dirtyEnd) {
+        _dirtyBegin = slot;
+        _dirtyEnd = slot + 1;
+    } else {
+        _dirtyBegin = std::min(_dirtyBegin, slot);
+        _dirtyEnd = std::max(_dirtyEnd, slot + 1);
+    }
+}
+
+void PlayfieldRenderer::setupBuffers()
+{
+    if (_buffers[0]) {
+        glDeleteBuffers(2, _buffers);
+    }
+    
+    // 按2的幂留出余量，回退追加槽位时一般不用重建
+    _bufferCapacity = 16;
+    while (_bufferCapacity < static_cast<int>(_quads.size())) {
+        _bufferCapacity *= 2;
+    }
+    
+    std::vector<GLushort> indices(_bufferCapacity * 6);
+    for (int i = 0; i < _bufferCapacity; i++) {
+        indices[i * 6 + 0] = static_cast<GLushort>(i * 4 + 0);
+        indices[i * 6 + 1] = static_cast<GLushort>(i * 4 + 1);
+        indices[i * 6 + 2] = static_cast<GLushort>(i * 4 + 2);
+        indices[i * 6 + 3] = static_cast<GLushort>(i * 4 + 3);
+        indices[i * 6 + 4] = static_cast<GLushort>(i * 4 + 2);
+        indices[i * 6 + 5] = static_cast<GLushort>(i * 4 + 1);
+    }
+    
+    glGenBuffers(2, _buffers);
+    glBindBuffer(GL_ARRAY_BUFFER, _buffers[0]);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(V3F_C4B_T2F_Quad) * _bufferCapacity, nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(V3F_C4B_T2F_Quad) * _quads.size(), _quads.data());
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _buffers[1]);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLushort) * indices.size(), indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    CHECK_GL_ERROR_DEBUG();
+    
+    _dirtyBegin = 0;
+    _dirtyEnd = 0;
+}
+
+void PlayfieldRenderer::onDraw()
+{
+    // 上传改动过的槽位；静止的牌面没有任何逐张开销
+    int quadCount = static_cast<int>(_quads.size());
+    if (_bufferCapacity < quadCount || !_buffers[0]) {
+        setupBuffers();
+    } else if (_dirtyBegin < _dirtyEnd) {
+        glBindBuffer(GL_ARRAY_BUFFER, _buffers[0]);
+        glBufferSubData(GL_ARRAY_BUFFER, sizeof(V3F_C4B_T2F_Quad) * _dirtyBegin,
+                        sizeof(V3F_C4B_T2F_Quad) * (_dirtyEnd - _dirtyBegin), &_quads[_dirtyBegin]);
+        _dirtyBegin = 0;
+        _dirtyEnd = 0;
+    }
+    
+    // 图集的渲染命令排在本命令之前，到这里已经画完
+    _atlasRendered = true;
+    
+    getGLProgramState()->apply(_drawTransform);
+    GL::bindTexture2D(_atlas->getSprite()->getTexture()->getName());
+    GL::blendFunc(BlendFunc::ALPHA_PREMULTIPLIED.src, BlendFunc::ALPHA_PREMULTIPLIED.dst);
+    
+    GL::bindVAO(0);
+    glBindBuffer(GL_ARRAY_BUFFER, _buffers[0]);
+    GL::enableVertexAttribs(GL::VERTEX_ATTRIB_FLAG_POS_COLOR_TEX);
+    glVertexAttribPointer(GLProgram::VERTEX_ATTRIB_POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(V3F_C4B_T2F),
+                          (GLvoid*)offsetof(V3F_C4B_T2F, vertices));
+    glVertexAttribPointer(GLProgram::VERTEX_ATTRIB_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(V3F_C4B_T2F),
+                          (GLvoid*)offsetof(V3F_C4B_T2F, colors));
+    glVertexAttribPointer(GLProgram::VERTEX_ATTRIB_TEX_COORD, 2, GL_FLOAT, GL_FALSE, sizeof(V3F_C4B_T2F),
+                          (GLvoid*)offsetof(V3F_C4B_T2F, texCoords));
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _buffers[1]);
+    glDrawElements(GL_TRIANGLES, quadCount * 6, GL_UNSIGNED_SHORT, nullptr);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    
+    CC_INCREMENT_GL_DRAWN_BATCHES_AND_VERTICES(1, quadCount * 4);
+    CHECK_GL_ERROR_DEBUG();
+}
+
+void PlayfieldRenderer::onRendererRecreated()
+{
+    // 旧的缓冲名已随上下文失效，不能再删除
+    _buffers[0] = 0;
+    _buffers[1] = 0;
+    _bufferCapacity = 0;
+    composeAtlas();
+}
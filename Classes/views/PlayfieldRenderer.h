@@ -0,0 +1,164 @@
+/**
+ * PlayfieldRenderer.h
+ * 主牌区渲染器，用一个持久的顶点缓冲和一条自定义绘制命令绘制主牌区的静止卡牌
+ */
+
+#ifndef __PLAYFIELD_RENDERER_H__
+#define __PLAYFIELD_RENDERER_H__
+
+#include "cocos2d.h"
+#include "../models/GameModel.h"
+#include <map>
+#include <vector>
+
+/**
+ * 主牌区渲染器类
+ * 初始化时把主牌区用到的牌面合成到一张图集纹理上，每张卡牌在顶点缓冲中占一个固定的四边形槽位，
+ * 按GameModel主牌区的顺序排列（后面的盖住前面的）。卡牌移动、隐藏或缩放时只改写对应槽位，
+ * 绘制时把改动过的槽位区间上传到GPU，再用一次glDrawElements画出全部卡牌。
+ * 每帧的CPU开销只是提交一条CustomCommand，与卡牌数量无关；
+ * 播放动画的卡牌由GameView临时换成CardView，期间对应的四边形隐藏
+ */
+class PlayfieldRenderer : public cocos2d::Node
+{
+public:
+    /**
+     * 创建主牌区渲染器
+     * @param model 游戏数据模型，按其主牌区卡牌建立槽位
+     * @return 渲染器对象
+     */
+    static PlayfieldRenderer* create(const GameModel* model);
+    
+    /**
+     * 初始化主牌区渲染器
+     * @param model 游戏数据模型
+     * @return 是否初始化成功
+     */
+    virtual bool init(const GameModel* model);
+    
+    /**
+     * 按卡牌模型写入位置并显示，没有槽位的卡牌追加到最上层
+     * @param card 卡牌模型
+     */
+    void updateCard(const CardModel* card);
+    
+    /**
+     * 显示/隐藏卡牌
+     * @param cardId 卡牌ID
+     * @param visible 是否显示
+     */
+    void setCardVisible(int cardId, bool visible);
+    
+    /**
+     * 卡牌是否显示
+     * @param cardId 卡牌ID
+     * @return 没有槽位或已隐藏时返回false
+     */
+    bool isCardVisible(int cardId) const;
+    
+    /**
+     * 设置卡牌绕中心的缩放，用于按下反馈
+     * @param cardId 卡牌ID
+     * @param scale 缩放
+     */
+    void setCardScale(int cardId, float scale);
+    
+    /**
+     * 获取卡牌中心在本节点坐标系中的位置
+     * @param cardId 卡牌ID
+     * @param position 输出位置
+     * @return 没有槽位时返回false
+     */
+    bool getCardPosition(int cardId, cocos2d::Vec2& position) const;
+    
+    /**
+     * 查找覆盖指定点的最上层可见卡牌
+     * @param location 本节点坐标系中的点
+     * @return 卡牌ID，没有时返回-1
+     */
+    int hitTest(const cocos2d::Vec2& location) const;
+    
+    /**
+     * 提交绘制命令
+     */
+    virtual void draw(cocos2d::Renderer* renderer, const cocos2d::Mat4& transform, uint32_t flags) override;
+    
+protected:
+    PlayfieldRenderer();
+    virtual ~PlayfieldRenderer();
+    
+private:
+    /**
+     * 一张卡牌的槽位状态
+     */
+    struct CardSlot
+    {
+        int cardId;
+        int atlasCell;              // 牌面在图集中的格子
+        cocos2d::Vec2 position;     // 中心位置
+        float scale;
+        bool visible;
+    };
+    
+    /**
+     * 获取牌面对应的图集格子，图集中没有时追加并重新合成图集
+     * @param face 点数
+     * @param suit 花色
+     * @return 格子下标
+     */
+    int getAtlasCell(CardFaceType face, CardSuitType suit);
+    
+    /**
+     * 把全部格子的牌面绘制到新的图集纹理上，并重写全部四边形
+     * 合成用的卡牌视图要保留到图集真正渲染完成
+     * @return 是否创建成功
+     */
+    bool composeAtlas();
+    
+    /**
+     * 释放合成图集用的卡牌视图与模型
+     */
+    void releaseAtlasSources();
+    
+    /**
+     * 按槽位状态重写一个四边形并记录改动区间
+     * @param slot 槽位下标
+     */
+    void writeQuad(int slot);
+    
+    /**
+     * 创建（或在容量不足时重建）顶点与索引缓冲，并上传全部四边形
+     */
+    void setupBuffers();
+    
+    /**
+     * 渲染线程上执行的绘制：上传改动区间后一次绘制全部四边形
+     */
+    void onDraw();
+    
+    /**
+     * GL上下文重建后缓冲与图集都已失效，重新创建
+     */
+    void onRendererRecreated();
+    
+    std::vector<CardSlot> _slots;                     // 槽位，顺序即绘制顺序
+    std::map<int, int> _slotByCardId;                 // 卡牌ID到槽位下标
+    std::vector<cocos2d::V3F_C4B_T2F_Quad> _quads;    // 与槽位一一对应的四边形
+    int _visibleCount;                                // 可见的卡牌数
+    int _dirtyBegin;                                  // 尚未上传的槽位区间[begin, end)
+    int _dirtyEnd;
+    
+    std::vector<int> _atlasFaces;                     // 每个图集格子的牌面键（点数*花色数+花色）
+    cocos2d::RenderTexture* _atlas;                   // 牌面图集
+    cocos2d::Size _atlasSize;                         // 图集尺寸（点）
+    cocos2d::Vector<cocos2d::Node*> _atlasSources;    // 合成图集用的卡牌视图
+    std::vector<CardModel*> _atlasModels;             // 合成图集用的卡牌模型
+    bool _atlasRendered;                              // 图集已经渲染，合成用的视图可以释放
+    
+    GLuint _buffers[2];                               // 顶点缓冲与索引缓冲
+    int _bufferCapacity;                              // 缓冲可容纳的四边形数
+    cocos2d::Mat4 _drawTransform;                     // 本帧的模型视图矩阵
+    cocos2d::CustomCommand _customCommand;            // 绘制命令
+};
+
+#endif // __PLAYFIELD_RENDERER_H__
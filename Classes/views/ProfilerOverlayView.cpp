@@ -0,0 +1,270 @@
+/**
+ * ProfilerOverlayView.cpp
+ * 分子系统帧耗时浮层实现
+ */
+
+#include "ProfilerOverlayView.h"
+
+#if CARD_PROFILING
+
+#include "../core/profile/FrameProfiler.h"
+#include "../core/profile/TraceRecorder.h"
+#include "../core/profile/AllocationTracker.h"
+
+USING_NS_CC;
+
+// 文字刷新间隔（秒）
+static const float REFRESH_INTERVAL = 0.5f;
+
+/**
+ * 带计时的动作管理器，把每帧的动作更新记入PS_ACTIONS
+ */
+class ProfiledActionManager : public ActionManager
+{
+public:
+    virtual void update(float dt) override
+    {
+        CORE_PROFILE_SCOPE(PS_ACTIONS);
+        ActionManager::update(dt);
+    }
+};
+
+ProfilerOverlayView* ProfilerOverlayView::install(Director* director)
+{
+    // 用带计时的动作管理器替换默认实例，调度优先级与导演初始化时相同
+    Scheduler* scheduler = director->getScheduler();
+    ActionManager* actionManager = new (std::nothrow) ProfiledActionManager();
+    if (actionManager) {
+        scheduler->unscheduleUpdate(director->getActionManager());
+        director->setActionManager(actionManager);
+        scheduler->scheduleUpdate(actionManager, Scheduler::PRIORITY_SYSTEM, false);
+        actionManager->release();
+    }
+    
+    TraceRecorder::setThreadName("Main");
+    
+    // 主线程上不属于走子、加载的分配都记在帧作用域
+    AllocationTracker::setThreadScope(AS_FRAME);
+    AllocationTracker::setEnabled(true);
+    
+    ProfilerOverlayView* overlay = ProfilerOverlayView::create();
+    if (overlay) {
+        director->setNotificationNode(overlay);
+    }
+    return overlay;
+}
+
+ProfilerOverlayView* ProfilerOverlayView::create()
+{
+    ProfilerOverlayView* view = new (std::nothrow) ProfilerOverlayView();
+    if (view && view->init()) {
+        view->autorelease();
+        return view;
+    }
+    CC_SAFE_DELETE(view);
+    return nullptr;
+}
+
+ProfilerOverlayView::ProfilerOverlayView()
+    : _background(nullptr)
+    , _label(nullptr)
+    , _afterUpdateListener(nullptr)
+    , _afterDrawListener(nullptr)
+    , _touchListener(nullptr)
+    , _traceStatus("tap to trace")
+    , _traceFileIndex(0)
+    , _frameTraceOpen(false)
+    , _lastFrameCounts()
+    , _lastMoveCounts()
+    , _lastFrameCount(0)
+    , _frameAllocationsPerFrame(0.0f)
+    , _moveAllocationsPerMove(0.0f)
+    , _updateEndNanos(0)
+    , _frameEndNanos(0)
+{
+}
+
+ProfilerOverlayView::~ProfilerOverlayView()
+{
+}
+
+bool ProfilerOverlayView::init()
+{
+    if (!Node::init()) {
+        return false;
+    }
+    
+    Vec2 origin = Director::getInstance()->getVisibleOrigin();
+    
+    _background = LayerColor::create(Color4B(0, 0, 0, 160), 560, 320);
+    _background->setPosition(origin);
+    this->addChild(_background);
+    
+    // 等宽字体便于列对齐
+    _label = Label::createWithSystemFont("", "Courier", 22);
+    _label->setAnchorPoint(Vec2(0, 0));
+    _label->setPosition(origin + Vec2(10, 10));
+    _label->setTextColor(Color4B::WHITE);
+    this->addChild(_label);
+    
+    return true;
+}
+
+void ProfilerOverlayView::onEnter()
+{
+    Node::onEnter();
+    
+    FrameProfiler::reset();
+    _updateEndNanos = 0;
+    _frameEndNanos = 0;
+    _lastFrameCount = 0;
+    AllocationTracker::getCounts(AS_FRAME, _lastFrameCounts);
+    AllocationTracker::getCounts(AS_MOVE, _lastMoveCounts);
+    
+    EventDispatcher* dispatcher = Director::getInstance()->getEventDispatcher();
+    _afterUpdateListener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_UPDATE,
+                                                              [this](EventCustom*) { onAfterUpdate(); });
+    _afterDrawListener = dispatcher->addCustomEventListener(Director::EVENT_AFTER_DRAW,
+                                                            [this](EventCustom*) { onAfterDraw(); });
+    
+    // 浮层不在场景树中，用固定优先级监听点击，只吞掉落在底板上的触摸
+    _touchListener = EventListenerTouchOneByOne::create();
+    _touchListener->setSwallowTouches(true);
+    _touchListener->onTouchBegan = [this](Touch* touch, Event*) {
+        return _background->getBoundingBox().containsPoint(this->convertToNodeSpace(touch->getLocation()));
+    };
+    _touchListener->onTouchEnded = [this](Touch*, Event*) { toggleTracing(); };
+    dispatcher->addEventListenerWithFixedPriority(_touchListener, -1);
+    
+    this->schedule(CC_SCHEDULE_SELECTOR(ProfilerOverlayView::refreshText), REFRESH_INTERVAL);
+}
+
+void ProfilerOverlayView::onExit()
+{
+    EventDispatcher* dispatcher = Director::getInstance()->getEventDispatcher();
+    if (_afterUpdateListener) {
+        dispatcher->removeEventListener(_afterUpdateListener);
+        _afterUpdateListener = nullptr;
+    }
+    if (_afterDrawListener) {
+        dispatcher->removeEventListener(_afterDrawListener);
+        _afterDrawListener = nullptr;
+    }
+    if (_touchListener) {
+        dispatcher->removeEventListener(_touchListener);
+        _touchListener = nullptr;
+    }
+    this->unschedule(CC_SCHEDULE_SELECTOR(ProfilerOverlayView::refreshText));
+    
+    Node::onExit();
+}
+
+void ProfilerOverlayView::onAfterUpdate()
+{
+    _updateEndNanos = FrameProfiler::nowNanos();
+}
+
+void ProfilerOverlayView::onAfterDraw()
+{
+    uint64_t now = FrameProfiler::nowNanos();
+    
+    // 更新结束到绘制结束之间是场景遍历与渲染提交；导演暂停时没有更新事件，不记渲染耗时
+    if (_updateEndNanos > _frameEndNanos) {
+        FrameProfiler::addSample(PS_RENDER, now - _updateEndNanos);
+    }
+    
+    // 第一帧没有上一帧的结束时间，只记录起点
+    if (_frameEndNanos != 0) {
+        FrameProfiler::endFrame(now - _frameEndNanos);
+    }
+    _frameEndNanos = now;
+    
+    // 帧边界：每帧一段"Frame"事件，期间的点击处理、回退与动画回调都嵌套在其中
+    if (TraceRecorder::isEnabled()) {
+        if (_frameTraceOpen) {
+            TraceRecorder::record(TP_END, "frame", "Frame");
+        }
+        TraceRecorder::record(TP_BEGIN, "frame", "Frame");
+        _frameTraceOpen = true;
+    }
+}
+
+std::string ProfilerOverlayView::formatAllocations()
+{
+    // 与上次刷新之间的增量：帧作用域按帧数平均，走子作用域按走子次数平均，期间没有走子时保留上次的结果
+    AllocationCounts frame;
+    AllocationCounts move;
+    AllocationTracker::getCounts(AS_FRAME, frame);
+    AllocationTracker::getCounts(AS_MOVE, move);
+    uint64_t frameCount = FrameProfiler::getFrameCount();
+    
+    if (frameCount > _lastFrameCount && frame.allocations >= _lastFrameCounts.allocations) {
+        _frameAllocationsPerFrame = static_cast<float>(frame.allocations - _lastFrameCounts.allocations) /
+                                    (frameCount - _lastFrameCount);
+    }
+    if (move.entries > _lastMoveCounts.entries) {
+        _moveAllocationsPerMove = static_cast<float>(move.allocations - _lastMoveCounts.allocations) /
+                                  (move.entries - _lastMoveCounts.entries);
+    }
+    _lastFrameCounts = frame;
+    _lastMoveCounts = move;
+    _lastFrameCount = frameCount;
+    
+    return StringUtils::format("alloc/frame %.1f  alloc/move %.1f", _frameAllocationsPerFrame, _moveAllocationsPerMove);
+}
+
+void ProfilerOverlayView::toggleTracing()
+{
+    if (!TraceRecorder::isEnabled()) {
+        _frameTraceOpen = false;
+        TraceRecorder::start();
+        _traceStatus = "tracing... tap to save";
+        return;
+    }
+    
+    if (_frameTraceOpen) {
+        TraceRecorder::record(TP_END, "frame", "Frame");
+        _frameTraceOpen = false;
+    }
+    TraceRecorder::stop();
+    
+    std::string filePath = FileUtils::getInstance()->getWritablePath() +
+                           StringUtils::format("trace_%d.json", _traceFileIndex++);
+    if (TraceRecorder::writeChromeTraceFile(filePath)) {
+        _traceStatus = StringUtils::format("saved %d events: %s", TraceRecorder::getEventCount(), filePath.c_str());
+    } else {
+        _traceStatus = "failed to write " + filePath;
+    }
+}
+
+void ProfilerOverlayView::refreshText(float dt)
+{
+    std::string text = StringUtils::format("%-10s %4s %7s %7s %7s %7s\n", "ms", "n", "p50", "p95", "p99", "max");
+    
+    ProfileStats stats;
+    for (int section = 0; section < PS_COUNT; section++) {
+        if (FrameProfiler::getStats(section, stats)) {
+            text += StringUtils::format("%-10s %4d %7.2f %7.2f %7.2f %7.2f\n", FrameProfiler::getSectionName(section),
+                                        stats.callCount, stats.p50, stats.p95, stats.p99, stats.max);
+        } else {
+            text += StringUtils::format("%-10s %4d %7s %7s %7s %7s\n", FrameProfiler::getSectionName(section),
+                                        0, "-", "-", "-", "-");
+        }
+    }
+    
+    // 保留原统计中的帧率、批次与顶点数
+    Renderer* renderer = Director::getInstance()->getRenderer();
+    float fps = 0.0f;
+    if (FrameProfiler::getStats(PS_FRAME, stats) && stats.p50 > 0.0f) {
+        fps = 1000.0f / stats.p50;
+    }
+    text += StringUtils::format("fps %.1f  draws %d  verts %d\n", fps,
+                                static_cast<int>(renderer->getDrawnBatches()),
+                                static_cast<int>(renderer->getDrawnVertices()));
+    text += formatAllocations() + "\n";
+    text += _traceStatus;
+    
+    _label->setString(text);
+}
+
+#endif // CARD_PROFILING
@@ -0,0 +1,95 @@
+/**
+ * ProfilerOverlayView.h
+ * 分子系统帧耗时浮层，替代引擎自带的帧率统计显示
+ */
+
+#ifndef __PROFILER_OVERLAY_VIEW_H__
+#define __PROFILER_OVERLAY_VIEW_H__
+
+#include "../core/CoreMacros.h"
+
+#if CARD_PROFILING
+
+#include "cocos2d.h"
+#include "../core/profile/AllocationTracker.h"
+
+/**
+ * 帧耗时浮层
+ * 作为导演的通知节点绘制在所有场景之上，监听导演的更新、绘制事件划分帧边界，
+ * 把动作更新、渲染与整帧耗时写入FrameProfiler，并定时刷新各子系统的滚动分位数。
+ * 点击浮层开始/停止追踪，停止时把追踪写成Chrome trace JSON保存到可写目录。
+ * 同时打开分配统计，显示每帧与每次走子的堆分配次数。
+ * 只在CARD_PROFILING打开时编译
+ */
+class ProfilerOverlayView : public cocos2d::Node
+{
+public:
+    /**
+     * 安装浮层：替换为带计时的动作管理器并设置为导演的通知节点
+     * 需在创建任何场景节点之前调用，否则已创建的节点仍使用原动作管理器
+     * @param director 导演
+     * @return 浮层对象
+     */
+    static ProfilerOverlayView* install(cocos2d::Director* director);
+    
+    /**
+     * 创建浮层
+     */
+    static ProfilerOverlayView* create();
+    
+    /**
+     * 初始化浮层
+     * @return 是否初始化成功
+     */
+    virtual bool init() override;
+    
+    virtual void onEnter() override;
+    virtual void onExit() override;
+    
+protected:
+    ProfilerOverlayView();
+    virtual ~ProfilerOverlayView();
+    
+private:
+    /**
+     * 导演事件回调，分别标记更新结束与绘制结束
+     */
+    void onAfterUpdate();
+    void onAfterDraw();
+    
+    /**
+     * 按最新统计刷新文字
+     */
+    void refreshText(float dt);
+    
+    /**
+     * 计算上次刷新以来每帧、每次走子的分配次数
+     * @return 显示文字
+     */
+    std::string formatAllocations();
+    
+    /**
+     * 开始或停止追踪，停止时导出文件
+     */
+    void toggleTracing();
+    
+    cocos2d::LayerColor* _background;                       // 半透明底板
+    cocos2d::Label* _label;                                 // 统计文字
+    cocos2d::EventListenerCustom* _afterUpdateListener;
+    cocos2d::EventListenerCustom* _afterDrawListener;
+    cocos2d::EventListenerTouchOneByOne* _touchListener;
+    std::string _traceStatus;                               // 追踪状态提示
+    int _traceFileIndex;                                    // 导出文件序号
+    bool _frameTraceOpen;                                   // 是否已记录本帧的帧开始事件
+    AllocationCounts _lastFrameCounts;                      // 上次刷新时帧作用域的累计分配
+    AllocationCounts _lastMoveCounts;                       // 上次刷新时走子作用域的累计分配
+    uint64_t _lastFrameCount;                               // 上次刷新时的帧数
+    float _frameAllocationsPerFrame;
+    float _moveAllocationsPerMove;
+    uint64_t _updateEndNanos;                               // 本帧更新结束时间，暂停时不刷新
+    uint64_t _frameEndNanos;                                // 上一帧绘制结束时间
+};
+
+#endif // CARD_PROFILING
+
+#endif // __PROFILER_OVERLAY_VIEW_H__
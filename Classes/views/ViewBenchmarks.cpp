@@ -0,0 +1,122 @@
+/**
+ * ViewBenchmarks.cpp
+ * 卡牌视图微基准实现
+ */
+
+#include "ViewBenchmarks.h"
+#include "cocos2d.h"
+#include "CardView.h"
+#include "PlayfieldRenderer.h"
+#include "../adapters/CocosAdapter.h"
+#include "../core/profile/MicroBenchmark.h"
+
+USING_NS_CC;
+
+/**
+ * 创建52张牌的卡牌模型
+ */
+static void createDeckModels(std::vector<CardModel*>& models)
+{
+    for (int suit = CST_CLUBS; suit <= CST_SPADES; suit++) {
+        for (int face = CFT_ACE; face <= CFT_KING; face++) {
+            CoreVec2 position(100.0f + face * 70.0f, 400.0f + suit * 300.0f);
+            models.push_back(new CardModel(static_cast<int>(models.size()), static_cast<CardFaceType>(face),
+                                           static_cast<CardSuitType>(suit), position));
+        }
+    }
+}
+
+bool ViewBenchmarks::run(const std::string& outputPath)
+{
+    BenchmarkOptions options;
+    std::vector<BenchmarkResult> results;
+    BenchmarkResult result;
+    std::vector<CardModel*> models;
+    createDeckModels(models);
+    
+    // 创建并释放52张卡牌视图，纹理已在缓存中
+    MicroBenchmark::run("view.card_create.52", [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            AutoreleasePool pool;
+            for (CardModel* model : models) {
+                MicroBenchmark::keep(CardView::create(model));
+            }
+        }
+    }, options, result);
+    results.push_back(result);
+    
+    // 清空纹理缓存后创建一张卡牌视图，包含图片解码与纹理上传
+    TextureCache* textureCache = Director::getInstance()->getTextureCache();
+    MicroBenchmark::run("view.card_create_uncached", [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            AutoreleasePool pool;
+            textureCache->removeAllTextures();
+            MicroBenchmark::keep(CardView::create(models[i % models.size()]));
+        }
+    }, options, result);
+    results.push_back(result);
+    
+    // 遍历并绘制52张卡牌，glFinish等待GPU（无界面环境下为软件渲染）完成
+    Node* root = Node::create();
+    root->retain();
+    for (CardModel* model : models) {
+        CardView* view = CardView::create(model);
+        if (view) {
+            view->setPosition(CocosAdapter::toVec2(model->getPosition()));
+            root->addChild(view);
+        }
+    }
+    Renderer* renderer = Director::getInstance()->getRenderer();
+    MicroBenchmark::run("view.card_draw.52", [&](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; i++) {
+            root->visit(renderer, Mat4::IDENTITY, 0);
+            renderer->render();
+        }
+        glFinish();
+    }, options, result);
+    results.push_back(result);
+    root->release();
+    
+    // 同样的52张卡牌交给主牌区渲染器：一条自定义绘制命令，静止时不上传顶点
+    std::vector<CardModel*> playfieldCards;
+    for (CardModel* model : models) {
+        playfieldCards.push_back(new CardModel(model->getCardId(), model->getFace(), model->getSuit(),
+                                               model->getPosition()));
+    }
+    std::vector<CardModel*> stackCards(1, new CardModel(static_cast<int>(models.size()), CFT_ACE, CST_CLUBS,
+                                                        CoreVec2()));
+    GameModel gameModel;
+    gameModel.init(playfieldCards, stackCards);
+    PlayfieldRenderer* playfield = PlayfieldRenderer::create(&gameModel);
+    if (playfield) {
+        playfield->retain();
+        // 先执行一次渲染，把牌面合成到图集上
+        playfield->visit(renderer, Mat4::IDENTITY, 0);
+        renderer->render();
+        MicroBenchmark::run("view.playfield_draw.52", [&](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; i++) {
+                playfield->visit(renderer, Mat4::IDENTITY, 0);
+                renderer->render();
+            }
+            glFinish();
+        }, options, result);
+        results.push_back(result);
+        playfield->release();
+    }
+    // 手牌区顶部卡牌不归游戏模型释放
+    delete gameModel.getTrayTopCard();
+    
+    for (CardModel* model : models) {
+        delete model;
+    }
+    
+    if (!MicroBenchmark::writeJsonFile("views", results, outputPath)) {
+        CCLOG("ViewBenchmarks: failed to write %s", outputPath.c_str());
+        return false;
+    }
+    for (const auto& entry : results) {
+        CCLOG("%-32s %14.1f ns  [%.1f, %.1f]", entry.name.c_str(), entry.meanNanos, entry.ciLowNanos,
+              entry.ciHighNanos);
+    }
+    return true;
+}
@@ -0,0 +1,28 @@
+/**
+ * ViewBenchmarks.h
+ * 卡牌视图的微基准，需要GL上下文，在游戏进程内运行
+ */
+
+#ifndef __VIEW_BENCHMARKS_H__
+#define __VIEW_BENCHMARKS_H__
+
+#include <string>
+
+/**
+ * 卡牌视图微基准
+ * 在导演设置好GL视图之后、运行第一个场景之前调用，结果格式与RunBenchmarks相同，
+ * 可以用 RunBenchmarks --compare 比较。桌面平台设置环境变量CARD_BENCHMARK_OUTPUT时由AppDelegate调用，
+ * Linux下可在xvfb-run中以无界面的GL上下文运行
+ */
+class ViewBenchmarks
+{
+public:
+    /**
+     * 运行全部视图基准并写出JSON结果
+     * @param outputPath 结果文件路径
+     * @return 是否写入成功
+     */
+    static bool run(const std::string& outputPath);
+};
+
+#endif // __VIEW_BENCHMARKS_H__